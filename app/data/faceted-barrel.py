@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+# Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+# See the top-level COPYRIGHT file for details.
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+"""
+Write the ORANGE JSON geometry ``faceted-barrel.org.json``.
+
+A cylindrical "barrel" contains a sphere at the origin, a ring of 24 small
+spheres, four rods, and an ellipsoid. It's surrounded by a 24-sided prism.
+The "gap" between the prism and barrel, and the barrel itself, are volumes
+with many faces that can be intersected in batches on the host. This is the
+same geometry as the ``FacetedBarrelTest`` unit test.
+
+Usage: ./faceted-barrel.py > faceted-barrel.org.json
+"""
+import json
+import math
+import sys
+
+NUM_FACETS = 24
+NUM_BALLS = 24
+HALF_HEIGHT = 10.0
+
+types = []
+data = []
+names = []
+num_isect = {}
+
+
+def add_surface(name, stype, coeffs, nisect=2):
+    types.append(stype)
+    data.append([float(c) for c in coeffs])
+    names.append(name)
+    num_isect[len(names) - 1] = nisect
+    return len(names) - 1
+
+
+def make_cell(terms, flags=0, negate=False):
+    """Build a cell from (surface, inside) terms joined by 'and'."""
+    terms = sorted(terms)
+    logic = []
+    for (i, (_, inside)) in enumerate(terms):
+        logic.append(str(i))
+        if inside:
+            logic.append("~")
+        if i > 0:
+            logic.append("&")
+    if negate:
+        logic.append("~")
+    faces = [s for (s, _) in terms]
+    cell = {
+        "faces": faces,
+        "logic": " ".join(logic),
+        "num_intersections": sum(num_isect[s] for s in faces),
+        "zorder": 2,
+    }
+    if flags:
+        cell["flags"] = flags
+    return cell
+
+
+hull = []
+for i in range(NUM_FACETS):
+    angle = 2 * math.pi * i / NUM_FACETS
+    hull.append((add_surface(f"facet@{i}", "p",
+                             [math.cos(angle), math.sin(angle), 0, 10], 1),
+                 True))
+zlo = (add_surface("zlo", "pz", [-HALF_HEIGHT], 1), False)
+zhi = (add_surface("zhi", "pz", [HALF_HEIGHT], 1), True)
+hull += [zlo, zhi]
+
+barrel = add_surface("barrel", "czc", [9.8 ** 2])
+barrel_terms = [(barrel, True), zlo, zhi]
+
+cell_names = ["[EXTERIOR]"]
+cells = [make_cell(hull, flags=1, negate=True)]
+
+inner_names = []
+inner = []
+
+
+def add_inner(name, stype, coeffs, extra=()):
+    s = add_surface(name, stype, coeffs)
+    barrel_terms.append((s, False))
+    inner_names.append(name)
+    inner.append(make_cell([(s, True)] + list(extra)))
+
+
+add_inner("core", "sc", [1.5 ** 2])
+for i in range(NUM_BALLS):
+    angle = 2 * math.pi * i / NUM_BALLS
+    add_inner(f"ball{i}", "s",
+              [4 * math.cos(angle), 4 * math.sin(angle), 0, 0.3 ** 2])
+for i in range(4):
+    angle = 2 * math.pi * (i + 1 / 12) / 4
+    add_inner(f"rod{i}", "cz", [7 * math.cos(angle), 7 * math.sin(angle), 1],
+              extra=[zlo, zhi])
+# Ellipsoid centered on z = -7 with semi-axes 2, 2, 1
+add_inner("egg", "sq", [0.25, 0.25, 1, 0, 0, 14, 48])
+
+cell_names += ["gap", "barrel"] + inner_names
+cells += [make_cell(hull + [(barrel, False)]), make_cell(barrel_terms)]
+cells += inner
+
+geo = {
+    "_format": "SCALE ORANGE",
+    "_version": 0,
+    "universes": [{
+        "_type": "simple unit",
+        "bbox": [[-10.0, -10.0, -HALF_HEIGHT], [10.0, 10.0, HALF_HEIGHT]],
+        "cell_names": cell_names,
+        "cells": cells,
+        "md": {"name": "faceted barrel", "provenance": "faceted-barrel.py"},
+        "surface_names": names,
+        "surfaces": {
+            "data": [c for coeffs in data for c in coeffs],
+            "sizes": [len(coeffs) for coeffs in data],
+            "types": types,
+        },
+    }],
+}
+json.dump(geo, sys.stdout, indent=0)
+sys.stdout.write("\n")
@@ -11,6 +11,7 @@
 #include <G4Event.hh>
 
 #include "corecel/Macros.hh"
+#include "corecel/io/Logger.hh"
 #include "accel/ExceptionConverter.hh"
 
 #include "GlobalSetup.hh"
@@ -32,9 +33,14 @@ void EventAction::BeginOfEventAction(G4Event const* event)
 {
     CELER_LOG_LOCAL(debug) << "Starting event " << event->GetEventID();
 
-    // Set event ID in local transporter
+    // Set event ID in local transporter, and record when its offloaded
+    // tracks are complete
+    auto done = [this](int id) {
+        CELER_LOG_LOCAL(debug) << "Completed offloaded tracks for event " << id;
+        completed_event_ = id;
+    };
     celeritas::ExceptionConverter call_g4exception{"celer0002"};
-    CELER_TRY_HANDLE(transport_->SetEventId(event->GetEventID()),
+    CELER_TRY_HANDLE(transport_->SetEventId(event->GetEventID(), done),
                      call_g4exception);
 }
 
@@ -52,6 +58,10 @@ void EventAction::EndOfEventAction(G4Event const* event)
 
     if (GlobalSetup::Instance()->GetWriteSDHits())
     {
+        // Events with sensitive detectors are completed by the flush, so
+        // the offloaded hits are in this event
+        CELER_ASSERT(completed_event_ == event->GetEventID());
+
         // Write sensitive hits
         HitRootIO::Instance()->WriteHits(event);
     }
@@ -37,6 +37,7 @@ class EventAction final : public G4UserEventAction
 
   private:
     SPTransporter transport_;
+    int completed_event_{-1};
 };
 
 //---------------------------------------------------------------------------//
@@ -85,6 +85,40 @@ GlobalSetup::GlobalSetup()
         options_->max_num_events = 1024;
         cmd.SetDefaultValue(std::to_string(options_->max_num_events));
     }
+    {
+        auto& cmd = messenger_->DeclareProperty(
+            "maxConcurrentEvents", options_->max_concurrent_events);
+        cmd.SetGuidance(
+            "Set the maximum number of in-flight events per thread");
+        options_->max_concurrent_events = 1;
+        cmd.SetDefaultValue(std::to_string(options_->max_concurrent_events));
+    }
+    {
+        auto& cmd = messenger_->DeclareProperty(
+            "minActiveFraction", options_->min_active_fraction);
+        cmd.SetGuidance(
+            "Set the fraction of occupied track slots below which the last "
+            "tracks are transported on the host");
+        options_->min_active_fraction = 0;
+        cmd.SetDefaultValue(std::to_string(options_->min_active_fraction));
+    }
+    {
+        auto& cmd = messenger_->DeclareProperty("stepDiagnostics",
+                                                options_->step_diagnostics);
+        cmd.SetGuidance(
+            "Write the occupancy and throughput of each step to the output");
+        options_->step_diagnostics = false;
+        cmd.SetDefaultValue("false");
+    }
+    {
+        auto& cmd = messenger_->DeclareProperty(
+            "maxStepDiagnosticSamples", options_->max_step_diagnostic_samples);
+        cmd.SetGuidance(
+            "Set the number of steps saved before down-sampling diagnostics");
+        options_->max_step_diagnostic_samples = 0;
+        cmd.SetDefaultValue(
+            std::to_string(options_->max_step_diagnostic_samples));
+    }
     {
         auto& cmd = messenger_->DeclareProperty(
             "secondaryStackFactor", options_->secondary_stack_factor);
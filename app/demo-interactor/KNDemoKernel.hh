@@ -40,7 +40,7 @@ struct TableData
     template<class T>
     using Items = celeritas::Collection<T, W, M>;
 
-    Items<celeritas::real_type> reals;
+    Items<celeritas::table_real_type> reals;
     celeritas::XsGridData xs;
 
     //// MEMBER FUNCTIONS ////
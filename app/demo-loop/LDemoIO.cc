@@ -37,6 +37,7 @@
 #include "celeritas/phys/PhysicsParams.hh"
 #include "celeritas/phys/PrimaryGeneratorOptionsIO.json.hh"
 #include "celeritas/phys/ProcessBuilder.hh"
+#include "celeritas/phys/WoodcockParams.hh"
 #include "celeritas/random/RngParams.hh"
 #include "celeritas/track/SimParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
@@ -100,14 +101,23 @@ void to_json(nlohmann::json& j, LDemoArgs const& v)
                        {"max_num_tracks", v.max_num_tracks},
                        {"max_steps", v.max_steps},
                        {"track_order", v.track_order},
+                       {"compaction_threshold", v.compaction_threshold},
                        {"initializer_capacity", v.initializer_capacity},
                        {"max_events", v.max_events},
                        {"secondary_stack_factor", v.secondary_stack_factor},
                        {"enable_diagnostics", v.enable_diagnostics},
                        {"use_device", v.use_device},
                        {"sync", v.sync},
+                       {"min_active_fraction", v.min_active_fraction},
+                       {"fused_chunk_size", v.fused_chunk_size},
+                       {"num_streams", v.num_streams},
+                       {"profile_actions", v.profile_actions},
                        {"mag_field", v.mag_field},
-                       {"brem_combined", v.brem_combined}};
+                       {"brem_combined", v.brem_combined},
+                       {"brem_sb_alias", v.brem_sb_alias},
+                       {"fused_xs", v.fused_xs},
+                       {"validate_tables", v.validate_tables},
+                       {"woodcock", v.woodcock}};
     if (v.mag_field != LDemoArgs::no_field())
     {
         j["field_options"] = v.field_options;
@@ -179,6 +189,10 @@ void from_json(nlohmann::json const& j, LDemoArgs& v)
     {
         j.at("track_order").get_to(v.track_order);
     }
+    if (j.contains("compaction_threshold"))
+    {
+        j.at("compaction_threshold").get_to(v.compaction_threshold);
+    }
     if (j.contains("max_steps"))
     {
         j.at("max_steps").get_to(v.max_steps);
@@ -190,6 +204,22 @@ void from_json(nlohmann::json const& j, LDemoArgs& v)
     j.at("enable_diagnostics").get_to(v.enable_diagnostics);
     j.at("use_device").get_to(v.use_device);
     j.at("sync").get_to(v.sync);
+    if (j.contains("min_active_fraction"))
+    {
+        j.at("min_active_fraction").get_to(v.min_active_fraction);
+    }
+    if (j.contains("fused_chunk_size"))
+    {
+        j.at("fused_chunk_size").get_to(v.fused_chunk_size);
+    }
+    if (j.contains("num_streams"))
+    {
+        j.at("num_streams").get_to(v.num_streams);
+    }
+    if (j.contains("profile_actions"))
+    {
+        j.at("profile_actions").get_to(v.profile_actions);
+    }
     if (j.contains("mag_field"))
     {
         j.at("mag_field").get_to(v.mag_field);
@@ -204,6 +234,22 @@ void from_json(nlohmann::json const& j, LDemoArgs& v)
     }
 
     j.at("brem_combined").get_to(v.brem_combined);
+    if (j.contains("brem_sb_alias"))
+    {
+        j.at("brem_sb_alias").get_to(v.brem_sb_alias);
+    }
+    if (j.contains("fused_xs"))
+    {
+        j.at("fused_xs").get_to(v.fused_xs);
+    }
+    if (j.contains("validate_tables"))
+    {
+        j.at("validate_tables").get_to(v.validate_tables);
+    }
+    if (j.contains("woodcock"))
+    {
+        j.at("woodcock").get_to(v.woodcock);
+    }
 
     if (j.contains("energy_diag"))
     {
@@ -243,6 +289,9 @@ CoreParams::Input load_core_params(LDemoArgs const& args)
     // Create action manager
     params.action_reg = std::make_shared<ActionRegistry>();
 
+    // Share the params among all streams
+    params.max_streams = args.num_streams;
+
     // Load geometry
     params.geometry
         = std::make_shared<GeoParams>(args.geometry_filename.c_str());
@@ -251,7 +300,8 @@ CoreParams::Input load_core_params(LDemoArgs const& args)
         CELER_LOG(warning) << "Geometry contains surfaces that are "
                               "incompatible with the current ORANGE simple "
                               "safety algorithm: multiple scattering may "
-                              "result in arbitrarily small steps";
+                              "take smaller steps due to conservative safety "
+                              "distances";
     }
 
     // Load materials
@@ -277,6 +327,8 @@ CoreParams::Input load_core_params(LDemoArgs const& args)
 
         input.options.fixed_step_limiter = args.step_limiter;
         input.options.secondary_stack_factor = args.secondary_stack_factor;
+        input.options.fused_xs = args.fused_xs;
+        input.options.validate_tables = args.validate_tables;
         input.options.linear_loss_limit = imported.em_params.linear_loss_limit;
         input.options.lowest_electron_energy = PhysicsParamsOptions::Energy{
             imported.em_params.lowest_electron_energy};
@@ -285,6 +337,7 @@ CoreParams::Input load_core_params(LDemoArgs const& args)
             std::vector<std::shared_ptr<Process const>> result;
             ProcessBuilder::Options opts;
             opts.brem_combined = args.brem_combined;
+            opts.brem_sb_alias = args.brem_sb_alias;
 
             ProcessBuilder build_process(
                 imported, params.particle, params.material, opts);
@@ -305,13 +358,23 @@ CoreParams::Input load_core_params(LDemoArgs const& args)
         *params.particle, *params.material, imported);
     if (args.mag_field == LDemoArgs::no_field())
     {
+        AlongStepGeneralLinearAction::SPConstWoodcock woodcock;
+        if (args.woodcock)
+        {
+            woodcock = std::make_shared<WoodcockParams>(*params.particle,
+                                                        *params.material,
+                                                        *params.geomaterial,
+                                                        *params.physics);
+        }
+
         // Create along-step action
         auto along_step = AlongStepGeneralLinearAction::from_params(
             params.action_reg->next_id(),
             *params.material,
             *params.particle,
             msc,
-            eloss);
+            eloss,
+            woodcock);
         params.action_reg->insert(along_step);
     }
     else
@@ -319,6 +382,9 @@ CoreParams::Input load_core_params(LDemoArgs const& args)
         CELER_VALIDATE(!eloss,
                        << "energy loss fluctuations are not supported "
                           "simultaneoulsy with magnetic field");
+        CELER_VALIDATE(!args.woodcock,
+                       << "Woodcock tracking is not supported with a "
+                          "magnetic field");
         UniformFieldParams field_params;
         field_params.field = args.mag_field;
         field_params.options = args.field_options;
@@ -358,6 +424,7 @@ CoreParams::Input load_core_params(LDemoArgs const& args)
         input.capacity = args.initializer_capacity;
         input.max_events = args.max_events;
         input.track_order = args.track_order;
+        input.compaction_threshold = args.compaction_threshold;
         return std::make_shared<TrackInitParams>(std::move(input));
     }();
 
@@ -381,10 +448,16 @@ build_transporter(LDemoArgs const& args,
                    << "nonpositive max_num_tracks=" << args.max_num_tracks);
     CELER_VALIDATE(args.max_steps > 0,
                    << "nonpositive max_steps=" << args.max_steps);
+    CELER_VALIDATE(args.num_streams > 0,
+                   << "nonpositive num_streams=" << args.num_streams);
     input.num_track_slots = args.max_num_tracks;
     input.max_steps = args.max_steps;
     input.enable_diagnostics = args.enable_diagnostics;
     input.sync = args.sync;
+    input.min_active_fraction = args.min_active_fraction;
+    input.fused_chunk_size = args.fused_chunk_size;
+    input.num_streams = args.num_streams;
+    input.profile_actions = args.profile_actions;
     input.energy_diag = args.energy_diag;
 
     // Create core params
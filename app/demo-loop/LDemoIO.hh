@@ -30,9 +30,13 @@ namespace celeritas
 class OutputRegistry;
 class CoreParams;
 
-NLOHMANN_JSON_SERIALIZE_ENUM(TrackOrder,
-                             {{TrackOrder::unsorted, "unsorted"},
-                              {TrackOrder::shuffled, "shuffled"}})
+NLOHMANN_JSON_SERIALIZE_ENUM(
+    TrackOrder,
+    {{TrackOrder::unsorted, "unsorted"},
+     {TrackOrder::shuffled, "shuffled"},
+     {TrackOrder::sort_step_limit_action, "sort_step_limit_action"},
+     {TrackOrder::partition_charge, "partition_charge"},
+     {TrackOrder::sort_particle_energy, "sort_particle_energy"}})
 }
 
 namespace demo_loop
@@ -97,6 +101,10 @@ struct LDemoArgs
     bool enable_diagnostics{};
     bool use_device{};
     bool sync{};
+    real_type min_active_fraction{};
+    size_type fused_chunk_size{};
+    size_type num_streams{1};
+    bool profile_actions{false};
 
     // Magnetic field vector [* 1/Tesla] and associated field options
     Real3 mag_field{no_field()};
@@ -108,12 +116,17 @@ struct LDemoArgs
 
     // Options for physics
     bool brem_combined{true};
+    bool brem_sb_alias{false};
+    bool fused_xs{false};
+    bool validate_tables{false};
+    bool woodcock{false};
 
     // Diagnostic input
     EnergyDiagInput energy_diag;
 
     // Track init options
     celeritas::TrackOrder track_order{celeritas::TrackOrder::unsorted};
+    real_type compaction_threshold{};
 
     // Optional setup options if loading directly from Geant4
     celeritas::GeantPhysicsOptions geant_options;
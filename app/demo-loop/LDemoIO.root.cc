@@ -43,6 +43,10 @@ void to_root(celeritas::RootFileManager& root_manager, LDemoArgs const& cargs)
     tree_input->Branch("enable_diagnostics", &args.enable_diagnostics);
     tree_input->Branch("use_device", &args.use_device);
     tree_input->Branch("sync", &args.sync);
+    tree_input->Branch("min_active_fraction", &args.min_active_fraction);
+    tree_input->Branch("fused_chunk_size", &args.fused_chunk_size);
+    tree_input->Branch("num_streams", &args.num_streams);
+    tree_input->Branch("profile_actions", &args.profile_actions);
     tree_input->Branch("step_limiter", &args.step_limiter);
 
     // Options for physics processes and models
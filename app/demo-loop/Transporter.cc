@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "Transporter.hh"
 
+#include <algorithm>
 #include <csignal>
 #include <memory>
 #include <type_traits>
@@ -16,6 +17,7 @@
 #include "corecel/cont/Range.hh"
 #include "corecel/data/Ref.hh"
 #include "corecel/io/Logger.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ScopedSignalHandler.hh"
 #include "corecel/sys/Stopwatch.hh"
 #include "celeritas/global/ActionRegistry.hh"  // IWYU pragma: keep
@@ -23,6 +25,7 @@
 #include "celeritas/global/detail/ActionSequence.hh"
 #include "celeritas/grid/VectorUtils.hh"
 #include "celeritas/phys/Model.hh"
+#include "celeritas/phys/Primary.hh"
 
 #include "diagnostic/Diagnostic.hh"
 #include "diagnostic/EnergyDiagnostic.hh"
@@ -53,32 +56,80 @@ get_diag_ref(DiagnosticStore& params, MemTag<MemSpace::device>)
     return params.device;
 }
 
+//---------------------------------------------------------------------------//
+//! Add each element of a vector to another, extending the destination
+template<class T, class F>
+void merge_vec(std::vector<T> const& src, std::vector<T>* dst, F&& combine)
+{
+    if (dst->size() < src.size())
+    {
+        dst->resize(src.size(), T{});
+    }
+    for (auto i : range(src.size()))
+    {
+        (*dst)[i] = combine((*dst)[i], src[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+//! Combine the result from a single stream into the overall result
+void merge_result(TransporterResult const& src, TransporterResult* dst)
+{
+    auto add = [](auto a, auto b) { return a + b; };
+    merge_vec(src.initializers, &dst->initializers, add);
+    merge_vec(src.active, &dst->active, add);
+    merge_vec(src.alive, &dst->alive, add);
+    merge_vec(src.backlog, &dst->backlog, add);
+    merge_vec(src.tail, &dst->tail, add);
+    merge_vec(src.edep, &dst->edep, add);
+    for (auto const& kv : src.process)
+    {
+        dst->process[kv.first] += kv.second;
+    }
+    for (auto const& kv : src.steps)
+    {
+        merge_vec(kv.second, &dst->steps[kv.first], add);
+    }
+
+    // Concurrent steps take as long as the slowest stream
+    merge_vec(src.time.steps, &dst->time.steps, [](auto a, auto b) {
+        return std::max(a, b);
+    });
+    for (auto const& kv : src.time.actions)
+    {
+        dst->time.actions[kv.first] += kv.second;
+    }
+}
+
 //---------------------------------------------------------------------------//
 //! Adapt a vector of diagnostics to the Action interface
 class DiagnosticActionAdapter final : public ExplicitActionInterface
 {
   public:
     using SPDiagnostics = std::shared_ptr<DiagnosticStore>;
+    using VecDiagnostics = std::vector<SPDiagnostics>;
 
   public:
-    DiagnosticActionAdapter(ActionId id, SPDiagnostics diag)
-        : id_(id), diagnostics_(diag)
+    //! Construct with diagnostics for each stream
+    DiagnosticActionAdapter(ActionId id, VecDiagnostics diag)
+        : id_(id), diagnostics_(std::move(diag))
     {
         CELER_EXPECT(id_);
-        CELER_EXPECT(diagnostics_);
+        CELER_EXPECT(!diagnostics_.empty());
     }
 
     //! Execute the action with host data
     void execute(ParamsHostCRef const& params, StateHostRef& states) const final
     {
-        this->execute_impl(params, states, diagnostics_->host);
+        this->execute_impl(params, states, this->store(states.stream_id).host);
     }
 
     //! Execute the action with device data
     void
     execute(ParamsDeviceCRef const& params, StateDeviceRef& states) const final
     {
-        this->execute_impl(params, states, diagnostics_->device);
+        this->execute_impl(
+            params, states, this->store(states.stream_id).device);
     }
 
     //!@{
@@ -94,7 +145,14 @@ class DiagnosticActionAdapter final : public ExplicitActionInterface
 
   private:
     ActionId id_;
-    SPDiagnostics diagnostics_;
+    VecDiagnostics diagnostics_;
+
+    //! Get the diagnostics for a stream
+    DiagnosticStore& store(StreamId stream) const
+    {
+        CELER_EXPECT(stream < diagnostics_.size());
+        return *diagnostics_[stream.get()];
+    }
 
     template<MemSpace M>
     using VecUPDiag = DiagnosticStore::VecUPDiag<M>;
@@ -130,24 +188,36 @@ Transporter<M>::Transporter(TransporterInput inp)
     CELER_EXPECT(input_);
 
     CoreParams const& params = *input_.params;
+    CELER_VALIDATE(input_.num_streams <= params.max_streams(),
+                   << "number of streams (" << input_.num_streams
+                   << ") exceeds max_streams=" << params.max_streams());
+    CELER_VALIDATE(M == MemSpace::host || input_.num_streams == 1,
+                   << "multiple streams are only supported on host");
 
     // Create diagnostics
     if (input_.enable_diagnostics)
     {
-        diagnostics_ = std::make_shared<DiagnosticStore>();
-        auto& diag = get_diag_ref(*diagnostics_, MemTag<M>{});
-        diag.push_back(std::make_unique<StepDiagnostic<M>>(
-            get_ref<M>(params), params.particle(), input_.num_track_slots, 200));
-        diag.push_back(std::make_unique<ParticleProcessDiagnostic<M>>(
-            get_ref<M>(params), params.particle(), params.physics()));
+        // Each stream tallies into a separate set of diagnostics
+        for ([[maybe_unused]] auto stream : range(input_.num_streams))
         {
-            auto const& ediag = input_.energy_diag;
-            CELER_VALIDATE(ediag.axis >= 'x' && ediag.axis <= 'z',
-                           << "Invalid axis '" << ediag.axis
-                           << "' (must be x, y, or z)");
-            diag.push_back(std::make_unique<EnergyDiagnostic<M>>(
-                linspace(ediag.min, ediag.max, ediag.num_bins + 1),
-                static_cast<Axis>(ediag.axis - 'x')));
+            diagnostics_.push_back(std::make_shared<DiagnosticStore>());
+            auto& diag = get_diag_ref(*diagnostics_.back(), MemTag<M>{});
+            diag.push_back(
+                std::make_unique<StepDiagnostic<M>>(get_ref<M>(params),
+                                                    params.particle(),
+                                                    input_.num_track_slots,
+                                                    200));
+            diag.push_back(std::make_unique<ParticleProcessDiagnostic<M>>(
+                get_ref<M>(params), params.particle(), params.physics()));
+            {
+                auto const& ediag = input_.energy_diag;
+                CELER_VALIDATE(ediag.axis >= 'x' && ediag.axis <= 'z',
+                               << "Invalid axis '" << ediag.axis
+                               << "' (must be x, y, or z)");
+                diag.push_back(std::make_unique<EnergyDiagnostic<M>>(
+                    linspace(ediag.min, ediag.max, ediag.num_bins + 1),
+                    static_cast<Axis>(ediag.axis - 'x')));
+            }
         }
 
         // Add diagnostic adapters to action manager
@@ -166,6 +236,62 @@ TransporterResult Transporter<M>::operator()(SpanConstPrimary primaries)
 {
     Stopwatch get_transport_time;
 
+    // Abort cleanly for interrupt and user-defined signals
+    ScopedSignalHandler interrupted{SIGINT, SIGUSR2};
+    CELER_LOG(status) << "Transporting";
+
+    TransporterResult result;
+    size_type const num_streams = input_.num_streams;
+    if (num_streams == 1)
+    {
+        result = this->transport_stream(StreamId{0}, primaries, interrupted);
+    }
+    else
+    {
+        // Assign whole events to streams
+        std::vector<std::vector<Primary>> stream_primaries(num_streams);
+        for (Primary const& p : primaries)
+        {
+            CELER_ASSERT(p.event_id);
+            stream_primaries[p.event_id.get() % num_streams].push_back(p);
+        }
+
+        // Transport each stream on a separate thread
+        std::vector<TransporterResult> stream_results(num_streams);
+        MultiExceptionHandler capture_exception;
+#pragma omp parallel for schedule(dynamic)
+        for (size_type i = 0; i < num_streams; ++i)
+        {
+            CELER_TRY_HANDLE(
+                stream_results[i] = this->transport_stream(
+                    StreamId{i}, make_span(stream_primaries[i]), interrupted),
+                capture_exception);
+        }
+        log_and_rethrow(std::move(capture_exception));
+
+        // Combine results in stream order
+        for (auto const& stream_result : stream_results)
+        {
+            merge_result(stream_result, &result);
+        }
+    }
+
+    result.time.total = get_transport_time();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport primaries and their secondaries on a single stream.
+ */
+template<MemSpace M>
+TransporterResult
+Transporter<M>::transport_stream(StreamId stream,
+                                 SpanConstPrimary primaries,
+                                 ScopedSignalHandler const& interrupted)
+{
+    CELER_EXPECT(stream < input_.num_streams);
+
     // Initialize results
     TransporterResult result;
     if (input_.max_steps != input_.no_max_steps())
@@ -174,53 +300,81 @@ TransporterResult Transporter<M>::operator()(SpanConstPrimary primaries)
         result.initializers.reserve(input_.max_steps);
         result.active.reserve(input_.max_steps);
         result.alive.reserve(input_.max_steps);
+        result.backlog.reserve(input_.max_steps);
+        result.tail.reserve(input_.max_steps);
     }
     auto append_track_counts = [&result](StepperResult const& track_counts) {
         result.initializers.push_back(track_counts.queued);
         result.active.push_back(track_counts.active);
         result.alive.push_back(track_counts.alive);
+        result.backlog.push_back(track_counts.backlog);
+        result.tail.push_back(track_counts.tail);
     };
 
-    // Abort cleanly for interrupt and user-defined signals
-    ScopedSignalHandler interrupted{SIGINT, SIGUSR2};
-    CELER_LOG(status) << "Transporting";
-
     StepperInput input;
     input.params = input_.params;
     input.num_track_slots = input_.num_track_slots;
-    // TODO: change when doing multithreading on the front end
-    input.stream_id = StreamId{0};
+    input.stream_id = stream;
     input.sync = input_.sync;
+    input.min_active_fraction = input_.min_active_fraction;
+    input.fused_chunk_size = input_.fused_chunk_size;
+    input.profile = input_.profile_actions;
     Stepper<M> step(std::move(input));
 
-    Stopwatch get_step_time;
     size_type remaining_steps = input_.max_steps;
 
-    // Copy primaries to device and transport the first step
-    auto track_counts = step(primaries);
-    append_track_counts(track_counts);
-    result.time.steps.push_back(get_step_time());
+    // Transport the initial primaries (or the already queued tracks if there
+    // are none), then step until all tracks are done
+    auto run_steps = [&](StepperInterface& stepper,
+                         SpanConstPrimary initial) {
+        Stopwatch get_step_time;
+        auto track_counts = initial.empty() ? stepper() : stepper(initial);
+        append_track_counts(track_counts);
+        result.time.steps.push_back(get_step_time());
 
-    while (track_counts)
-    {
-        if (CELER_UNLIKELY(--remaining_steps == 0))
+        while (track_counts)
         {
-            CELER_LOG(error) << "Exceeded step count of " << input_.max_steps
-                             << ": aborting transport loop";
-            break;
-        }
-        if (CELER_UNLIKELY(interrupted()))
-        {
-            CELER_LOG(error) << "Caught interrupt signal: aborting transport "
-                                "loop";
-            interrupted = {};
-            break;
+            if (CELER_UNLIKELY(--remaining_steps == 0))
+            {
+                CELER_LOG(error) << "Exceeded step count of "
+                                 << input_.max_steps
+                                 << ": aborting transport loop";
+                return false;
+            }
+            if (CELER_UNLIKELY(interrupted()))
+            {
+                CELER_LOG(error) << "Caught interrupt signal: aborting "
+                                    "transport loop";
+                return false;
+            }
+
+            get_step_time = {};
+            track_counts = stepper();
+            append_track_counts(track_counts);
+            result.time.steps.push_back(get_step_time());
         }
+        return true;
+    };
 
-        get_step_time = {};
-        track_counts = step();
-        append_track_counts(track_counts);
-        result.time.steps.push_back(get_step_time());
+    // Copy primaries to device and transport
+    bool completed = run_steps(step, primaries);
+
+    auto tail = step.release_tail();
+    if (completed && !tail.tracks.empty())
+    {
+        // Finish the few remaining tracks on the host, keeping their IDs and
+        // using different random numbers from the original state
+        CELER_LOG(status) << "Transporting " << tail.tracks.size()
+                          << " remaining tracks on host";
+        StepperInput tail_input;
+        tail_input.params = input_.params;
+        tail_input.num_track_slots = tail.tracks.size();
+        tail_input.stream_id = stream;
+        tail_input.fused_chunk_size = input_.fused_chunk_size;
+        tail_input.rng_substream = 1;
+        Stepper<MemSpace::host> tail_step(std::move(tail_input));
+        tail_step.insert_tail(tail);
+        run_steps(tail_step, {});
     }
 
     // Save kernel timing if host or synchronization is enabled
@@ -238,16 +392,16 @@ TransporterResult Transporter<M>::operator()(SpanConstPrimary primaries)
         }
     }
 
-    if (diagnostics_)
+    if (!diagnostics_.empty())
     {
         CELER_LOG(status) << "Finalizing diagnostic data";
         // Collect results from diagnostics
-        for (auto& diagnostic : get_diag_ref(*diagnostics_, MemTag<M>{}))
+        auto& store = *diagnostics_[stream.get()];
+        for (auto& diagnostic : get_diag_ref(store, MemTag<M>{}))
         {
             diagnostic->get_result(&result);
         }
     }
-    result.time.total = get_transport_time();
     return result;
 }
 
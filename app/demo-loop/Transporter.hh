@@ -25,6 +25,7 @@
 namespace celeritas
 {
 struct Primary;
+class ScopedSignalHandler;
 }
 
 namespace demo_loop
@@ -62,6 +63,10 @@ struct TransporterInput
     std::shared_ptr<CoreParams const> params;
     size_type num_track_slots{};  //!< AKA max_num_tracks
     bool sync{false};  //!< Whether to synchronize device between actions
+    celeritas::real_type min_active_fraction{0};  //!< Tail policy threshold
+    size_type fused_chunk_size{0};  //!< Tracks per fused host chunk
+    size_type num_streams{1};  //!< Concurrent host streams sharing params
+    bool profile_actions{false};  //!< Write per-action timing histograms
 
     // Loop control
     size_type max_steps{};
@@ -73,7 +78,8 @@ struct TransporterInput
     //! True if all params are assigned
     explicit operator bool() const
     {
-        return params && num_track_slots > 0 && max_steps > 0;
+        return params && num_track_slots > 0 && max_steps > 0
+               && num_streams > 0;
     }
 };
 
@@ -110,6 +116,8 @@ struct TransporterResult
     VecCount initializers;  //!< Num starting track initializers
     VecCount active;  //!< Num tracks active at beginning of step
     VecCount alive;  //!< Num living tracks at end of step
+    VecCount backlog;  //!< Num initializers spilled to host at end of step
+    VecCount tail;  //!< Num tracks moved to a host stepper at end of step
     VecReal edep;  //!< Energy deposition along the grid
     MapStringCount process;  //!< Count of particle/process interactions
     MapStringVecCount steps;  //!< Distribution of steps
@@ -165,6 +173,13 @@ class TransporterBase
 //---------------------------------------------------------------------------//
 /*!
  * Transport a set of primaries to completion.
+ *
+ * With multiple streams, events are assigned to streams by event ID and
+ * each stream transports its events with a separate host stepper on an
+ * OpenMP thread. All streams share the same core params. The per-stream
+ * results are merged in stream order, so the output doesn't depend on the
+ * thread scheduling: step counters, diagnostic tallies, and action times
+ * are summed, and the time for each step is the maximum over streams.
  */
 template<celeritas::MemSpace M>
 class Transporter final : public TransporterBase
@@ -177,8 +192,17 @@ class Transporter final : public TransporterBase
     TransporterResult operator()(SpanConstPrimary primaries) final;
 
   private:
-    std::shared_ptr<DiagnosticStore> diagnostics_;
+    using SPDiagnostics = std::shared_ptr<DiagnosticStore>;
+    using StreamId = celeritas::StreamId;
+
+    std::vector<SPDiagnostics> diagnostics_;
     celeritas::ActionId diagnostic_action_;
+
+    // Transport primaries on a single stream
+    TransporterResult
+    transport_stream(StreamId stream,
+                     SpanConstPrimary primaries,
+                     celeritas::ScopedSignalHandler const& interrupted);
 };
 
 //---------------------------------------------------------------------------//
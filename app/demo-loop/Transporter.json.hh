@@ -28,6 +28,8 @@ inline void to_json(nlohmann::json& j, TransporterResult const& v)
     j = nlohmann::json{{"initializers", v.initializers},
                        {"active", v.active},
                        {"alive", v.alive},
+                       {"backlog", v.backlog},
+                       {"tail", v.tail},
                        {"edep", v.edep},
                        {"process", v.process},
                        {"steps", v.steps},
@@ -134,6 +134,9 @@ init_root_mctruth_output(LDemoArgs const& run_args,
         // return uninitialized root manager
         return root_manager;
     }
+    CELER_VALIDATE(run_args.num_streams == 1,
+                   << "ROOT MC truth output is not supported with multiple "
+                      "streams");
 
     CELER_LOG(info) << "Writing ROOT MC truth output at "
                     << run_args.mctruth_filename;
@@ -23,6 +23,8 @@ except ValueError:
 use_device = not strtobool(environ.get('CELER_DISABLE_DEVICE', 'false'))
 use_vecgeom = not strtobool(environ.get('CELER_DISABLE_VECGEOM', 'false'))
 geant_exp_exe = environ.get('CELER_EXPORT_GEANT_EXE', './celer-export-geant')
+# Compare track orderings using the action times in the output "time" block
+track_order = environ.get('CELER_TRACK_ORDER', 'unsorted')
 
 run_name = (path.splitext(path.basename(geometry_filename))[0]
             + ('-gpu' if use_device else '-cpu'))
@@ -77,6 +79,7 @@ inp = {
     'secondary_stack_factor': 3,
     'enable_diagnostics': True,
     'sync': True,
+    'track_order': track_order,
     'brem_combined': True,
     'geant_options': geant_options,
 }
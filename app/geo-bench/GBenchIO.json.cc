@@ -0,0 +1,138 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geo-bench/GBenchIO.json.cc
+//---------------------------------------------------------------------------//
+#include "GBenchIO.json.hh"
+
+#include <string>
+
+#include "corecel/cont/ArrayIO.json.hh"
+#include "corecel/cont/Range.hh"
+#include "orange/BoundingBoxIO.json.hh"
+
+using namespace celeritas;
+
+namespace geo_bench
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Get optional values from json.
+template<class T>
+void get_optional(nlohmann::json const& j, char const* key, T& value)
+{
+    if (j.contains(key))
+    {
+        j.at(key).get_to(value);
+    }
+}
+
+//---------------------------------------------------------------------------//
+//! Convert seconds per operation to nanoseconds, or null if no operations
+nlohmann::json to_ns_per_op(double time, size_type num_ops)
+{
+    if (num_ops == 0)
+    {
+        return nullptr;
+    }
+    return 1e9 * time / num_ops;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read options from JSON.
+ */
+void from_json(nlohmann::json const& j, GBenchInput& v)
+{
+    j.at("geometry_filename").get_to(v.geometry_filename);
+    j.at("num_tracks").get_to(v.num_tracks);
+    get_optional(j, "num_repetitions", v.num_repetitions);
+    get_optional(j, "max_steps", v.max_steps);
+    get_optional(j, "seed", v.seed);
+    get_optional(j, "find_safety", v.find_safety);
+    if (j.contains("bbox"))
+    {
+        auto arrays = j.at("bbox").get<Array<Real3, 2>>();
+        v.bbox = {arrays[0], arrays[1]};
+    }
+    get_optional(j, "direction", v.direction);
+
+    CELER_VALIDATE(v, << "invalid geo-bench input");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write options to JSON.
+ */
+void to_json(nlohmann::json& j, GBenchInput const& v)
+{
+    j = nlohmann::json{{"geometry_filename", v.geometry_filename},
+                       {"num_tracks", v.num_tracks},
+                       {"num_repetitions", v.num_repetitions},
+                       {"max_steps", v.max_steps},
+                       {"seed", v.seed},
+                       {"find_safety", v.find_safety},
+                       {"direction", v.direction}};
+    if (v.bbox)
+    {
+        j["bbox"] = v.bbox;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write timing for a single operation to JSON.
+ */
+void to_json(nlohmann::json& j, GBenchTiming const& v)
+{
+    j = nlohmann::json{{"num_ops", v.num_ops},
+                       {"time", v.time},
+                       {"ns_per_op", to_ns_per_op(v.time, v.num_ops)}};
+    if (!v.volume_ops.empty())
+    {
+        CELER_ASSERT(v.volume_ops.size() == v.volume_time.size());
+        auto ns_per_op = nlohmann::json::array();
+        for (auto i : range(v.volume_ops.size()))
+        {
+            ns_per_op.push_back(
+                to_ns_per_op(v.volume_time[i], v.volume_ops[i]));
+        }
+        j["volume_ops"] = v.volume_ops;
+        j["volume_ns_per_op"] = std::move(ns_per_op);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write benchmark results to JSON.
+ *
+ * Operations that were not run (e.g. on device when no GPU is available) are
+ * written as null.
+ */
+void to_json(nlohmann::json& j, GBenchResult const& v)
+{
+    auto ops_to_json = [](GBenchResult::OpTiming const& timing) {
+        auto result = nlohmann::json::object();
+        for (auto op : range(GeoOp::size_))
+        {
+            GBenchTiming const& t = timing[op];
+            result[to_cstring(op)] = (t.num_ops > 0 || t.time > 0)
+                                         ? nlohmann::json(t)
+                                         : nlohmann::json(nullptr);
+        }
+        return result;
+    };
+
+    j = nlohmann::json{{"volumes", v.volumes},
+                       {"host", ops_to_json(v.host)},
+                       {"device", ops_to_json(v.device)}};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace geo_bench
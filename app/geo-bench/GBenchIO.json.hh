@@ -0,0 +1,30 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geo-bench/GBenchIO.json.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include "GBenchRunner.hh"
+
+namespace geo_bench
+{
+//---------------------------------------------------------------------------//
+// Read options from JSON
+void from_json(nlohmann::json const& j, GBenchInput& value);
+
+// Write options to JSON
+void to_json(nlohmann::json& j, GBenchInput const& value);
+
+// Write timing for a single operation to JSON
+void to_json(nlohmann::json& j, GBenchTiming const& value);
+
+// Write benchmark results to JSON
+void to_json(nlohmann::json& j, GBenchResult const& value);
+
+//---------------------------------------------------------------------------//
+}  // namespace geo_bench
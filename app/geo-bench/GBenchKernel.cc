@@ -0,0 +1,32 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geo-bench/GBenchKernel.cc
+//---------------------------------------------------------------------------//
+#include "GBenchKernel.hh"
+
+#include "corecel/io/EnumStringMapper.hh"
+
+using namespace celeritas;
+
+namespace geo_bench
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get a string corresponding to a geometry operation.
+ */
+char const* to_cstring(GeoOp value)
+{
+    static EnumStringMapper<GeoOp> const to_cstring_impl{
+        "initialize",
+        "find_safety",
+        "find_next_step",
+        "cross_boundary",
+    };
+    return to_cstring_impl(value);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace geo_bench
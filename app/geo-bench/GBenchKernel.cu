@@ -0,0 +1,59 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geo-bench/GBenchKernel.cu
+//---------------------------------------------------------------------------//
+#include "GBenchKernel.hh"
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/KernelParamCalculator.device.hh"
+
+using namespace celeritas;
+
+namespace geo_bench
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+
+__global__ void gbench_kernel(GBenchLauncher<MemSpace::device> const launch,
+                              size_type num_tracks)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < num_tracks))
+        return;
+
+    launch(TrackSlotId{tid.unchecked_get()});
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+// KERNEL INTERFACE
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the operation on all tracks on device and wait for completion.
+ */
+void run_device(GBenchLauncher<MemSpace::device> const& launch,
+                size_type num_tracks)
+{
+    CELER_EXPECT(launch.params && launch.states);
+    CELER_EXPECT(num_tracks <= launch.states.size());
+
+    CELER_LAUNCH_KERNEL(gbench,
+                        celeritas::device().default_block_size(),
+                        num_tracks,
+                        launch,
+                        num_tracks);
+    CELER_DEVICE_CALL_PREFIX(DeviceSynchronize());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace geo_bench
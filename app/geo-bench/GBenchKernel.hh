@@ -0,0 +1,136 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geo-bench/GBenchKernel.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "orange/Types.hh"
+#include "celeritas/geo/GeoData.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+
+namespace geo_bench
+{
+//---------------------------------------------------------------------------//
+using celeritas::GeoTrackInitializer;
+using celeritas::MemSpace;
+using celeritas::Ownership;
+using celeritas::real_type;
+using celeritas::size_type;
+using celeritas::TrackSlotId;
+
+//---------------------------------------------------------------------------//
+//! Geometry operation being timed
+enum class GeoOp
+{
+    initialize,  //!< Locate a point and direction
+    find_safety,  //!< Find the isotropic distance to the nearest boundary
+    find_next_step,  //!< Find the distance to the next boundary
+    cross_boundary,  //!< Find, move to, and cross the next boundary
+    size_
+};
+
+// Get a string corresponding to a geometry operation
+char const* to_cstring(GeoOp);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a single geometry operation to a track.
+ *
+ * The result of the operation (the safety distance or step length) is written
+ * to the result array so that the work can't be optimized out; tracks for
+ * which the operation doesn't apply (e.g. outside the geometry) are assigned
+ * a negative result.
+ */
+template<MemSpace M>
+struct GBenchLauncher
+{
+    //!@{
+    //! \name Type aliases
+    using ParamsRef = celeritas::GeoParamsData<Ownership::const_reference, M>;
+    using StateRef = celeritas::GeoStateData<Ownership::reference, M>;
+    //!@}
+
+    ParamsRef params;
+    StateRef states;
+    GeoTrackInitializer const* init{nullptr};
+    real_type* result{nullptr};
+    GeoOp op{GeoOp::size_};
+
+    // Apply the operation to a single track
+    inline CELER_FUNCTION void operator()(TrackSlotId tid) const;
+};
+
+//---------------------------------------------------------------------------//
+// Launch the operation on all tracks on device
+void run_device(GBenchLauncher<MemSpace::device> const& launch,
+                size_type num_tracks);
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the operation to a single track.
+ */
+template<MemSpace M>
+CELER_FUNCTION void GBenchLauncher<M>::operator()(TrackSlotId tid) const
+{
+    CELER_EXPECT(tid < states.size());
+
+    celeritas::GeoTrackView geo(params, states, tid);
+    real_type& dist = result[tid.unchecked_get()];
+    if (op == GeoOp::initialize)
+    {
+        geo = init[tid.unchecked_get()];
+        dist = geo.is_outside() ? -1 : 0;
+        return;
+    }
+
+    dist = -1;
+    if (geo.is_outside())
+    {
+        return;
+    }
+
+    switch (op)
+    {
+        case GeoOp::find_safety:
+            if (!geo.is_on_boundary())
+            {
+                dist = geo.find_safety();
+            }
+            break;
+        case GeoOp::find_next_step:
+            dist = geo.find_next_step().distance;
+            break;
+        case GeoOp::cross_boundary: {
+            auto next = geo.find_next_step();
+            if (next.boundary)
+            {
+                geo.move_to_boundary();
+                geo.cross_boundary();
+                dist = next.distance;
+            }
+            break;
+        }
+        default:
+            CELER_ASSERT_UNREACHABLE();
+    }
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+inline void run_device(GBenchLauncher<MemSpace::device> const&, size_type)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace geo_bench
@@ -0,0 +1,293 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geo-bench/GBenchRunner.cc
+//---------------------------------------------------------------------------//
+#include "GBenchRunner.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "corecel/data/DeviceVector.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/random/distribution/IsotropicDistribution.hh"
+#include "celeritas/random/distribution/UniformBoxDistribution.hh"
+
+using namespace celeritas;
+
+namespace geo_bench
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+using HostLauncher = GBenchLauncher<MemSpace::host>;
+using VecTracks = std::vector<TrackSlotId>;
+
+//! Operations that don't change the track state
+constexpr GeoOp stationary_ops[]
+    = {GeoOp::initialize, GeoOp::find_safety, GeoOp::find_next_step};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Group the tracks that are inside the geometry by their current volume.
+ */
+std::vector<VecTracks>
+group_by_volume(HostLauncher const& launch, size_type num_volumes)
+{
+    std::vector<VecTracks> result(num_volumes);
+    for (auto tid : range(TrackSlotId{launch.states.size()}))
+    {
+        GeoTrackView geo(launch.params, launch.states, tid);
+        if (!geo.is_outside())
+        {
+            CELER_ASSERT(geo.volume_id() < num_volumes);
+            result[geo.volume_id().get()].push_back(tid);
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time the launcher's operation separately for each volume.
+ *
+ * The operation is applied to all tracks in a volume before moving on to the
+ * next, which is the best case for branching and caching. The return value is
+ * the number of tracks the operation was applied to.
+ */
+size_type time_by_volume(HostLauncher const& launch,
+                         size_type num_repetitions,
+                         GBenchTiming* timing)
+{
+    auto const groups = group_by_volume(launch, timing->volume_ops.size());
+
+    size_type num_tracks = 0;
+    for (auto vol : range(groups.size()))
+    {
+        VecTracks const& tracks = groups[vol];
+        if (tracks.empty())
+        {
+            continue;
+        }
+
+        Stopwatch get_time;
+        for (size_type rep = 0; rep < num_repetitions; ++rep)
+        {
+            for (TrackSlotId tid : tracks)
+            {
+                launch(tid);
+            }
+        }
+        double const time = get_time();
+
+        size_type const num_ops = num_repetitions * tracks.size();
+        timing->volume_ops[vol] += num_ops;
+        timing->volume_time[vol] += time;
+        timing->num_ops += num_ops;
+        timing->time += time;
+        num_tracks += tracks.size();
+    }
+    return num_tracks;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with geometry and options, sampling the track initializers.
+ */
+GBenchRunner::GBenchRunner(SPConstGeo geo, GBenchInput const& input)
+    : geo_(std::move(geo)), input_(input)
+{
+    CELER_EXPECT(geo_);
+    CELER_EXPECT(input_);
+
+    if (input_.find_safety && !geo_->supports_safety())
+    {
+        CELER_LOG(warning) << "Geometry does not support safety: "
+                              "skipping find_safety timing";
+        input_.find_safety = false;
+    }
+
+    BoundingBox const& bbox = input_.bbox ? input_.bbox : geo_->bbox();
+    CELER_VALIDATE(bbox, << "geometry has no bounding box: specify 'bbox'");
+    for (auto ax : range(3))
+    {
+        CELER_VALIDATE(std::isfinite(bbox.lower()[ax])
+                           && std::isfinite(bbox.upper()[ax]),
+                       << "cannot sample track origins in an infinite "
+                          "bounding box: specify 'bbox'");
+    }
+
+    bool const isotropic = (input_.direction == Real3{0, 0, 0});
+    if (!isotropic)
+    {
+        normalize_direction(&input_.direction);
+    }
+
+    std::mt19937 rng(input_.seed);
+    UniformBoxDistribution<> sample_pos(bbox.lower(), bbox.upper());
+    IsotropicDistribution<> sample_dir;
+    inits_.resize(input_.num_tracks);
+    for (GeoTrackInitializer& init : inits_)
+    {
+        init.pos = sample_pos(rng);
+        init.dir = isotropic ? sample_dir(rng) : input_.direction;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Run on host and (if available) device.
+ */
+GBenchResult GBenchRunner::operator()() const
+{
+    GBenchResult result;
+    for (auto vol_id : range(VolumeId{geo_->num_volumes()}))
+    {
+        result.volumes.push_back(to_string(geo_->id_to_label(vol_id)));
+    }
+
+    CELER_LOG(status) << "Timing geometry navigation on host";
+    this->time_host(&result.host);
+
+    if (celeritas::device())
+    {
+        CELER_LOG(status) << "Timing geometry navigation on device";
+        this->time_device(&result.device);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time each operation on host, grouping tracks by volume.
+ */
+void GBenchRunner::time_host(GBenchResult::OpTiming* result) const
+{
+    using StateStore = CollectionStateStore<GeoStateData, MemSpace::host>;
+
+    size_type const num_tracks = inits_.size();
+    StateStore states(geo_->host_ref(), num_tracks);
+    std::vector<real_type> temp(num_tracks);
+
+    HostLauncher launch;
+    launch.params = geo_->host_ref();
+    launch.states = states.ref();
+    launch.init = inits_.data();
+    launch.result = temp.data();
+
+    for (GBenchTiming& timing : *result)
+    {
+        timing.volume_ops.assign(geo_->num_volumes(), 0);
+        timing.volume_time.assign(geo_->num_volumes(), 0.0);
+    }
+
+    // Initialize once to find the starting volumes
+    launch.op = GeoOp::initialize;
+    for (auto tid : range(TrackSlotId{num_tracks}))
+    {
+        launch(tid);
+    }
+
+    for (GeoOp op : stationary_ops)
+    {
+        if (op == GeoOp::find_safety && !input_.find_safety)
+        {
+            continue;
+        }
+        launch.op = op;
+        time_by_volume(launch, input_.num_repetitions, &(*result)[op]);
+    }
+
+    launch.op = GeoOp::cross_boundary;
+    for (size_type step = 0; step < input_.max_steps; ++step)
+    {
+        if (time_by_volume(launch, 1, &(*result)[GeoOp::cross_boundary]) == 0)
+        {
+            break;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time each operation on device.
+ *
+ * The number of operations is the number of tracks that the operation applied
+ * to, which requires copying the results back to host after each launch.
+ */
+void GBenchRunner::time_device(GBenchResult::OpTiming* result) const
+{
+    using StateStore = CollectionStateStore<GeoStateData, MemSpace::device>;
+
+    size_type const num_tracks = inits_.size();
+    StateStore states(geo_->host_ref(), num_tracks);
+    DeviceVector<GeoTrackInitializer> inits(num_tracks);
+    inits.copy_to_device(make_span(inits_));
+    DeviceVector<real_type> temp(num_tracks);
+    std::vector<real_type> host_temp(num_tracks);
+
+    GBenchLauncher<MemSpace::device> launch;
+    launch.params = geo_->device_ref();
+    launch.states = states.ref();
+    launch.init = inits.data();
+    launch.result = temp.data();
+
+    auto time_op = [&](GeoOp op, size_type num_repetitions) {
+        launch.op = op;
+        Stopwatch get_time;
+        for (size_type rep = 0; rep < num_repetitions; ++rep)
+        {
+            run_device(launch, num_tracks);
+        }
+        double const time = get_time();
+
+        temp.copy_to_host(make_span(host_temp));
+        auto const num_active = static_cast<size_type>(std::count_if(
+            host_temp.begin(), host_temp.end(), [](real_type r) {
+                return r >= 0;
+            }));
+
+        GBenchTiming& timing = (*result)[op];
+        timing.num_ops += num_repetitions * num_active;
+        timing.time += time;
+        return num_active;
+    };
+
+    // Initialize once to warm up
+    launch.op = GeoOp::initialize;
+    run_device(launch, num_tracks);
+
+    for (GeoOp op : stationary_ops)
+    {
+        if (op == GeoOp::find_safety && !input_.find_safety)
+        {
+            continue;
+        }
+        time_op(op, input_.num_repetitions);
+    }
+
+    for (size_type step = 0; step < input_.max_steps; ++step)
+    {
+        if (time_op(GeoOp::cross_boundary, 1) == 0)
+        {
+            break;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace geo_bench
@@ -0,0 +1,114 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geo-bench/GBenchRunner.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/cont/EnumArray.hh"
+#include "orange/BoundingBox.hh"
+#include "celeritas/geo/GeoParamsFwd.hh"
+
+#include "GBenchKernel.hh"
+
+namespace geo_bench
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Benchmark options.
+ *
+ * Track origins are sampled uniformly in the given bounding box, which
+ * defaults to the bounding box of the world. Directions are sampled
+ * isotropically unless a fixed direction is given.
+ */
+struct GBenchInput
+{
+    std::string geometry_filename;
+    size_type num_tracks{0};
+    size_type num_repetitions{1};  //!< Repeat stationary operations
+    size_type max_steps{1000};  //!< Maximum number of boundary crossings
+    unsigned int seed{0};
+    bool find_safety{true};  //!< Time safety (if supported)
+    celeritas::BoundingBox bbox;  //!< Sampling box (default: world)
+    celeritas::Real3 direction{0, 0, 0};  //!< Fixed direction (default: iso)
+
+    //! Whether the input is valid
+    explicit operator bool() const
+    {
+        return !geometry_filename.empty() && num_tracks > 0
+               && num_repetitions > 0 && max_steps > 0;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulated timing for a single geometry operation.
+ *
+ * Per-volume counts are indexed by the volume that the track is in when the
+ * operation starts, and they are empty if not recorded.
+ */
+struct GBenchTiming
+{
+    size_type num_ops{0};
+    double time{0};  //!< [s]
+    std::vector<size_type> volume_ops;
+    std::vector<double> volume_time;  //!< [s]
+};
+
+//---------------------------------------------------------------------------//
+//! Timing results for all operations on host and device
+struct GBenchResult
+{
+    using OpTiming = celeritas::EnumArray<GeoOp, GBenchTiming>;
+
+    std::vector<std::string> volumes;
+    OpTiming host;
+    OpTiming device;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time geometry navigation operations on a set of random rays.
+ *
+ * On host, tracks are grouped by their current volume before each operation
+ * so that the time per operation can be reported for each volume. On device,
+ * only the aggregate time for each kernel launch is available.
+ *
+ * The stationary operations (initialization, safety, and next-step distance)
+ * are repeated on the same track states to reduce timer noise; boundary
+ * crossing is applied until all tracks have left the world or the step limit
+ * is reached.
+ */
+class GBenchRunner
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstGeo = std::shared_ptr<celeritas::GeoParams const>;
+    //!@}
+
+  public:
+    // Construct with geometry and options
+    GBenchRunner(SPConstGeo geo, GBenchInput const& input);
+
+    // Run on host and (if available) device
+    GBenchResult operator()() const;
+
+  private:
+    SPConstGeo geo_;
+    GBenchInput input_;
+    std::vector<GeoTrackInitializer> inits_;
+
+    void time_host(GBenchResult::OpTiming* result) const;
+    void time_device(GBenchResult::OpTiming* result) const;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace geo_bench
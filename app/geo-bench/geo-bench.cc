@@ -0,0 +1,152 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geo-bench/geo-bench.cc
+//---------------------------------------------------------------------------//
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Assert.hh"
+#include "corecel/io/BuildOutput.hh"
+#include "corecel/io/ExceptionOutput.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/io/OutputInterface.hh"
+#include "corecel/io/OutputInterfaceAdapter.hh"
+#include "corecel/io/OutputRegistry.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/DeviceIO.json.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/ScopedMpiInit.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "celeritas/geo/GeoParams.hh"
+
+#include "GBenchIO.json.hh"
+#include "GBenchRunner.hh"
+
+using namespace celeritas;
+using std::cout;
+using std::endl;
+
+namespace geo_bench
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Run, launch, and output.
+ */
+void run(std::istream* is, std::shared_ptr<OutputRegistry> output)
+{
+    // Read input options
+    auto inp = nlohmann::json::parse(*is);
+    if (inp.contains("cuda_stack_size"))
+    {
+        set_cuda_stack_size(inp.at("cuda_stack_size").get<int>());
+    }
+
+    auto run_args = inp.get<GBenchInput>();
+    output->insert(OutputInterfaceAdapter<GBenchInput>::from_rvalue_ref(
+        OutputInterface::Category::input, "*", GBenchInput{run_args}));
+
+    // Load geometry
+    Stopwatch get_setup_time;
+    auto geo = std::make_shared<GeoParams>(run_args.geometry_filename);
+    CELER_LOG(info) << "Loaded geometry in " << get_setup_time() << " s";
+
+    // Sample tracks and time geometry operations
+    GBenchRunner run_bench(std::move(geo), run_args);
+    output->insert(OutputInterfaceAdapter<GBenchResult>::from_rvalue_ref(
+        OutputInterface::Category::result, "*", run_bench()));
+}
+//---------------------------------------------------------------------------//
+}  // namespace
+}  // namespace geo_bench
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute and run.
+ */
+int main(int argc, char* argv[])
+{
+    ScopedMpiInit scoped_mpi(&argc, &argv);
+
+    MpiCommunicator comm = [] {
+        if (ScopedMpiInit::status() == ScopedMpiInit::Status::disabled)
+            return MpiCommunicator{};
+
+        return MpiCommunicator::comm_world();
+    }();
+
+    if (comm.size() > 1)
+    {
+        CELER_LOG(critical) << "This app cannot run in parallel";
+        return EXIT_FAILURE;
+    }
+
+    // Process input arguments
+    std::vector<std::string> args(argv, argv + argc);
+    if (args.size() != 2 || args[1] == "--help" || args[1] == "-h")
+    {
+        std::cerr << "usage: " << args[0] << " {input}.json" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Initialize GPU
+    celeritas::activate_device(celeritas::make_device(comm));
+
+    std::string filename = args[1];
+    std::ifstream infile;
+    std::istream* instream = nullptr;
+    if (filename == "-")
+    {
+        instream = &std::cin;
+        filename = "<stdin>";  // For nicer output on failure
+    }
+    else
+    {
+        // Open the specified file
+        infile.open(filename);
+        if (!infile)
+        {
+            CELER_LOG(critical) << "Failed to open '" << filename << "'";
+            return EXIT_FAILURE;
+        }
+        instream = &infile;
+    }
+
+    // Set up output
+    auto output = std::make_shared<OutputRegistry>();
+    output->insert(OutputInterfaceAdapter<Device>::from_const_ref(
+        OutputInterface::Category::system, "device", celeritas::device()));
+    output->insert(std::make_shared<BuildOutput>());
+
+    int return_code = EXIT_SUCCESS;
+    try
+    {
+        geo_bench::run(instream, output);
+    }
+    catch (std::exception const& e)
+    {
+        CELER_LOG(critical)
+            << "While running input at " << filename << ": " << e.what();
+        return_code = EXIT_FAILURE;
+        output->insert(
+            std::make_shared<ExceptionOutput>(std::current_exception()));
+    }
+
+    // Write system properties and (if available) results
+    CELER_LOG(status) << "Saving output";
+    output->output(&cout);
+    cout << endl;
+
+    return return_code;
+}
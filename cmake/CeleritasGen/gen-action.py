@@ -35,7 +35,9 @@ namespace celeritas
 namespace generated
 {{
 //---------------------------------------------------------------------------//
-class {clsname} final : public ExplicitActionInterface, public ConcreteAction
+class {clsname} final : public ExplicitActionInterface,
+                         public FusibleActionInterface,
+                         public ConcreteAction
 {{
 public:
   // Construct with ID and label
@@ -44,6 +46,11 @@ public:
   // Launch kernel with host data
   void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+  // Execute on a chunk of threads with host data
+  void execute_chunk(ParamsHostCRef const&,
+                     StateHostRef&,
+                     Range<ThreadId> chunk) const final;
+
   // Launch kernel with device data
   void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
@@ -66,10 +73,12 @@ inline void {clsname}::execute(ParamsDeviceCRef const&, StateDeviceRef&) const
 CC_TEMPLATE = CLIKE_TOP + """\
 #include "{clsname}.hh"
 
+#include <exception>
 #include <utility>
 
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/global/KernelContextException.hh"
@@ -86,17 +95,38 @@ void {clsname}::execute(ParamsHostCRef const& params, StateHostRef& state) const
 
     MultiExceptionHandler capture_exception;
     auto launch = make_track_launcher(params, state, detail::{func}_track);
+    auto const threads = {thread_range};
     #pragma omp parallel for
-    for (size_type i = 0; i < state.size(); ++i)
+    for (size_type i = 0; i < threads.size(); ++i)
     {{
+        ThreadId const tid = threads[i];
         CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{{i}}),
+            launch(tid),
             capture_exception,
-            KernelContextException(params, state, ThreadId{{i}}, this->label()));
+            KernelContextException(params, state, tid, this->label()));
     }}
     log_and_rethrow(std::move(capture_exception));
 }}
 
+void {clsname}::execute_chunk(ParamsHostCRef const& params,
+                              StateHostRef& state,
+                              Range<ThreadId> chunk) const
+{{
+    auto launch = make_track_launcher(params, state, detail::{func}_track);
+    for (ThreadId tid : {chunk_range})
+    {{
+        try
+        {{
+            launch(tid);
+        }}
+        catch (...)
+        {{
+            std::throw_with_nested(
+                KernelContextException(params, state, tid, this->label()));
+        }}
+    }}
+}}
+
 }}  // namespace generated
 }}  // namespace celeritas
 """
@@ -107,6 +137,7 @@ CU_TEMPLATE = CLIKE_TOP + """\
 #include "corecel/device_runtime_api.h"
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/KernelParamCalculator.device.hh"
 #include "corecel/sys/Device.hh"
 #include "celeritas/global/TrackLauncher.hh"
@@ -120,26 +151,32 @@ namespace
 {{
 __global__ void{launch_bounds}{func}_kernel(
     DeviceCRef<CoreParamsData> const params,
-    DeviceRef<CoreStateData> const state
+    DeviceRef<CoreStateData> const state,
+    Range<ThreadId> const threads
 )
 {{
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < state.size()))
+    if (!(tid < threads.size()))
         return;
 
     auto launch = make_track_launcher(params, state, detail::{func}_track);
-    launch(tid);
+    launch(threads[tid.get()]);
 }}
 }}  // namespace
 
 void {clsname}::execute(ParamsDeviceCRef const& params, StateDeviceRef& state) const
 {{
     CELER_EXPECT(params && state);
+    auto const threads = {thread_range};
+    if (threads.empty())
+        return;
+
     CELER_LAUNCH_KERNEL({func},
                         celeritas::device().default_block_size(),
-                        state.size(),
+                        threads.size(),
                         params,
-                        state);
+                        state,
+                        threads);
 }}
 
 }}  // namespace generated
@@ -166,6 +203,14 @@ def generate(**subs):
     subs['filename'] = Path(subs['basedir']) / filename
     subs['script'] = script.name
     subs['launch_bounds'] = make_launch_bounds(subs['func'])
+    if subs['actionorder'] == 'post':
+        # Post-step actions only apply to tracks with a matching action
+        subs['thread_range'] = "action_thread_range(state, this->action_id())"
+        subs['chunk_range'] = (
+            "action_thread_range(state, this->action_id(), chunk)")
+    else:
+        subs['thread_range'] = "range(ThreadId{state.num_threads})"
+        subs['chunk_range'] = "chunk"
     with open(filename, 'w') as f:
         f.write(template.format(**subs))
 
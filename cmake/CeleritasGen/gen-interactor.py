@@ -32,6 +32,8 @@ HH_TEMPLATE = CLIKE_TOP + """\
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/sys/ThreadId.hh"
 #include "celeritas/{dir}/data/{class}Data.hh" // IWYU pragma: associated
 #include "celeritas/global/CoreTrackDataFwd.hh"
 
@@ -44,6 +46,12 @@ void {func}_interact(
     celeritas::HostCRef<celeritas::CoreParamsData> const&,
     celeritas::HostRef<celeritas::CoreStateData>&);
 
+void {func}_interact(
+    {namespace}::{class}HostRef const&,
+    celeritas::HostCRef<celeritas::CoreParamsData> const&,
+    celeritas::HostRef<celeritas::CoreStateData>&,
+    celeritas::Range<celeritas::ThreadId> chunk);
+
 void {func}_interact(
     {namespace}::{class}DeviceRef const&,
     celeritas::DeviceCRef<celeritas::CoreParamsData> const&,
@@ -66,10 +74,12 @@ inline void {func}_interact(
 CC_TEMPLATE = CLIKE_TOP + """\
 #include "{class}Interact.hh"
 
+#include <exception>
 #include <utility>
 
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/global/KernelContextException.hh"
@@ -94,17 +104,44 @@ void {func}_interact(
     auto launch = celeritas::make_interaction_launcher(
         params, state, model_data,
         {namespace}::{func}_interact_track);
+    auto const threads
+        = celeritas::action_thread_range(state, model_data.ids.action);
     #pragma omp parallel for
-    for (celeritas::size_type i = 0; i < state.size(); ++i)
+    for (celeritas::size_type i = 0; i < threads.size(); ++i)
     {{
+        ThreadId const tid = threads[i];
         CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{{i}}),
+            launch(tid),
             capture_exception,
-            KernelContextException(params, state, ThreadId{{i}}, "{func}"));
+            KernelContextException(params, state, tid, "{func}"));
     }}
     log_and_rethrow(std::move(capture_exception));
 }}
 
+void {func}_interact(
+    {namespace}::{class}HostRef const& model_data,
+    celeritas::HostCRef<celeritas::CoreParamsData> const& params,
+    celeritas::HostRef<celeritas::CoreStateData>& state,
+    celeritas::Range<celeritas::ThreadId> chunk)
+{{
+    auto launch = celeritas::make_interaction_launcher(
+        params, state, model_data,
+        {namespace}::{func}_interact_track);
+    for (ThreadId tid :
+         celeritas::action_thread_range(state, model_data.ids.action, chunk))
+    {{
+        try
+        {{
+            launch(tid);
+        }}
+        catch (...)
+        {{
+            std::throw_with_nested(
+                KernelContextException(params, state, tid, "{func}"));
+        }}
+    }}
+}}
+
 }}  // namespace generated
 }}  // namespace {namespace}
 """
@@ -115,6 +152,7 @@ CU_TEMPLATE = CLIKE_TOP + """\
 #include "corecel/device_runtime_api.h"
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/KernelParamCalculator.device.hh"
 #include "corecel/sys/Device.hh"
 #include "celeritas/{dir}/launcher/{class}Launcher.hh"
@@ -129,16 +167,17 @@ namespace
 __global__ void{launch_bounds}{func}_interact_kernel(
     {namespace}::{class}DeviceRef const model_data,
     celeritas::DeviceCRef<celeritas::CoreParamsData> const params,
-    celeritas::DeviceRef<celeritas::CoreStateData> const state)
+    celeritas::DeviceRef<celeritas::CoreStateData> const state,
+    celeritas::Range<celeritas::ThreadId> const threads)
 {{
     auto tid = celeritas::KernelParamCalculator::thread_id();
-    if (!(tid < state.size()))
+    if (!(tid < threads.size()))
         return;
 
     auto launch = celeritas::make_interaction_launcher(
         params, state, model_data,
         {namespace}::{func}_interact_track);
-    launch(tid);
+    launch(threads[tid.get()]);
 }}
 }}  // namespace
 
@@ -150,10 +189,15 @@ void {func}_interact(
     CELER_EXPECT(params && state);
     CELER_EXPECT(model_data);
 
+    auto const threads
+        = celeritas::action_thread_range(state, model_data.ids.action);
+    if (threads.empty())
+        return;
+
     CELER_LAUNCH_KERNEL({func}_interact,
                         celeritas::device().default_block_size(),
-                        state.size(),
-                        model_data, params, state);
+                        threads.size(),
+                        model_data, params, state, threads);
 }}
 
 }}  // namespace generated
@@ -194,6 +194,14 @@ LANG = {
 }
 
 DEFS = {
+    "ExtractTracks": KernelDefinition(
+        Function("extract_tracks", ParamList([
+            Param("{Memspace}CRef<CoreParamsData>", "core_params"),
+            Param("{Memspace}Ref<CoreStateData>", "core_states"),
+            Param("Span<TrackInitializer>", "initializers"),
+        ])),
+        "core_states.size()",
+        ["corecel/cont/Span.hh", "celeritas/track/TrackInitData.hh"]),
     "InitTracks": KernelDefinition(
         Function("init_tracks", ParamList([
             Param("{Memspace}CRef<CoreParamsData>", "core_params"),
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "LocalTransporter.hh"
 
+#include <cmath>
 #include <csignal>
 #include <type_traits>
 #include <CLHEP/Units/SystemOfUnits.h>
@@ -37,14 +38,28 @@ LocalTransporter::LocalTransporter(SetupOptions const& options,
                                    SharedParams const& params)
     : auto_flush_(options.max_num_tracks)
     , max_steps_(options.max_steps)
+    , max_concurrent_events_(options.max_concurrent_events)
     , hit_manager_{params.hit_manager()}
 {
     CELER_VALIDATE(params,
                    << "Celeritas SharedParams was not initialized before "
                       "constructing LocalTransporter (perhaps the master "
                       "thread did not call BeginOfRunAction?");
+    CELER_VALIDATE(options.max_concurrent_events > 0,
+                   << "invalid max_concurrent_events="
+                   << options.max_concurrent_events);
     particles_ = params.Params()->particle();
 
+    if (hit_manager_.value() && max_concurrent_events_ > 1)
+    {
+        // Hits must be sent to the detectors during their own Geant4 event
+        CELER_LOG_LOCAL(warning)
+            << "Ignoring max_concurrent_events=" << max_concurrent_events_
+            << ": events with sensitive detectors are transported one at a "
+               "time";
+        max_concurrent_events_ = 1;
+    }
+
     // Thread ID is -1 when running serially
     auto thread_id = G4Threading::IsMultithreadedApplication() ? G4Threading::G4GetThreadId() : 0;
     CELER_VALIDATE(thread_id >= 0,
@@ -62,6 +77,23 @@ LocalTransporter::LocalTransporter(SetupOptions const& options,
     inp.stream_id = StreamId{static_cast<size_type>(thread_id)};
     inp.num_track_slots = options.max_num_tracks;
     inp.sync = options.sync;
+    inp.min_active_fraction = options.min_active_fraction;
+    inp.diagnostics = options.step_diagnostics;
+    inp.max_diagnostic_samples = options.max_step_diagnostic_samples;
+
+    if (inp.min_active_fraction > 0)
+    {
+        // Create a small host stepper to finish the last few tracks, with
+        // random number streams that differ from the main stepper's
+        StepperInput tail_inp = inp;
+        tail_inp.num_track_slots = static_cast<size_type>(
+            std::ceil(inp.min_active_fraction * inp.num_track_slots));
+        tail_inp.min_active_fraction = 0;
+        tail_inp.diagnostics = false;
+        tail_inp.rng_substream = 1;
+        tail_step_ = std::make_shared<Stepper<MemSpace::host>>(
+            std::move(tail_inp));
+    }
 
     if (celeritas::device())
     {
@@ -76,13 +108,25 @@ LocalTransporter::LocalTransporter(SetupOptions const& options,
 //---------------------------------------------------------------------------//
 /*!
  * Set the event ID at the start of an event.
+ *
+ * The optional callback is called with the event ID once all of the event's
+ * offloaded tracks have been transported.
  */
-void LocalTransporter::SetEventId(int id)
+void LocalTransporter::SetEventId(int id, EventCallback done)
 {
     CELER_EXPECT(*this);
     CELER_EXPECT(id >= 0);
+
+    if (!pending_.empty() && !pending_.back().flushed)
+    {
+        // Previous event was never flushed
+        this->inject_buffer();
+        pending_.back().flushed = true;
+    }
+
     event_id_ = EventId(id);
     track_counter_ = 0;
+    pending_.push_back({event_id_, std::move(done)});
 }
 
 //---------------------------------------------------------------------------//
@@ -124,17 +168,65 @@ void LocalTransporter::Push(G4Track const& g4track)
     {
         // TODO: maybe only run one iteration? But then make sure that Flush
         // still transports active tracks to completion.
-        this->Flush();
+        this->inject_buffer();
+        this->transport(max_concurrent_events_ - 1);
     }
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Transport the buffered tracks and all secondaries produced.
+ * Transport the buffered tracks at the end of an event.
+ *
+ * If more than \c max_concurrent_events have unfinished tracks, including
+ * this one, the stepper is run until enough of them complete. By default this
+ * transports all tracks to completion.
  */
 void LocalTransporter::Flush()
 {
     CELER_EXPECT(*this);
+
+    if (!pending_.empty() && pending_.back().id == event_id_)
+    {
+        pending_.back().flushed = true;
+    }
+    this->inject_buffer();
+    this->transport(max_concurrent_events_ - 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Clear local data.
+ *
+ * This may need to be executed on the same thread it was created in order to
+ * safely deallocate some Geant4 objects under the hood...
+ */
+void LocalTransporter::Finalize()
+{
+    CELER_EXPECT(*this);
+    CELER_VALIDATE(buffer_.empty(),
+                   << "some offloaded tracks were not flushed");
+
+    // Complete any events still in flight
+    for (PendingEvent& event : pending_)
+    {
+        event.flushed = true;
+    }
+    this->transport(0);
+    CELER_ASSERT(pending_.empty());
+
+    // Reset all data
+    CELER_LOG_LOCAL(debug) << "Resetting local transporter";
+    *this = {};
+
+    CELER_ENSURE(!*this);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy buffered tracks to the stepper and transport the first step.
+ */
+void LocalTransporter::inject_buffer()
+{
     if (buffer_.empty())
     {
         return;
@@ -144,47 +236,143 @@ void LocalTransporter::Flush()
         << "Transporting " << buffer_.size() << " tracks from event "
         << event_id_.unchecked_get() << " with Celeritas";
 
+    track_counts_ = (*step_)(make_span(buffer_));
+    buffer_.clear();
+
+    if (track_counts_.tail > 0)
+    {
+        this->transport_tail();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Step until no more than the given number of events have unfinished tracks.
+ */
+void LocalTransporter::transport(size_type max_in_flight)
+{
     // Abort cleanly for interrupt and user-defined signals
     ScopedSignalHandler interrupted{SIGINT, SIGUSR2};
 
-    // Copy buffered tracks to device and transport the first step
-    auto track_counts = (*step_)(make_span(buffer_));
-    buffer_.clear();
-
     size_type step_iters = 1;
 
-    while (track_counts)
+    while (track_counts_)
     {
+        if (max_in_flight > 0 && this->complete_events() <= max_in_flight)
+        {
+            return;
+        }
+
         CELER_VALIDATE(step_iters < max_steps_,
                        << "number of step iterations exceeded the allowed "
                           "maximum ("
                        << max_steps_ << ")");
 
-        track_counts = (*step_)();
+        track_counts_ = (*step_)();
         ++step_iters;
 
+        if (track_counts_.tail > 0)
+        {
+            this->transport_tail();
+        }
+
         CELER_VALIDATE(!interrupted(), << "caught interrupt signal");
     }
+    this->complete_events();
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Clear local data.
+ * Finish the tracks removed from the stepper by the tail policy on the host.
  *
- * This may need to be executed on the same thread it was created in order to
- * safely deallocate some Geant4 objects under the hood...
+ * Once fewer than \c min_active_fraction of the track slots are occupied and
+ * no more tracks are queued, launching kernels for the few remaining tracks is
+ * wasteful, so they are transported to completion on the host instead. The
+ * tracks keep their IDs, and the track counters of the two steppers are
+ * synchronized so that secondaries in either one get unique IDs.
  */
-void LocalTransporter::Finalize()
+void LocalTransporter::transport_tail()
 {
-    CELER_EXPECT(*this);
-    CELER_VALIDATE(buffer_.empty(),
-                   << "some offloaded tracks were not flushed");
+    CELER_EXPECT(tail_step_);
 
-    // Reset all data
-    CELER_LOG_LOCAL(debug) << "Resetting local transporter";
-    *this = {};
+    auto tail = step_->release_tail();
+    CELER_ASSERT(!tail.tracks.empty());
+    CELER_LOG_LOCAL(debug) << "Transporting " << tail.tracks.size()
+                           << " remaining tracks on host";
+    tail_step_->insert_tail(tail);
 
-    CELER_ENSURE(!*this);
+    size_type step_iters = 1;
+    auto counts = (*tail_step_)();
+    while (counts)
+    {
+        CELER_VALIDATE(step_iters < max_steps_,
+                       << "number of step iterations exceeded the allowed "
+                          "maximum ("
+                       << max_steps_ << ")");
+        counts = (*tail_step_)();
+        ++step_iters;
+    }
+
+    // Update the main stepper's counters for the secondaries created here
+    step_->insert_tail(tail_step_->release_tail());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Call back and remove flushed events with no remaining tracks.
+ *
+ * The buffered hits of each completed event are sent to the sensitive
+ * detectors before the event's callback.
+ *
+ * The result is the number of events that still have tracks in flight.
+ * Events can't be completed while some of the track initializers are in the
+ * host backlog, since their events are unknown.
+ */
+auto LocalTransporter::complete_events() -> size_type
+{
+    if (track_counts_.backlog > 0)
+    {
+        return pending_.size();
+    }
+
+    StepperInterface::VecCount counts;
+    if (track_counts_)
+    {
+        counts = step_->count_tracks_by_event();
+    }
+    auto num_tracks = [&counts](EventId id) -> size_type {
+        return id < counts.size() ? counts[id.unchecked_get()] : 0;
+    };
+
+    size_type num_in_flight = 0;
+    for (auto iter = pending_.begin(); iter != pending_.end();)
+    {
+        if (num_tracks(iter->id) > 0)
+        {
+            ++num_in_flight;
+            ++iter;
+        }
+        else if (iter->flushed)
+        {
+            PendingEvent event = std::move(*iter);
+            iter = pending_.erase(iter);
+            CELER_LOG_LOCAL(debug)
+                << "Completed event " << event.id.unchecked_get();
+            if (auto const& hits = hit_manager_.value())
+            {
+                hits->flush(event.id);
+            }
+            if (event.done)
+            {
+                event.done(static_cast<int>(event.id.unchecked_get()));
+            }
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+    return num_in_flight;
 }
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <deque>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -40,9 +42,28 @@ class SharedParams;
  * - an event action (to set the event ID and flush offloaded tracks at the end
  *   of the event)
  * - a tracking action (to try offloading every track)
+ *
+ * If \c SetupOptions::max_concurrent_events is greater than one, flushing at
+ * the end of an event returns as soon as few enough events are still being
+ * transported, so primaries from the next event can be injected into the same
+ * stepper while the tails of earlier events are still in flight. The callback
+ * passed to \c SetEventId is called (on the same thread) once all tracks from
+ * that event have completed, and all remaining events are completed by
+ * \c Finalize.
+ *
+ * Sensitive detectors can only receive hits while Geant4 is processing the
+ * hits' event, so events are never pipelined when sensitive detectors are
+ * used: each event is transported to completion, and its hits are sent to
+ * the detectors, before \c Flush returns.
  */
 class LocalTransporter
 {
+  public:
+    //!@{
+    //! \name Type aliases
+    using EventCallback = std::function<void(int)>;
+    //!@}
+
   public:
     // Construct in an invalid state
     LocalTransporter() = default;
@@ -54,21 +75,24 @@ class LocalTransporter
     inline void
     Initialize(SetupOptions const& options, SharedParams const& params);
 
-    // Set the event ID
-    void SetEventId(int);
+    // Set the event ID and optional callback for when it's complete
+    void SetEventId(int, EventCallback done = {});
 
     // Offload this track
     void Push(G4Track const&);
 
-    // Transport all buffered tracks to completion
+    // Transport buffered tracks until few enough events are in flight
     void Flush();
 
-    // Clear local data and return to an invalid state
+    // Complete all events, clear local data, and return to an invalid state
     void Finalize();
 
     // Number of buffered tracks
     size_type GetBufferSize() const { return buffer_.size(); }
 
+    // Number of events that have not yet been completed
+    size_type GetNumPendingEvents() const { return pending_.size(); }
+
     //! Whether the class instance is initialized
     explicit operator bool() const { return static_cast<bool>(step_); }
 
@@ -80,18 +104,36 @@ class LocalTransporter
         void operator()(SPHitManger& hm) const;
     };
 
+    struct PendingEvent
+    {
+        EventId id;
+        EventCallback done;
+        bool flushed{false};  //!< End of event has been reached
+    };
+
     std::shared_ptr<ParticleParams const> particles_;
     std::shared_ptr<StepperInterface> step_;
+    std::shared_ptr<StepperInterface> tail_step_;
     std::vector<Primary> buffer_;
+    std::deque<PendingEvent> pending_;
+    StepperResult track_counts_;
 
     EventId event_id_;
     TrackId::size_type track_counter_{};
 
     size_type auto_flush_{};
     size_type max_steps_{};
+    size_type max_concurrent_events_{1};
 
     // Shared pointer across threads, "finalize" called when clearing
     InitializedValue<SPHitManger, HMFinalizer> hit_manager_;
+
+    //// HELPER FUNCTIONS ////
+
+    void inject_buffer();
+    void transport(size_type max_in_flight);
+    void transport_tail();
+    size_type complete_events();
 };
 
 //---------------------------------------------------------------------------//
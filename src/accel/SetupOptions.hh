@@ -100,6 +100,14 @@ struct SetupOptions
     real_type secondary_stack_factor{3.0};
     //! Sync the GPU at every kernel for error checking
     bool sync{false};
+    //! Events per thread that may be transported together (one if using SDs)
+    size_type max_concurrent_events{1};
+    //! Finish the last tracks on the host below this fraction of track slots
+    real_type min_active_fraction{0};
+    //! Write per-step occupancy and throughput to the JSON output
+    bool step_diagnostics{false};
+    //! Steps stored before down-sampling the step diagnostics (0: no limit)
+    size_type max_step_diagnostic_samples{0};
     //!@}
 
     //! Set the number of streams (defaults to run manager # threads)
@@ -130,6 +138,8 @@ struct SetupOptions
     //!@{
     //! \name Track init options
     TrackOrder track_order{TrackOrder::unsorted};
+    //! Compact live tracks below this fraction of occupied track slots
+    double compaction_threshold{0};
     //!@}
 };
 
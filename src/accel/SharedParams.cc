@@ -29,6 +29,7 @@
 #include "corecel/sys/ScopedMem.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/ext/GeantImporter.hh"
+#include "celeritas/ext/GeantOrangeConverter.hh"
 #include "celeritas/ext/GeantSetup.hh"
 #include "celeritas/ext/RootExporter.hh"
 #include "celeritas/geo/GeoMaterialParams.hh"
@@ -295,8 +296,13 @@ void SharedParams::initialize_core(SetupOptions const& options)
         else
         {
             // Import from Geant4
+#if CELERITAS_USE_VECGEOM
             return std::make_shared<GeoParams>(
                 GeantImporter::get_world_volume());
+#else
+            return std::make_shared<GeoParams>(
+                GeantOrangeConverter{}(GeantImporter::get_world_volume()));
+#endif
         }
     }();
 
@@ -344,6 +350,7 @@ void SharedParams::initialize_core(SetupOptions const& options)
         input.capacity = options.initializer_capacity;
         input.max_events = options.max_num_events;
         input.track_order = options.track_order;
+        input.compaction_threshold = options.compaction_threshold;
         return std::make_shared<TrackInitParams>(std::move(input));
     }();
 
@@ -98,8 +98,12 @@ void SimpleOffload::BeginOfEventAction(G4Event const* event)
         return;
 
     // Set event ID in local transporter
+    auto done = [](int id) {
+        CELER_LOG_LOCAL(debug) << "Celeritas completed event " << id;
+    };
     ExceptionConverter call_g4exception{"celer0002"};
-    CELER_TRY_HANDLE(local_->SetEventId(event->GetEventID()), call_g4exception);
+    CELER_TRY_HANDLE(local_->SetEventId(event->GetEventID(), done),
+                     call_g4exception);
 }
 
 //---------------------------------------------------------------------------//
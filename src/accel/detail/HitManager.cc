@@ -56,6 +56,7 @@ HitManager::HitManager(GeoParams const& geo, SDSetupOptions const& setup)
 
     // Convert setup options to step data
     selection_.energy_deposition = setup.energy_deposition;
+    selection_.event_id = true;
     update_selection(&selection_.points[StepPoint::pre], setup.pre);
     update_selection(&selection_.points[StepPoint::post], setup.post);
     if (locate_touchable_)
@@ -154,6 +155,16 @@ void HitManager::execute(StateDeviceRef const& data)
     process_hits(data);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Send the buffered hits for a completed event to the local detectors.
+ */
+void HitManager::flush(EventId event)
+{
+    auto&& process_hits = this->get_local_hit_processor();
+    process_hits.flush(event);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Destroy local data to avoid Geant4 crashes.
@@ -35,6 +35,11 @@ class HitProcessor;
  *   exclusions for SDs that are implemented natively on GPU)
  * - Maps those volumes to VecGeom geometry
  * - Creates a HitProcessor for each Geant4 thread
+ *
+ * Hits are tagged with their event ID and buffered by the hit processor until
+ * \c flush is called for that event. The local transporter does this when
+ * the event completes, which is always inside its own Geant4 event since
+ * events with sensitive detectors are not pipelined.
  */
 class HitManager final : public StepInterface
 {
@@ -57,6 +62,9 @@ class HitManager final : public StepInterface
     // Process device-generated hits
     void execute(StateDeviceRef const&) final;
 
+    // Send the buffered hits for a completed event to the local detectors
+    void flush(EventId event);
+
     // Destroy local data to avoid Geant4 crashes
     void finalize();
 
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "HitProcessor.hh"
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <CLHEP/Units/SystemOfUnits.h>
@@ -175,10 +176,7 @@ HitProcessor::~HitProcessor() = default;
 void HitProcessor::operator()(StepStateHostRef const& states)
 {
     copy_steps(&steps_, states);
-    if (steps_)
-    {
-        (*this)(steps_);
-    }
+    this->process_steps();
 }
 
 //---------------------------------------------------------------------------//
@@ -188,10 +186,7 @@ void HitProcessor::operator()(StepStateHostRef const& states)
 void HitProcessor::operator()(StepStateDeviceRef const& states)
 {
     copy_steps(&steps_, states);
-    if (steps_)
-    {
-        (*this)(steps_);
-    }
+    this->process_steps();
 }
 
 //---------------------------------------------------------------------------//
@@ -205,13 +200,98 @@ void HitProcessor::operator()(StepStateDeviceRef const& states)
 void HitProcessor::operator()(DetectorStepOutput const& out) const
 {
     CELER_EXPECT(!out.detector.empty());
-    CELER_ASSERT(!navi_ || !out.points[StepPoint::pre].pos.empty());
-    CELER_ASSERT(!navi_ || !out.points[StepPoint::pre].dir.empty());
 
     CELER_LOG_LOCAL(debug) << "Processing " << out.size() << " hits";
+    this->process(out, EventId{});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save hits from a detector output until their event is flushed.
+ */
+void HitProcessor::buffer(DetectorStepOutput&& out)
+{
+    CELER_EXPECT(!out.detector.empty());
+    CELER_EXPECT(out.event_id.size() == out.size());
+
+    size_type num_hits = out.size();
+    pending_.push_back({std::move(out), num_hits});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate and call the buffered hits from a single event.
+ *
+ * This should be called once all tracks from the event have completed.
+ * Buffered steps are processed in the order they were taken, and step
+ * batches are released once all of their events have been flushed.
+ */
+void HitProcessor::flush(EventId event)
+{
+    CELER_EXPECT(event);
+
+    size_type num_hits = 0;
+    for (PendingSteps& pending : pending_)
+    {
+        size_type num_processed = this->process(pending.steps, event);
+        CELER_ASSERT(num_processed <= pending.remaining);
+        pending.remaining -= num_processed;
+        num_hits += num_processed;
+    }
+    pending_.erase(std::remove_if(pending_.begin(),
+                                  pending_.end(),
+                                  [](PendingSteps const& pending) {
+                                      return pending.remaining == 0;
+                                  }),
+                   pending_.end());
+
+    CELER_LOG_LOCAL(debug) << "Processed " << num_hits
+                           << " hits from event " << event.unchecked_get();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Process or buffer the steps copied from the state.
+ */
+void HitProcessor::process_steps()
+{
+    if (!steps_)
+    {
+        return;
+    }
+    if (steps_.event_id.empty())
+    {
+        // Events aren't being tracked: send the hits immediately
+        (*this)(steps_);
+        return;
+    }
+    this->buffer(std::move(steps_));
+    steps_ = {};
+}
 
+//---------------------------------------------------------------------------//
+/*!
+ * Generate and call hits from one event (or all events if null).
+ *
+ * The result is the number of hits that were sent to a detector or skipped
+ * because of an inconsistent touchable.
+ */
+size_type
+HitProcessor::process(DetectorStepOutput const& out, EventId event) const
+{
+    CELER_ASSERT(!navi_ || !out.points[StepPoint::pre].pos.empty());
+    CELER_ASSERT(!navi_ || !out.points[StepPoint::pre].dir.empty());
+    CELER_ASSERT(!event || out.event_id.size() == out.size());
+
+    size_type num_processed = 0;
     for (auto i : range(out.size()))
     {
+        if (event && out.event_id[i] != event)
+        {
+            continue;
+        }
+        ++num_processed;
+
 #define HP_SET(SETTER, OUT, UNITS)                   \
     do                                               \
     {                                                \
@@ -225,9 +305,6 @@ void HitProcessor::operator()(DetectorStepOutput const& out) const
         // TODO: how to handle track attributes?
         // track_->SetTrackID(...);
 
-        // TODO: assert that event ID is consistent with active
-        // LocalTransporter event?
-
         EnumArray<StepPoint, G4StepPoint*> points
             = {step_->GetPreStepPoint(), step_->GetPostStepPoint()};
         for (auto sp : range(StepPoint::size_))
@@ -271,6 +348,7 @@ void HitProcessor::operator()(DetectorStepOutput const& out) const
         CELER_ASSERT(out.detector[i] < detectors_.size());
         detectors_[out.detector[i].unchecked_get()]->Hit(step_.get());
     }
+    return num_processed;
 }
 
 //---------------------------------------------------------------------------//
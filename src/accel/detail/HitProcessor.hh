@@ -44,6 +44,11 @@ namespace detail
  * - Update step attributes based on hit selection for the detector (TODO:
  *   selection is global for now)
  * - Call the local detector (based on detector ID from map) with the step
+ *
+ * If the event ID is part of the step selection, the steps copied from the
+ * state are instead buffered until \c flush is called for their event. The
+ * hits are then sent to the detectors in a single pass while Geant4 is still
+ * processing that event.
  */
 class HitProcessor
 {
@@ -73,13 +78,30 @@ class HitProcessor
     // Generate and call hits from a detector output (for testing)
     void operator()(DetectorStepOutput const& out) const;
 
+    // Save hits from a detector output until their event is flushed
+    void buffer(DetectorStepOutput&& out);
+
+    // Generate and call the buffered hits from a single event
+    void flush(EventId event);
+
+    //! Number of step batches with hits that haven't been flushed
+    size_type num_buffered() const { return pending_.size(); }
+
   private:
+    struct PendingSteps
+    {
+        DetectorStepOutput steps;
+        size_type remaining{};  //!< Number of hits not yet processed
+    };
+
     //! Detector volumes for navigation updating
     SPConstVecLV detector_volumes_;
     //! Map detector IDs to sensitive detectors
     std::vector<G4VSensitiveDetector*> detectors_;
     //! Temporary CPU hit information
     DetectorStepOutput steps_;
+    //! Hits waiting for their event to complete
+    std::vector<PendingSteps> pending_;
 
     //! Temporary step
     std::unique_ptr<G4Step> step_;
@@ -90,6 +112,11 @@ class HitProcessor
     //! Geant4 reference-counted pointer to a G4VTouchable
     G4TouchableHandle touch_handle_;
 
+    // Generate and call hits from one event (or all if null)
+    size_type process(DetectorStepOutput const& out, EventId event) const;
+
+    void process_steps();
+
     bool update_touchable(Real3 const& pos,
                           Real3 const& dir,
                           G4LogicalVolume* lv) const;
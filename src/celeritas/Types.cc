@@ -35,8 +35,10 @@ char const* to_cstring(ActionOrder value)
     static EnumStringMapper<ActionOrder> const to_cstring_impl{
         "start",
         "pre",
+        "sort_pre",
         "along",
         "pre_post",
+        "sort_pre_post",
         "post",
         "post_post",
         "end",
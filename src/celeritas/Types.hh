@@ -106,8 +106,10 @@ enum class ActionOrder
 {
     start,  //!< Initialize tracks
     pre,  //!< Pre-step physics and setup
+    sort_pre,  //!< Sort track slots after setting up the step
     along,  //!< Along-step
     pre_post,  //!< Discrete selection kernel
+    sort_pre_post,  //!< Sort track slots after selecting discrete interaction
     post,  //!< After step
     post_post,  //!< User actions after boundary crossing, collision
     end,  //!< Processing secondaries, including replacing primaries
@@ -129,6 +131,9 @@ enum class TrackOrder
 {
     unsorted,
     shuffled,
+    sort_step_limit_action,  //!< Partition by post-step action before post
+    partition_charge,  //!< Neutral tracks before charged ones before along
+    sort_particle_energy,  //!< Sort by particle type and energy before along
     size_
 };
 
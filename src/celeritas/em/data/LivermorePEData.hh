@@ -100,7 +100,7 @@ struct LivermorePEXsData
 
     //// MEMBER DATA ////
 
-    Items<real_type> reals;
+    Items<table_real_type> reals;
     Items<LivermoreSubshell> shells;
     ElementItems<LivermoreElement> elements;
 
@@ -30,6 +30,15 @@ namespace celeritas
  * \c argmax is the y index of the largest cross section at a given incident
  * energy point.
  *
+ * The optional alias tables are used to select the reduced photon energy
+ * interval (the \em y bin) in constant time. The sampling weight of each bin
+ * at an incident energy grid point is the bin's largest cross section times
+ * its width in \f$ \ln \kappa \f$. Because the bins below the gamma
+ * production cutoff must be excluded, there is a table for each possible
+ * starting bin \em s (covering bins \em s through the last) at each incident
+ * energy, and \c weight_sums stores the total weight of the bins at or above
+ * each \em y index.
+ *
  * \todo We could use way smaller integers for argmax, even i/j here, because
  * these tables are so small.
  */
@@ -42,9 +51,34 @@ struct SBElementTableData
     ItemRange<size_type> argmax;  //!< Y index of the largest XS for each
                                   //!< energy
 
+    // Optional alias sampling tables
+    ItemRange<table_real_type> weight_sums;  //!< Weight of bins >= y [x][y]
+    ItemRange<table_real_type> alias_prob;  //!< Probability [x][start][bin]
+    ItemRange<size_type> alias_index;  //!< Alias bin [x][start][bin]
+
     explicit CELER_FUNCTION operator bool() const
     {
-        return grid && argmax.size() == grid.x.size();
+        return grid && argmax.size() == grid.x.size()
+               && alias_prob.size() == alias_index.size();
+    }
+
+    //! Whether alias tables are available for sampling
+    CELER_FUNCTION bool has_alias() const { return !alias_prob.empty(); }
+
+    //! Number of alias table entries for each incident energy grid point
+    CELER_FUNCTION size_type alias_block_size() const
+    {
+        size_type num_bins = grid.y.size() - 1;
+        return num_bins * (num_bins - 1) / 2;
+    }
+
+    //! Offset of the alias table starting at the given bin (1 <= start)
+    CELER_FUNCTION size_type alias_offset(size_type x, size_type start) const
+    {
+        CELER_EXPECT(start > 0 && start + 1 < grid.y.size());
+        size_type num_bins = grid.y.size() - 1;
+        return x * this->alias_block_size() + (start - 1) * num_bins
+               - (start - 1) * start / 2;
     }
 };
 
@@ -69,7 +103,7 @@ struct SeltzerBergerTableData
 
     //// MEMBER DATA ////
 
-    Items<real_type> reals;
+    Items<table_real_type> reals;
     Items<size_type> sizes;
     ElementItems<SBElementTableData> elements;
 
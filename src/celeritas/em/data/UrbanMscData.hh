@@ -171,7 +171,7 @@ struct UrbanMscData
     Items<UrbanMscParMatData> par_mat_data;  // [mat]{electron, positron}
 
     // Backend storage
-    Items<real_type> reals;
+    Items<table_real_type> reals;
 
     //// METHODS ////
 
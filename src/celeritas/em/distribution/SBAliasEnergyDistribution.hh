@@ -0,0 +1,318 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/distribution/SBAliasEnergyDistribution.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/grid/NonuniformGrid.hh"
+#include "corecel/grid/TwodGridCalculator.hh"
+#include "corecel/grid/TwodSubgridCalculator.hh"
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/em/data/SeltzerBergerData.hh"
+#include "celeritas/random/distribution/BernoulliDistribution.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
+#include "celeritas/random/distribution/ReciprocalDistribution.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample exiting photon energy from Bremsstrahlung using alias tables.
+ *
+ * This samples the same distribution as \c SBEnergyDistribution,
+ * \f[
+ *   p(k) \propto \chi_Z(E, \kappa) \frac{k}{k^2 + d_\rho E^2} \,,
+ * \f]
+ * but replaces the single flat rejection envelope with a piecewise one that
+ * is constant over each reduced photon energy interval of the SB table. The
+ * interval is selected in constant time from the precomputed alias tables of
+ * the incident energy grid points that bracket \em E (see \c
+ * SBElementTableData), the energy is sampled inside the interval from the
+ * reciprocal distribution with the density correction, and the sample is
+ * accepted with probability
+ * \f[
+ *   \frac{\chi_Z(E, \kappa)}{\max_j \chi_Z(E)}
+ *   \frac{\ln[(\kappa_{j+1}^2 + \delta) / (\kappa_j^2 + \delta)]}
+ *        {2 \ln(\kappa_{j+1} / \kappa_j)} \,,
+ * \f]
+ * where the second term corrects the tabulated interval weights for the
+ * (material-dependent) density correction \f$ \delta = d_\rho \f$. Since the
+ * envelope tightly bounds the cross section, the acceptance probability is
+ * close to unity, and each trial uses a fixed number of random samples.
+ *
+ * The interval containing the gamma production cutoff is truncated at the
+ * cutoff, and the intervals below it are excluded by using the alias table
+ * that starts at the next interval. The weight of the truncated interval is
+ * calculated on the fly, including the density correction, so that the
+ * second term is unity for it.
+ *
+ * The cross section correction (e.g. for positrons) must be no greater than
+ * unity; only its \c operator() is used.
+ */
+template<class XSCorrector>
+class SBAliasEnergyDistribution
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SBDXsec = NativeCRef<SeltzerBergerTableData>;
+    using Energy = units::MevEnergy;
+    using EnergySq = Quantity<UnitProduct<units::Mev, units::Mev>>;
+    //!@}
+
+  public:
+    // Construct from data
+    inline CELER_FUNCTION
+    SBAliasEnergyDistribution(SBDXsec const& differential_xs,
+                              Energy inc_energy,
+                              ElementId element,
+                              EnergySq density_correction,
+                              Energy min_gamma_energy,
+                              XSCorrector scale_xs);
+
+    // Sample the exiting energy
+    template<class Engine>
+    inline CELER_FUNCTION Energy operator()(Engine& rng);
+
+  private:
+    //// DATA ////
+
+    SBDXsec const& data_;
+    SBElementTableData const& table_;
+    const TwodSubgridCalculator calc_xs_;
+    const real_type inc_energy_;
+    const real_type dens_corr_;
+    XSCorrector scale_xs_;
+
+    // Reduced energy interval containing the cutoff and its lower bound
+    size_type start_bin_{};
+    real_type start_kappa_{};
+
+    // Weights at the lower and upper incident energy grid points
+    real_type frac_[2];
+    real_type partial_[2];
+    real_type suffix_[2];
+    real_type total_[2];
+
+    //// HELPER FUNCTIONS ////
+
+    inline CELER_FUNCTION TwodSubgridCalculator make_xs_calc(real_type) const;
+    inline CELER_FUNCTION real_type y(size_type j) const;
+    inline CELER_FUNCTION real_type calc_xs(size_type bin,
+                                            real_type kappa) const;
+    inline CELER_FUNCTION real_type max_xs(size_type x, size_type bin) const;
+    inline CELER_FUNCTION size_type sample_bin(size_type x, real_type xi) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from incident particle and energy.
+ *
+ * The incident energy *must* be within the bounds of the SB table data.
+ */
+template<class X>
+CELER_FUNCTION SBAliasEnergyDistribution<X>::SBAliasEnergyDistribution(
+    SBDXsec const& differential_xs,
+    Energy inc_energy,
+    ElementId element,
+    EnergySq density_correction,
+    Energy min_gamma_energy,
+    X scale_xs)
+    : data_(differential_xs)
+    , table_(differential_xs.elements[element])
+    , calc_xs_{this->make_xs_calc(inc_energy.value())}
+    , inc_energy_(inc_energy.value())
+    , dens_corr_(density_correction.value())
+    , scale_xs_(::celeritas::move(scale_xs))
+{
+    CELER_EXPECT(table_.has_alias());
+    CELER_EXPECT(inc_energy > min_gamma_energy);
+
+    // Find the reduced energy interval containing the cutoff
+    NonuniformGrid<table_real_type> const ygrid(table_.grid.y, data_.reals);
+    real_type kappa_c = min_gamma_energy.value() / inc_energy_;
+    if (kappa_c <= ygrid.front())
+    {
+        start_bin_ = 0;
+        start_kappa_ = ygrid.front();
+    }
+    else
+    {
+        start_bin_ = ygrid.find(kappa_c);
+        start_kappa_ = kappa_c;
+    }
+
+    // Calculate the sampling weights for the bracketing energy grid points
+    size_type const num_y = table_.grid.y.size();
+    auto weight_sums = data_.reals[table_.weight_sums];
+    // The width of the first interval includes the density correction
+    real_type log_partial
+        = std::log((ipow<2>(this->y(start_bin_ + 1) * inc_energy_) + dens_corr_)
+                   / (ipow<2>(start_kappa_ * inc_energy_) + dens_corr_))
+          / 2;
+    for (size_type g : range(size_type{2}))
+    {
+        size_type x = calc_xs_.x_index() + g;
+        frac_[g] = g == 0 ? 1 - calc_xs_.x_fraction() : calc_xs_.x_fraction();
+        partial_[g] = this->max_xs(x, start_bin_) * log_partial;
+        suffix_[g] = weight_sums[x * num_y + start_bin_ + 1];
+        total_[g] = frac_[g] * (partial_[g] + suffix_[g]);
+    }
+    CELER_ENSURE(total_[0] + total_[1] > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the exiting energy.
+ */
+template<class X>
+template<class Engine>
+CELER_FUNCTION auto SBAliasEnergyDistribution<X>::operator()(Engine& rng)
+    -> Energy
+{
+    Energy exit_energy;
+    real_type accept_prob{};
+    do
+    {
+        // Select the energy grid point and reduced energy interval
+        real_type xi = generate_canonical(rng) * (total_[0] + total_[1]);
+        size_type g = (xi >= total_[0] && total_[1] > 0) ? 1 : 0;
+        xi = (g == 0 ? xi : xi - total_[0]) / frac_[g];
+        size_type x = calc_xs_.x_index() + g;
+        size_type bin = start_bin_;
+        if (xi >= partial_[g] && suffix_[g] > 0)
+        {
+            real_type xi_suffix = (xi - partial_[g]) / suffix_[g];
+            bin = this->sample_bin(x, celeritas::min(xi_suffix, real_type(1)));
+        }
+
+        // Sample the exiting energy inside the interval
+        real_type lo = (bin == start_bin_ ? start_kappa_ : this->y(bin));
+        real_type hi = this->y(bin + 1);
+        real_type esq_lo = ipow<2>(lo * inc_energy_) + dens_corr_;
+        real_type esq_hi = ipow<2>(hi * inc_energy_) + dens_corr_;
+        real_type esq = ReciprocalDistribution<real_type>(esq_lo, esq_hi)(rng)
+                        - dens_corr_;
+        CELER_ASSERT(esq > 0);
+        exit_energy = Energy{std::sqrt(esq)};
+
+        // Reject based on the cross section interpolated inside the sampled
+        // interval: since it is a weighted average of the same stored values
+        // used by the envelope, it can't exceed the envelope even if the
+        // sampled energy is rounded past the edge of the interval
+        real_type xs = this->calc_xs(bin, exit_energy.value() / inc_energy_)
+                       * scale_xs_(exit_energy);
+        real_type envelope = frac_[0] * this->max_xs(x - g, bin)
+                             + frac_[1] * this->max_xs(x - g + 1, bin);
+        real_type weight_corr = 1;
+        if (bin != start_bin_)
+        {
+            weight_corr = std::log(esq_hi / esq_lo) / (2 * std::log(hi / lo));
+        }
+        accept_prob = xs * weight_corr / envelope;
+        CELER_ASSERT(accept_prob >= 0 && accept_prob <= 1 + 1e-6);
+    } while (!BernoulliDistribution(accept_prob)(rng));
+    return exit_energy;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the differential cross section calculator for exit energy.
+ */
+template<class X>
+CELER_FUNCTION TwodSubgridCalculator
+SBAliasEnergyDistribution<X>::make_xs_calc(real_type inc_energy) const
+{
+    TwodGridData const& grid = table_.grid;
+    CELER_ASSERT(inc_energy >= std::exp(data_.reals[grid.x.front()])
+                 && inc_energy < std::exp(data_.reals[grid.x.back()]));
+    return TwodGridCalculator(grid, data_.reals)(std::log(inc_energy));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the reduced photon energy at the given grid point.
+ */
+template<class X>
+CELER_FUNCTION real_type SBAliasEnergyDistribution<X>::y(size_type j) const
+{
+    return data_.reals[table_.grid.y[j]];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate the cross section in a reduced energy interval.
+ *
+ * This is equivalent to the bilinear interpolation of \c calc_xs_ but uses
+ * the given interval rather than searching for the one containing \c kappa .
+ */
+template<class X>
+CELER_FUNCTION real_type
+SBAliasEnergyDistribution<X>::calc_xs(size_type bin, real_type kappa) const
+{
+    TwodGridData const& grid = table_.grid;
+    real_type lo = this->y(bin);
+    real_type frac = celeritas::clamp(
+        (kappa - lo) / (this->y(bin + 1) - lo), real_type(0), real_type(1));
+
+    real_type result = 0;
+    for (size_type g : range(size_type{2}))
+    {
+        size_type x = calc_xs_.x_index() + g;
+        result += frac_[g]
+                  * ((1 - frac) * data_.reals[grid.at(x, bin)]
+                     + frac * data_.reals[grid.at(x, bin + 1)]);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the largest tabulated cross section in a reduced energy interval.
+ */
+template<class X>
+CELER_FUNCTION real_type
+SBAliasEnergyDistribution<X>::max_xs(size_type x, size_type bin) const
+{
+    TwodGridData const& grid = table_.grid;
+    return celeritas::max(data_.reals[grid.at(x, bin)],
+                          data_.reals[grid.at(x, bin + 1)]);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample an interval above the starting bin from its alias table.
+ */
+template<class X>
+CELER_FUNCTION size_type
+SBAliasEnergyDistribution<X>::sample_bin(size_type x, real_type xi) const
+{
+    size_type const start = start_bin_ + 1;
+    size_type const num_bins = table_.grid.y.size() - 1;
+    CELER_ASSERT(start < num_bins);
+    size_type const n = num_bins - start;
+    size_type const offset = table_.alias_offset(x, start);
+
+    real_type scaled = xi * n;
+    size_type idx = celeritas::min(static_cast<size_type>(scaled), n - 1);
+    if (scaled - idx < data_.reals[table_.alias_prob][offset + idx])
+    {
+        return start + idx;
+    }
+    return data_.sizes[table_.alias_index][offset + idx];
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
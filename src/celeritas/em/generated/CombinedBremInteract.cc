@@ -8,10 +8,12 @@
 //---------------------------------------------------------------------------//
 #include "CombinedBremInteract.hh"
 
+#include <exception>
 #include <utility>
 
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/global/KernelContextException.hh"
@@ -36,16 +38,43 @@ void combined_brem_interact(
     auto launch = celeritas::make_interaction_launcher(
         params, state, model_data,
         celeritas::combined_brem_interact_track);
+    auto const threads
+        = celeritas::action_thread_range(state, model_data.ids.action);
     #pragma omp parallel for
-    for (celeritas::size_type i = 0; i < state.size(); ++i)
+    for (celeritas::size_type i = 0; i < threads.size(); ++i)
     {
+        ThreadId const tid = threads[i];
         CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{i}),
+            launch(tid),
             capture_exception,
-            KernelContextException(params, state, ThreadId{i}, "combined_brem"));
+            KernelContextException(params, state, tid, "combined_brem"));
     }
     log_and_rethrow(std::move(capture_exception));
 }
 
+void combined_brem_interact(
+    celeritas::CombinedBremHostRef const& model_data,
+    celeritas::HostCRef<celeritas::CoreParamsData> const& params,
+    celeritas::HostRef<celeritas::CoreStateData>& state,
+    celeritas::Range<celeritas::ThreadId> chunk)
+{
+    auto launch = celeritas::make_interaction_launcher(
+        params, state, model_data,
+        celeritas::combined_brem_interact_track);
+    for (ThreadId tid :
+         celeritas::action_thread_range(state, model_data.ids.action, chunk))
+    {
+        try
+        {
+            launch(tid);
+        }
+        catch (...)
+        {
+            std::throw_with_nested(
+                KernelContextException(params, state, tid, "combined_brem"));
+        }
+    }
+}
+
 }  // namespace generated
 }  // namespace celeritas
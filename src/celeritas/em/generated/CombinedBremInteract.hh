@@ -11,6 +11,8 @@
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/sys/ThreadId.hh"
 #include "celeritas/em/data/CombinedBremData.hh" // IWYU pragma: associated
 #include "celeritas/global/CoreTrackDataFwd.hh"
 
@@ -23,6 +25,12 @@ void combined_brem_interact(
     celeritas::HostCRef<celeritas::CoreParamsData> const&,
     celeritas::HostRef<celeritas::CoreStateData>&);
 
+void combined_brem_interact(
+    celeritas::CombinedBremHostRef const&,
+    celeritas::HostCRef<celeritas::CoreParamsData> const&,
+    celeritas::HostRef<celeritas::CoreStateData>&,
+    celeritas::Range<celeritas::ThreadId> chunk);
+
 void combined_brem_interact(
     celeritas::CombinedBremDeviceRef const&,
     celeritas::DeviceCRef<celeritas::CoreParamsData> const&,
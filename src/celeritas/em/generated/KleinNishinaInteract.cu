@@ -11,6 +11,7 @@
 #include "corecel/device_runtime_api.h"
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/KernelParamCalculator.device.hh"
 #include "corecel/sys/Device.hh"
 #include "celeritas/em/launcher/KleinNishinaLauncher.hh"
@@ -34,16 +35,17 @@ __launch_bounds__(1024, 8)
 klein_nishina_interact_kernel(
     celeritas::KleinNishinaDeviceRef const model_data,
     celeritas::DeviceCRef<celeritas::CoreParamsData> const params,
-    celeritas::DeviceRef<celeritas::CoreStateData> const state)
+    celeritas::DeviceRef<celeritas::CoreStateData> const state,
+    celeritas::Range<celeritas::ThreadId> const threads)
 {
     auto tid = celeritas::KernelParamCalculator::thread_id();
-    if (!(tid < state.size()))
+    if (!(tid < threads.size()))
         return;
 
     auto launch = celeritas::make_interaction_launcher(
         params, state, model_data,
         celeritas::klein_nishina_interact_track);
-    launch(tid);
+    launch(threads[tid.get()]);
 }
 }  // namespace
 
@@ -55,10 +57,15 @@ void klein_nishina_interact(
     CELER_EXPECT(params && state);
     CELER_EXPECT(model_data);
 
+    auto const threads
+        = celeritas::action_thread_range(state, model_data.ids.action);
+    if (threads.empty())
+        return;
+
     CELER_LAUNCH_KERNEL(klein_nishina_interact,
                         celeritas::device().default_block_size(),
-                        state.size(),
-                        model_data, params, state);
+                        threads.size(),
+                        model_data, params, state, threads);
 }
 
 }  // namespace generated
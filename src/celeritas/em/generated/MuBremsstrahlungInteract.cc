@@ -8,10 +8,12 @@
 //---------------------------------------------------------------------------//
 #include "MuBremsstrahlungInteract.hh"
 
+#include <exception>
 #include <utility>
 
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/global/KernelContextException.hh"
@@ -36,16 +38,43 @@ void mu_bremsstrahlung_interact(
     auto launch = celeritas::make_interaction_launcher(
         params, state, model_data,
         celeritas::mu_bremsstrahlung_interact_track);
+    auto const threads
+        = celeritas::action_thread_range(state, model_data.ids.action);
     #pragma omp parallel for
-    for (celeritas::size_type i = 0; i < state.size(); ++i)
+    for (celeritas::size_type i = 0; i < threads.size(); ++i)
     {
+        ThreadId const tid = threads[i];
         CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{i}),
+            launch(tid),
             capture_exception,
-            KernelContextException(params, state, ThreadId{i}, "mu_bremsstrahlung"));
+            KernelContextException(params, state, tid, "mu_bremsstrahlung"));
     }
     log_and_rethrow(std::move(capture_exception));
 }
 
+void mu_bremsstrahlung_interact(
+    celeritas::MuBremsstrahlungHostRef const& model_data,
+    celeritas::HostCRef<celeritas::CoreParamsData> const& params,
+    celeritas::HostRef<celeritas::CoreStateData>& state,
+    celeritas::Range<celeritas::ThreadId> chunk)
+{
+    auto launch = celeritas::make_interaction_launcher(
+        params, state, model_data,
+        celeritas::mu_bremsstrahlung_interact_track);
+    for (ThreadId tid :
+         celeritas::action_thread_range(state, model_data.ids.action, chunk))
+    {
+        try
+        {
+            launch(tid);
+        }
+        catch (...)
+        {
+            std::throw_with_nested(
+                KernelContextException(params, state, tid, "mu_bremsstrahlung"));
+        }
+    }
+}
+
 }  // namespace generated
 }  // namespace celeritas
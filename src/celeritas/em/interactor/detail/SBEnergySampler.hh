@@ -13,6 +13,7 @@
 #include "celeritas/Quantities.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/em/data/SeltzerBergerData.hh"
+#include "celeritas/em/distribution/SBAliasEnergyDistribution.hh"
 #include "celeritas/em/distribution/SBEnergyDistHelper.hh"
 #include "celeritas/em/distribution/SBEnergyDistribution.hh"
 #include "celeritas/mat/ElementView.hh"
@@ -31,6 +32,9 @@ namespace detail
 //---------------------------------------------------------------------------//
 /*!
  * Sample the bremsstrahlung photon energy from the SeltzerBerger model.
+ *
+ * If alias tables were built for the element, they are used to sample the
+ * energy; otherwise the cross section is rejection sampled.
  */
 class SBEnergySampler
 {
@@ -114,12 +118,44 @@ CELER_FUNCTION auto SBEnergySampler::operator()(Engine& rng) -> Energy
     // Outgoing photon secondary energy sampler
     Energy gamma_exit_energy;
 
+    ElementId el_id = material_.element_id(elcomp_id_);
+    if (differential_xs_.elements[el_id].has_alias())
+    {
+        using EnergySq = SBEnergyDistHelper::EnergySq;
+        if (inc_particle_is_electron_)
+        {
+            SBAliasEnergyDistribution<SBElectronXsCorrector>
+                sample_gamma_energy(differential_xs_,
+                                    inc_energy_,
+                                    el_id,
+                                    EnergySq{density_correction_},
+                                    gamma_cutoff_,
+                                    {});
+            gamma_exit_energy = sample_gamma_energy(rng);
+        }
+        else
+        {
+            SBAliasEnergyDistribution<SBPositronXsCorrector>
+                sample_gamma_energy(differential_xs_,
+                                    inc_energy_,
+                                    el_id,
+                                    EnergySq{density_correction_},
+                                    gamma_cutoff_,
+                                    {inc_mass_,
+                                     material_.make_element_view(elcomp_id_),
+                                     gamma_cutoff_,
+                                     inc_energy_});
+            gamma_exit_energy = sample_gamma_energy(rng);
+        }
+        return gamma_exit_energy;
+    }
+
     // Helper class preprocesses cross section bounds and calculates
     // distribution
     SBEnergyDistHelper sb_helper(
         differential_xs_,
         inc_energy_,
-        material_.element_id(elcomp_id_),
+        el_id,
         SBEnergyDistHelper::EnergySq{density_correction_},
         gamma_cutoff_);
 
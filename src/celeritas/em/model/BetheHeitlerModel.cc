@@ -85,6 +85,13 @@ void BetheHeitlerModel::execute(ParamsHostCRef const& params,
 {
     generated::bethe_heitler_interact(data_, params, states);
 }
+
+void BetheHeitlerModel::execute_chunk(ParamsHostCRef const& params,
+                                      StateHostRef& states,
+                                      Range<ThreadId> chunk) const
+{
+    generated::bethe_heitler_interact(data_, params, states, chunk);
+}
 //!@}
 //---------------------------------------------------------------------------//
 /*!
@@ -21,7 +21,7 @@ namespace celeritas
 /*!
  * Set up and launch the Bethe-Heitler model interaction.
  */
-class BetheHeitlerModel final : public Model
+class BetheHeitlerModel final : public Model, public FusibleActionInterface
 {
   public:
     //!@{
@@ -45,6 +45,11 @@ class BetheHeitlerModel final : public Model
     // Apply the interaction kernel on host
     void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+    // Apply the interaction kernel to a chunk of threads on host
+    void execute_chunk(ParamsHostCRef const&,
+                       StateHostRef&,
+                       Range<ThreadId>) const final;
+
     // Apply the interaction kernel on device
     void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
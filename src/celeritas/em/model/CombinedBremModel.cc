@@ -33,7 +33,8 @@ CombinedBremModel::CombinedBremModel(ActionId id,
                                      MaterialParams const& materials,
                                      SPConstImported data,
                                      ReadData sb_table,
-                                     bool enable_lpm)
+                                     bool enable_lpm,
+                                     bool sb_alias_sampling)
 {
     CELER_EXPECT(id);
     CELER_EXPECT(sb_table);
@@ -41,7 +42,7 @@ CombinedBremModel::CombinedBremModel(ActionId id,
     // Construct SeltzerBergerModel and RelativisticBremModel and save the
     // host data reference
     sb_model_ = std::make_shared<SeltzerBergerModel>(
-        id, particles, materials, data, sb_table);
+        id, particles, materials, data, sb_table, sb_alias_sampling);
 
     rb_model_ = std::make_shared<RelativisticBremModel>(
         id, particles, materials, data, enable_lpm);
@@ -100,6 +101,13 @@ void CombinedBremModel::execute(ParamsHostCRef const& params,
     generated::combined_brem_interact(this->host_ref(), params, states);
 }
 
+void CombinedBremModel::execute_chunk(ParamsHostCRef const& params,
+                                      StateHostRef& states,
+                                      Range<ThreadId> chunk) const
+{
+    generated::combined_brem_interact(this->host_ref(), params, states, chunk);
+}
+
 //!@}
 //---------------------------------------------------------------------------//
 /*!
@@ -32,7 +32,7 @@ class ParticleParams;
  * Set up and launch a combined model of SeltzerBergerModel at the low energy
  * and RelativisticBremModel at the hight energy for e+/e- Bremsstrahlung.
  */
-class CombinedBremModel final : public Model
+class CombinedBremModel final : public Model, public FusibleActionInterface
 {
   public:
     //@{
@@ -50,7 +50,8 @@ class CombinedBremModel final : public Model
                       MaterialParams const& materials,
                       SPConstImported data,
                       ReadData load_sb_table,
-                      bool enable_lpm);
+                      bool enable_lpm,
+                      bool sb_alias_sampling);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
@@ -61,6 +62,11 @@ class CombinedBremModel final : public Model
     // Apply the interaction kernel to host data
     void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+    // Apply the interaction kernel to a chunk of threads on host
+    void execute_chunk(ParamsHostCRef const&,
+                       StateHostRef&,
+                       Range<ThreadId>) const final;
+
     // Apply the interaction kernel to device data
     void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
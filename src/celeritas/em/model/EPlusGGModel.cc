@@ -74,6 +74,13 @@ void EPlusGGModel::execute(ParamsHostCRef const& params,
     generated::eplusgg_interact(data_, params, states);
 }
 
+void EPlusGGModel::execute_chunk(ParamsHostCRef const& params,
+                                 StateHostRef& states,
+                                 Range<ThreadId> chunk) const
+{
+    generated::eplusgg_interact(data_, params, states, chunk);
+}
+
 //!@}
 //---------------------------------------------------------------------------//
 /*!
@@ -17,7 +17,7 @@ namespace celeritas
 /*!
  * Set up and launch two-gamma positron annihiliation.
  */
-class EPlusGGModel final : public Model
+class EPlusGGModel final : public Model, public FusibleActionInterface
 {
   public:
     // Construct from model ID and other necessary data
@@ -32,6 +32,11 @@ class EPlusGGModel final : public Model
     // Apply the interaction kernel on host
     void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+    // Apply the interaction kernel to a chunk of threads on host
+    void execute_chunk(ParamsHostCRef const&,
+                       StateHostRef&,
+                       Range<ThreadId>) const final;
+
     // Apply the interaction kernel on device
     void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
@@ -77,6 +77,13 @@ void KleinNishinaModel::execute(ParamsHostCRef const& params,
     generated::klein_nishina_interact(data_, params, states);
 }
 
+void KleinNishinaModel::execute_chunk(ParamsHostCRef const& params,
+                                      StateHostRef& states,
+                                      Range<ThreadId> chunk) const
+{
+    generated::klein_nishina_interact(data_, params, states, chunk);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the model ID for this model.
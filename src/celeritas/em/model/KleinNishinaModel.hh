@@ -17,7 +17,7 @@ namespace celeritas
 /*!
  * Set up and launch the Klein-Nishina model interaction.
  */
-class KleinNishinaModel final : public Model
+class KleinNishinaModel final : public Model, public FusibleActionInterface
 {
   public:
     // Construct from model ID and other necessary data
@@ -32,6 +32,11 @@ class KleinNishinaModel final : public Model
     //! Apply the interaction kernel to host data
     void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+    // Apply the interaction kernel to a chunk of threads on host
+    void execute_chunk(ParamsHostCRef const&,
+                       StateHostRef&,
+                       Range<ThreadId>) const final;
+
     // Apply the interaction kernel to device data
     void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
@@ -114,6 +114,13 @@ void LivermorePEModel::execute(ParamsHostCRef const& params,
     generated::livermore_pe_interact(this->host_ref(), params, states);
 }
 
+void LivermorePEModel::execute_chunk(ParamsHostCRef const& params,
+                                     StateHostRef& states,
+                                     Range<ThreadId> chunk) const
+{
+    generated::livermore_pe_interact(this->host_ref(), params, states, chunk);
+}
+
 //!@}
 //---------------------------------------------------------------------------//
 /*!
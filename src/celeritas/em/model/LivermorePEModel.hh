@@ -25,7 +25,7 @@ struct ImportLivermorePE;
 /*!
  * Set up and launch the Livermore photoelectric model interaction.
  */
-class LivermorePEModel final : public Model
+class LivermorePEModel final : public Model, public FusibleActionInterface
 {
   public:
     //!@{
@@ -51,6 +51,11 @@ class LivermorePEModel final : public Model
     // Apply the interaction kernel on host
     void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+    // Apply the interaction kernel to a chunk of threads on host
+    void execute_chunk(ParamsHostCRef const&,
+                       StateHostRef&,
+                       Range<ThreadId>) const final;
+
     // Apply the interaction kernel on device
     void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
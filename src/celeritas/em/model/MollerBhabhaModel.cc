@@ -89,6 +89,13 @@ void MollerBhabhaModel::execute(ParamsHostCRef const& params,
     generated::moller_bhabha_interact(data_, params, states);
 }
 
+void MollerBhabhaModel::execute_chunk(ParamsHostCRef const& params,
+                                      StateHostRef& states,
+                                      Range<ThreadId> chunk) const
+{
+    generated::moller_bhabha_interact(data_, params, states, chunk);
+}
+
 //!@}
 //---------------------------------------------------------------------------//
 /*!
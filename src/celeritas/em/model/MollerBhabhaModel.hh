@@ -18,7 +18,7 @@ class ParticleParams;
 /*!
  * Set up and launch the Moller-Bhabha model interaction.
  */
-class MollerBhabhaModel final : public Model
+class MollerBhabhaModel final : public Model, public FusibleActionInterface
 {
   public:
     // Construct from model ID and other necessary data
@@ -33,6 +33,11 @@ class MollerBhabhaModel final : public Model
     // Apply the interaction kernel on host
     void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+    // Apply the interaction kernel to a chunk of threads on host
+    void execute_chunk(ParamsHostCRef const&,
+                       StateHostRef&,
+                       Range<ThreadId>) const final;
+
     // Apply the interaction kernel on device
     void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
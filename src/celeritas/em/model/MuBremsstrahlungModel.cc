@@ -90,6 +90,13 @@ void MuBremsstrahlungModel::execute(ParamsHostCRef const& params,
     generated::mu_bremsstrahlung_interact(data_, params, states);
 }
 
+void MuBremsstrahlungModel::execute_chunk(ParamsHostCRef const& params,
+                                          StateHostRef& states,
+                                          Range<ThreadId> chunk) const
+{
+    generated::mu_bremsstrahlung_interact(data_, params, states, chunk);
+}
+
 //!@}
 //---------------------------------------------------------------------------//
 /*!
@@ -21,7 +21,7 @@ namespace celeritas
 /*!
  * Set up and launch the Muon Bremsstrahlung model interaction.
  */
-class MuBremsstrahlungModel final : public Model
+class MuBremsstrahlungModel final : public Model, public FusibleActionInterface
 {
   public:
     //!@{
@@ -44,6 +44,11 @@ class MuBremsstrahlungModel final : public Model
     // Apply the interaction kernel on host
     void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+    // Apply the interaction kernel to a chunk of threads on host
+    void execute_chunk(ParamsHostCRef const&,
+                       StateHostRef&,
+                       Range<ThreadId>) const final;
+
     // Apply the interaction kernel on device
     void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
@@ -93,6 +93,13 @@ void RayleighModel::execute(ParamsHostCRef const& params,
     generated::rayleigh_interact(this->host_ref(), params, states);
 }
 
+void RayleighModel::execute_chunk(ParamsHostCRef const& params,
+                                  StateHostRef& states,
+                                  Range<ThreadId> chunk) const
+{
+    generated::rayleigh_interact(this->host_ref(), params, states, chunk);
+}
+
 //!@}
 //---------------------------------------------------------------------------//
 /*!
@@ -25,7 +25,7 @@ class ParticleParams;
 /*!
  * Set up and launch Rayleigh scattering.
  */
-class RayleighModel final : public Model
+class RayleighModel final : public Model, public FusibleActionInterface
 {
   public:
     //@{
@@ -51,6 +51,11 @@ class RayleighModel final : public Model
     // Apply the interaction kernel to host data
     void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+    // Apply the interaction kernel to a chunk of threads on host
+    void execute_chunk(ParamsHostCRef const&,
+                       StateHostRef&,
+                       Range<ThreadId>) const final;
+
     // Apply the interaction kernel to device data
     void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
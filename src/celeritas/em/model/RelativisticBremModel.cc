@@ -112,6 +112,14 @@ void RelativisticBremModel::execute(ParamsHostCRef const& params,
     generated::relativistic_brem_interact(this->host_ref(), params, states);
 }
 
+void RelativisticBremModel::execute_chunk(ParamsHostCRef const& params,
+                                          StateHostRef& states,
+                                          Range<ThreadId> chunk) const
+{
+    generated::relativistic_brem_interact(
+        this->host_ref(), params, states, chunk);
+}
+
 //!@}
 //---------------------------------------------------------------------------//
 /*!
@@ -27,7 +27,7 @@ class ParticleParams;
  * Set up and launch the relativistic Bremsstrahlung model for high-energy
  * electrons and positrons with the Landau-Pomeranchuk-Migdal (LPM) effect
  */
-class RelativisticBremModel final : public Model
+class RelativisticBremModel final : public Model, public FusibleActionInterface
 {
   public:
     //@{
@@ -54,6 +54,11 @@ class RelativisticBremModel final : public Model
     // Apply the interaction kernel to host data
     void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+    // Apply the interaction kernel to a chunk of threads on host
+    void execute_chunk(ParamsHostCRef const&,
+                       StateHostRef&,
+                       Range<ThreadId>) const final;
+
     // Apply the interaction kernel to device data
     void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
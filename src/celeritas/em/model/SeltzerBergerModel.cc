@@ -40,7 +40,8 @@ SeltzerBergerModel::SeltzerBergerModel(ActionId id,
                                        ParticleParams const& particles,
                                        MaterialParams const& materials,
                                        SPConstImported data,
-                                       ReadData load_sb_table)
+                                       ReadData load_sb_table,
+                                       bool alias_sampling)
     : imported_(data,
                 particles,
                 ImportProcessClass::e_brems,
@@ -72,16 +73,32 @@ SeltzerBergerModel::SeltzerBergerModel(ActionId id,
     ScopedTimeLog scoped_time;
     make_builder(&host_data.differential_xs.elements)
         .reserve(materials.num_elements());
+    auto grid_reals = make_dedupe_builder(&host_data.differential_xs.reals);
     for (auto el_id : range(ElementId{materials.num_elements()}))
     {
         auto element = materials.get(el_id);
         this->append_table(element,
                            load_sb_table(element.atomic_number()),
                            &host_data.differential_xs,
+                           &grid_reals,
                            host_data.electron_mass);
     }
     CELER_ASSERT(host_data.differential_xs.elements.size()
                  == materials.num_elements());
+    CELER_LOG(debug) << "Reused " << grid_reals.num_deduplicated()
+                     << " identical Seltzer-Berger grid points";
+
+    if (alias_sampling)
+    {
+        // Build alias tables for sampling the exiting photon energy
+        auto& tables = host_data.differential_xs;
+        for (auto el_id : range(ElementId{materials.num_elements()}))
+        {
+            SBElementTableData table = tables.elements[el_id];
+            this->append_alias_tables(&table, &tables);
+            tables.elements[el_id] = table;
+        }
+    }
 
     // Move to mirrored data, copying to device
     data_ = CollectionMirror<SeltzerBergerData>{std::move(host_data)};
@@ -135,6 +152,13 @@ void SeltzerBergerModel::execute(ParamsHostCRef const& params,
 {
     generated::seltzer_berger_interact(this->host_ref(), params, states);
 }
+
+void SeltzerBergerModel::execute_chunk(ParamsHostCRef const& params,
+                                       StateHostRef& states,
+                                       Range<ThreadId> chunk) const
+{
+    generated::seltzer_berger_interact(this->host_ref(), params, states, chunk);
+}
 //!@}
 //---------------------------------------------------------------------------//
 /*!
@@ -152,12 +176,17 @@ ActionId SeltzerBergerModel::action_id() const
  * Here, x = log of scaled incident energy (E / MeV)
  * and y = scaled exiting energy (E_gamma / E_inc)
  * and values are the cross sections.
+ *
+ * The energy grids are the same for almost all elements (only Z = 100 has a
+ * different incident energy grid), so they are shared between tables.
  */
 void SeltzerBergerModel::append_table(ElementView const& element,
                                       ImportSBTable const& imported,
                                       HostXsTables* tables,
+                                      DedupeReals* grid_reals,
                                       Mass electron_mass) const
 {
+    CELER_EXPECT(grid_reals);
     auto reals = make_builder(&tables->reals);
 
     CELER_ASSERT(!imported.value.empty()
@@ -168,14 +197,13 @@ void SeltzerBergerModel::append_table(ElementView const& element,
 
     SBElementTableData table;
 
-    // TODO: hash the energy grid for reuse, because only Z = 100 has a
-    // different energy grid.
-
     // Incident charged particle log energy grid
-    table.grid.x = reals.insert_back(imported.x.begin(), imported.x.end());
+    table.grid.x
+        = grid_reals->insert_back(imported.x.begin(), imported.x.end());
 
     // Photon reduced energy grid
-    table.grid.y = reals.insert_back(imported.y.begin(), imported.y.end());
+    table.grid.y
+        = grid_reals->insert_back(imported.y.begin(), imported.y.end());
 
     // 2D scaled DCS grid
     table.grid.values
@@ -186,7 +214,7 @@ void SeltzerBergerModel::append_table(ElementView const& element,
     for (size_type i : range(num_x))
     {
         // Get the xs data for the given incident energy coordinate
-        real_type const* iter = &tables->reals[table.grid.at(i, 0)];
+        table_real_type const* iter = &tables->reals[table.grid.at(i, 0)];
 
         // Search for the highest cross section value
         size_type max_el = std::max_element(iter, iter + num_y) - iter;
@@ -232,5 +260,116 @@ void SeltzerBergerModel::append_table(ElementView const& element,
     CELER_ENSURE(table.grid);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct alias tables for sampling the reduced photon energy bin.
+ *
+ * The weight of each reduced energy bin \em j at incident energy grid point
+ * \em i is the bin's largest tabulated cross section multiplied by
+ * \f$ \ln(y_{j+1} / y_j) \f$, so that the weights bound the differential
+ * cross section sampled on a reciprocal distribution. A table is built for
+ * each starting bin (see \c SBElementTableData) using Vose's method.
+ */
+void SeltzerBergerModel::append_alias_tables(SBElementTableData* table,
+                                             HostXsTables* tables) const
+{
+    CELER_EXPECT(table && *table);
+    TwodGridData const& grid = table->grid;
+    const size_type num_x = grid.x.size();
+    const size_type num_bins = grid.y.size() - 1;
+    CELER_ASSERT(num_bins > 1);
+
+    std::vector<real_type> weight_sums;
+    std::vector<real_type> alias_prob;
+    std::vector<size_type> alias_index;
+    weight_sums.reserve(num_x * (num_bins + 1));
+    alias_prob.reserve(num_x * table->alias_block_size());
+    alias_index.reserve(alias_prob.capacity());
+
+    std::vector<double> weights(num_bins);
+    std::vector<double> scaled;
+    std::vector<size_type> small;
+    std::vector<size_type> large;
+    for (size_type i : range(num_x))
+    {
+        // Calculate the envelope weight of each bin
+        for (size_type j : range(num_bins))
+        {
+            double max_xs = std::max(tables->reals[grid.at(i, j)],
+                                     tables->reals[grid.at(i, j + 1)]);
+            double y_lo = tables->reals[grid.y[j]];
+            double y_hi = tables->reals[grid.y[j + 1]];
+            weights[j] = max_xs * std::log(y_hi / y_lo);
+            CELER_ASSERT(weights[j] >= 0);
+        }
+
+        // Calculate the total weight of the bins at and above each index
+        double total = 0;
+        auto sums_start = weight_sums.size();
+        weight_sums.resize(sums_start + num_bins + 1);
+        weight_sums[sums_start + num_bins] = 0;
+        for (size_type j = num_bins; j-- > 0;)
+        {
+            total += weights[j];
+            weight_sums[sums_start + j] = total;
+        }
+
+        // Build the alias table for each starting bin
+        for (size_type start : range(size_type{1}, num_bins))
+        {
+            const size_type n = num_bins - start;
+            double norm = weight_sums[sums_start + start];
+            scaled.assign(weights.begin() + start, weights.end());
+            for (double& w : scaled)
+            {
+                w = (norm > 0 ? w * n / norm : 1);
+            }
+
+            small.clear();
+            large.clear();
+            for (size_type k : range(n))
+            {
+                (scaled[k] < 1 ? small : large).push_back(k);
+            }
+
+            auto offset = alias_prob.size();
+            alias_prob.resize(offset + n, 1);
+            alias_index.resize(offset + n);
+            for (size_type k : range(n))
+            {
+                alias_index[offset + k] = start + k;
+            }
+            while (!small.empty() && !large.empty())
+            {
+                size_type s = small.back();
+                small.pop_back();
+                size_type l = large.back();
+                alias_prob[offset + s] = scaled[s];
+                alias_index[offset + s] = start + l;
+                scaled[l] -= 1 - scaled[s];
+                if (scaled[l] < 1)
+                {
+                    large.pop_back();
+                    small.push_back(l);
+                }
+            }
+            // Remaining entries (including roundoff) are always accepted
+        }
+    }
+
+    auto reals = make_builder(&tables->reals);
+    table->weight_sums
+        = reals.insert_back(weight_sums.begin(), weight_sums.end());
+    table->alias_prob = reals.insert_back(alias_prob.begin(), alias_prob.end());
+    table->alias_index = make_builder(&tables->sizes)
+                             .insert_back(alias_index.begin(),
+                                          alias_index.end());
+
+    CELER_ENSURE(table->weight_sums.size() == num_x * (num_bins + 1));
+    CELER_ENSURE(table->alias_prob.size()
+                 == num_x * table->alias_block_size());
+    CELER_ENSURE(table->has_alias());
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
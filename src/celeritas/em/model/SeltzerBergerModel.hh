@@ -11,6 +11,7 @@
 #include <memory>
 
 #include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/DedupeCollectionBuilder.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/em/data/SeltzerBergerData.hh"
 #include "celeritas/io/ImportSBTable.hh"
@@ -46,8 +47,12 @@ class ParticleParams;
  * energy spectra from electrons with kinetic energy 1 keV–10 GeV incident on
  * screened nuclei and orbital electrons of neutral atoms with Z = 1–100", At.
  * Data Nucl. Data Tables 35, 345–418.
+ *
+ * If \c alias_sampling is enabled, alias tables are built for each element
+ * and incident energy grid point so that the reduced photon energy interval
+ * can be selected in constant time (see \c SBAliasEnergyDistribution).
  */
-class SeltzerBergerModel final : public Model
+class SeltzerBergerModel final : public Model, public FusibleActionInterface
 {
   public:
     //!@{
@@ -64,7 +69,8 @@ class SeltzerBergerModel final : public Model
                        ParticleParams const& particles,
                        MaterialParams const& materials,
                        SPConstImported data,
-                       ReadData load_sb_table);
+                       ReadData load_sb_table,
+                       bool alias_sampling);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
@@ -75,6 +81,11 @@ class SeltzerBergerModel final : public Model
     // Apply the interaction kernel on device
     void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+    // Apply the interaction kernel to a chunk of threads on host
+    void execute_chunk(ParamsHostCRef const&,
+                       StateHostRef&,
+                       Range<ThreadId>) const final;
+
     // Apply the interaction kernel
     void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
@@ -103,10 +114,14 @@ class SeltzerBergerModel final : public Model
     ImportedModelAdapter imported_;
 
     using HostXsTables = HostVal<SeltzerBergerTableData>;
+    using DedupeReals = DedupeCollectionBuilder<table_real_type>;
     void append_table(ElementView const& element,
                       ImportSBTable const& table,
                       HostXsTables* tables,
+                      DedupeReals* grid_reals,
                       Mass electron_mass) const;
+    void append_alias_tables(SBElementTableData* table,
+                             HostXsTables* tables) const;
 };
 
 //---------------------------------------------------------------------------//
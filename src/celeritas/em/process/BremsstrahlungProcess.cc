@@ -52,20 +52,24 @@ auto BremsstrahlungProcess::build_models(ActionIdIter start_id) const
     if (options_.combined_model)
     {
         // TODO: import micro xs for combined model
-        return {std::make_shared<CombinedBremModel>(*start_id++,
-                                                    *particles_,
-                                                    *materials_,
-                                                    imported_.processes(),
-                                                    load_sb_,
-                                                    options_.enable_lpm)};
+        return {std::make_shared<CombinedBremModel>(
+            *start_id++,
+            *particles_,
+            *materials_,
+            imported_.processes(),
+            load_sb_,
+            options_.enable_lpm,
+            options_.sb_alias_sampling)};
     }
     else
     {
-        return {std::make_shared<SeltzerBergerModel>(*start_id++,
-                                                     *particles_,
-                                                     *materials_,
-                                                     imported_.processes(),
-                                                     load_sb_),
+        return {std::make_shared<SeltzerBergerModel>(
+                    *start_id++,
+                    *particles_,
+                    *materials_,
+                    imported_.processes(),
+                    load_sb_,
+                    options_.sb_alias_sampling),
                 std::make_shared<RelativisticBremModel>(*start_id++,
                                                         *particles_,
                                                         *materials_,
@@ -46,6 +46,8 @@ class BremsstrahlungProcess : public Process
                                 //! energies
         bool use_integral_xs{true};  //!> Use integral method for sampling
                                      //! discrete interaction length
+        bool sb_alias_sampling{false};  //!> Use alias tables to sample SB
+                                        //! photon energy
     };
 
   public:
@@ -0,0 +1,221 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/ext/GeantOrangeConverter.cc
+//---------------------------------------------------------------------------//
+#include "GeantOrangeConverter.hh"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <CLHEP/Units/SystemOfUnits.h>
+#include <G4Box.hh>
+#include <G4Cons.hh>
+#include <G4LogicalVolume.hh>
+#include <G4Orb.hh>
+#include <G4RotationMatrix.hh>
+#include <G4Sphere.hh>
+#include <G4ThreeVector.hh>
+#include <G4Tubs.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/io/ScopedTimeLog.hh"
+#include "orange/construct/VolumeTreeConverter.hh"
+#include "orange/construct/VolumeTreeInput.hh"
+
+#include "detail/GeantVolumeVisitor.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+static constexpr double scale = 0.1;  // G4 mm to native cm scale
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether an azimuthal or polar extent covers the full angle.
+ */
+bool is_full_angle(double delta, double full)
+{
+    return delta >= full * (1 - 1e-12);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a Geant4 solid to its ORANGE input definition.
+ */
+SolidInput convert_solid(G4VSolid const& solid)
+{
+    using Type = SolidInput::Type;
+
+    auto unsupported = [&solid](char const* why) {
+        CELER_LOG(error) << "Cannot convert Geant4 solid '" << solid.GetName()
+                         << "' of type " << solid.GetEntityType()
+                         << " to ORANGE: " << why;
+    };
+
+    SolidInput result;
+    if (auto* box = dynamic_cast<G4Box const*>(&solid))
+    {
+        result.type = Type::box;
+        result.params = {scale * box->GetXHalfLength(),
+                         scale * box->GetYHalfLength(),
+                         scale * box->GetZHalfLength()};
+    }
+    else if (auto* tube = dynamic_cast<G4Tubs const*>(&solid))
+    {
+        if (!is_full_angle(tube->GetDeltaPhiAngle(), CLHEP::twopi))
+        {
+            unsupported("partial azimuthal extent");
+            CELER_NOT_IMPLEMENTED("Geant4 tube segments in ORANGE");
+        }
+        result.type = Type::tube;
+        result.params = {scale * tube->GetInnerRadius(),
+                         scale * tube->GetOuterRadius(),
+                         scale * tube->GetZHalfLength()};
+    }
+    else if (auto* cone = dynamic_cast<G4Cons const*>(&solid))
+    {
+        if (!is_full_angle(cone->GetDeltaPhiAngle(), CLHEP::twopi))
+        {
+            unsupported("partial azimuthal extent");
+            CELER_NOT_IMPLEMENTED("Geant4 cone segments in ORANGE");
+        }
+        result.type = Type::cone;
+        result.params = {scale * cone->GetInnerRadiusMinusZ(),
+                         scale * cone->GetOuterRadiusMinusZ(),
+                         scale * cone->GetInnerRadiusPlusZ(),
+                         scale * cone->GetOuterRadiusPlusZ(),
+                         scale * cone->GetZHalfLength()};
+    }
+    else if (auto* orb = dynamic_cast<G4Orb const*>(&solid))
+    {
+        result.type = Type::sphere;
+        result.params = {0, scale * orb->GetRadius()};
+    }
+    else if (auto* sphere = dynamic_cast<G4Sphere const*>(&solid))
+    {
+        if (!is_full_angle(sphere->GetDeltaPhiAngle(), CLHEP::twopi)
+            || !is_full_angle(sphere->GetDeltaThetaAngle(), CLHEP::pi))
+        {
+            unsupported("partial angular extent");
+            CELER_NOT_IMPLEMENTED("Geant4 sphere sections in ORANGE");
+        }
+        result.type = Type::sphere;
+        result.params = {scale * sphere->GetInnerRadius(),
+                         scale * sphere->GetOuterRadius()};
+    }
+    else
+    {
+        unsupported("unsupported solid type");
+        CELER_NOT_IMPLEMENTED("Geant4 solid type in ORANGE");
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the Geant4-independent volume tree.
+ */
+class VolumeTreeBuilder
+{
+  public:
+    // Construct with a reference to the output
+    explicit VolumeTreeBuilder(VolumeTreeInput* tree) : tree_(*tree) {}
+
+    // Add a logical volume and its descendants, returning the index
+    size_type operator()(G4LogicalVolume const& lv);
+
+  private:
+    VolumeTreeInput& tree_;
+    std::unordered_map<G4LogicalVolume const*, size_type> indices_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add a logical volume and its descendants, returning the index.
+ */
+size_type VolumeTreeBuilder::operator()(G4LogicalVolume const& lv)
+{
+    auto&& [iter, inserted]
+        = indices_.emplace(&lv, static_cast<size_type>(tree_.logicals.size()));
+    if (!inserted)
+    {
+        // Logical volume has already been converted
+        return iter->second;
+    }
+    size_type const index = iter->second;
+
+    {
+        LogicalVolumeInput lv_input;
+        lv_input.label = Label::from_geant(
+            detail::GeantVolumeVisitor::generate_name(lv));
+        lv_input.solid = convert_solid(*lv.GetSolid());
+        tree_.logicals.push_back(std::move(lv_input));
+    }
+
+    std::vector<PlacementInput> daughters;
+    for (auto i : range(lv.GetNoDaughters()))
+    {
+        G4VPhysicalVolume const& pv = *lv.GetDaughter(i);
+        CELER_VALIDATE(!pv.IsReplicated() && !pv.IsParameterised(),
+                       << "replicated or parameterised volume '"
+                       << pv.GetName() << "' cannot be converted to ORANGE");
+
+        PlacementInput pl;
+        pl.label = Label::from_geant(pv.GetName());
+        pl.logical = (*this)(*pv.GetLogicalVolume());
+
+        G4ThreeVector const& t = pv.GetObjectTranslation();
+        pl.translation = {scale * t.x(), scale * t.y(), scale * t.z()};
+
+        G4RotationMatrix const r = pv.GetObjectRotationValue();
+        pl.rotation = {{{r.xx(), r.xy(), r.xz()},
+                        {r.yx(), r.yy(), r.yz()},
+                        {r.zx(), r.zy(), r.zz()}}};
+
+        daughters.push_back(std::move(pl));
+    }
+
+    // Daughters are assigned after recursion since the vector may reallocate
+    tree_.logicals[index].daughters = std::move(daughters);
+    return index;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert the world volume and its descendants.
+ *
+ * The placement of the world volume itself is ignored.
+ */
+OrangeInput
+GeantOrangeConverter::operator()(G4VPhysicalVolume const* world) const
+{
+    CELER_EXPECT(world);
+
+    CELER_LOG(status) << "Converting Geant4 geometry to ORANGE";
+    ScopedTimeLog scoped_time;
+
+    VolumeTreeInput tree;
+    VolumeTreeBuilder build_tree(&tree);
+    tree.world = build_tree(*world->GetLogicalVolume());
+
+    CELER_LOG(debug) << "Converted " << tree.logicals.size()
+                     << " logical volumes from Geant4";
+
+    VolumeTreeConverter convert;
+    return convert(tree);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,58 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/ext/GeantOrangeConverter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+#include "orange/construct/OrangeInput.hh"
+
+// Geant4 forward declaration
+class G4VPhysicalVolume;  // IWYU pragma: keep
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Convert an in-memory Geant4 geometry to an ORANGE input definition.
+ *
+ * Each logical volume with daughters becomes an ORANGE unit (see \c
+ * VolumeTreeConverter ), so the Geant4 volume hierarchy and daughter
+ * placements (including rotations) are preserved. Volume labels are generated
+ * the same way as for the imported GDML data so that \c GeantVolumeMapper can
+ * find them.
+ *
+ * Supported solids are boxes, full-azimuth tubes and cones, orbs, and full
+ * spheres. Other solids, replicas, and parameterised volumes will raise an
+ * exception.
+ *
+ * \code
+   auto world = load_gdml("cms.gdml");
+   auto geo = std::make_shared<OrangeParams>(
+       GeantOrangeConverter{}(world.get()));
+   \endcode
+ */
+class GeantOrangeConverter
+{
+  public:
+    // Convert the world volume and its descendants
+    OrangeInput operator()(G4VPhysicalVolume const* world) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+#if !CELERITAS_USE_GEANT4
+inline OrangeInput
+GeantOrangeConverter::operator()(G4VPhysicalVolume const*) const
+{
+    CELER_NOT_CONFIGURED("Geant4");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
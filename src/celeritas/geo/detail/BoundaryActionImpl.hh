@@ -38,6 +38,13 @@ inline CELER_FUNCTION void boundary_track(celeritas::CoreTrackView const& track)
     CELER_EXPECT(sim.status() == TrackStatus::alive);
 
     auto geo = track.make_geo_view();
+    if (geo.is_outside())
+    {
+        // Particle was moved out of the world without stopping on the
+        // boundary (e.g., by Woodcock tracking)
+        sim.status(TrackStatus::killed);
+        return;
+    }
     CELER_EXPECT(geo.is_on_boundary());
 
     // Particle entered a new volume before reaching the interaction point
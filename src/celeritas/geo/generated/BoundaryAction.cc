@@ -8,10 +8,12 @@
 //---------------------------------------------------------------------------//
 #include "BoundaryAction.hh"
 
+#include <exception>
 #include <utility>
 
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/global/KernelContextException.hh"
@@ -28,16 +30,37 @@ void BoundaryAction::execute(ParamsHostCRef const& params, StateHostRef& state)
 
     MultiExceptionHandler capture_exception;
     auto launch = make_track_launcher(params, state, detail::boundary_track);
+    auto const threads = action_thread_range(state, this->action_id());
     #pragma omp parallel for
-    for (size_type i = 0; i < state.size(); ++i)
+    for (size_type i = 0; i < threads.size(); ++i)
     {
+        ThreadId const tid = threads[i];
         CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{i}),
+            launch(tid),
             capture_exception,
-            KernelContextException(params, state, ThreadId{i}, this->label()));
+            KernelContextException(params, state, tid, this->label()));
     }
     log_and_rethrow(std::move(capture_exception));
 }
 
+void BoundaryAction::execute_chunk(ParamsHostCRef const& params,
+                              StateHostRef& state,
+                              Range<ThreadId> chunk) const
+{
+    auto launch = make_track_launcher(params, state, detail::boundary_track);
+    for (ThreadId tid : action_thread_range(state, this->action_id(), chunk))
+    {
+        try
+        {
+            launch(tid);
+        }
+        catch (...)
+        {
+            std::throw_with_nested(
+                KernelContextException(params, state, tid, this->label()));
+        }
+    }
+}
+
 }  // namespace generated
 }  // namespace celeritas
@@ -11,6 +11,7 @@
 #include "corecel/device_runtime_api.h"
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/KernelParamCalculator.device.hh"
 #include "corecel/sys/Device.hh"
 #include "celeritas/global/TrackLauncher.hh"
@@ -24,26 +25,32 @@ namespace
 {
 __global__ void boundary_kernel(
     DeviceCRef<CoreParamsData> const params,
-    DeviceRef<CoreStateData> const state
+    DeviceRef<CoreStateData> const state,
+    Range<ThreadId> const threads
 )
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < state.size()))
+    if (!(tid < threads.size()))
         return;
 
     auto launch = make_track_launcher(params, state, detail::boundary_track);
-    launch(tid);
+    launch(threads[tid.get()]);
 }
 }  // namespace
 
 void BoundaryAction::execute(ParamsDeviceCRef const& params, StateDeviceRef& state) const
 {
     CELER_EXPECT(params && state);
+    auto const threads = action_thread_range(state, this->action_id());
+    if (threads.empty())
+        return;
+
     CELER_LAUNCH_KERNEL(boundary,
                         celeritas::device().default_block_size(),
-                        state.size(),
+                        threads.size(),
                         params,
-                        state);
+                        state,
+                        threads);
 }
 
 }  // namespace generated
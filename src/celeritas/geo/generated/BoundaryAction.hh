@@ -18,7 +18,9 @@ namespace celeritas
 namespace generated
 {
 //---------------------------------------------------------------------------//
-class BoundaryAction final : public ExplicitActionInterface, public ConcreteAction
+class BoundaryAction final : public ExplicitActionInterface,
+                         public FusibleActionInterface,
+                         public ConcreteAction
 {
 public:
   // Construct with ID and label
@@ -27,6 +29,11 @@ public:
   // Launch kernel with host data
   void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+  // Execute on a chunk of threads with host data
+  void execute_chunk(ParamsHostCRef const&,
+                     StateHostRef&,
+                     Range<ThreadId> chunk) const final;
+
   // Launch kernel with device data
   void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
@@ -9,6 +9,8 @@
 
 #include <string>
 
+#include "corecel/cont/Range.hh"
+#include "corecel/sys/ThreadId.hh"
 #include "celeritas/Types.hh"  // IWYU pragma: export
 #include "celeritas/global/CoreTrackDataFwd.hh"  // IWYU pragma: export
 
@@ -89,6 +91,31 @@ class ExplicitActionInterface : public virtual ActionInterface
     ~ExplicitActionInterface() = default;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Mixin interface for an explicit action that acts on each track independently.
+ *
+ * An action with this interface can be applied on the host to a contiguous
+ * chunk of threads, so that a sequence of such actions can be fused into a
+ * single parallel loop over chunks (see \c detail::ActionSequence ). The chunk
+ * is a subset of the threads \c [0, state.num_threads) ; the action must
+ * restrict it to the threads it applies to. The chunk is executed serially
+ * and the first failure is rethrown with its thread context.
+ */
+class FusibleActionInterface
+{
+  public:
+    //! Execute the action on a chunk of threads with host data
+    virtual void execute_chunk(HostCRef<CoreParamsData> const&,
+                               HostRef<CoreStateData>&,
+                               Range<ThreadId> chunk) const
+        = 0;
+
+  protected:
+    // Protected destructor prevents deletion of pointer-to-interface
+    ~FusibleActionInterface() = default;
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Concrete mixin utility class for managing an action.
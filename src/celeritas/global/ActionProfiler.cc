@@ -0,0 +1,168 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/ActionProfiler.cc
+//---------------------------------------------------------------------------//
+#include "ActionProfiler.hh"
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// Histogram bins span 1 us to 10 s with four bins per decade
+constexpr int min_decade = -6;
+constexpr int num_decades = 7;
+constexpr int bins_per_decade = 4;
+constexpr int num_edges = num_decades * bins_per_decade + 1;
+
+//---------------------------------------------------------------------------//
+//! Get the histogram bin for an elapsed time, including under/overflow
+size_type find_bin(double seconds)
+{
+    if (!(seconds > 0))
+    {
+        return 0;
+    }
+    double idx = std::floor((std::log10(seconds) - min_decade)
+                            * bins_per_decade);
+    if (idx < 0)
+    {
+        return 0;
+    }
+    if (idx >= num_edges - 1)
+    {
+        return num_edges;
+    }
+    return static_cast<size_type>(idx) + 1;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct for a number of actions.
+ */
+ActionProfiler::ActionProfiler(size_type num_actions)
+{
+    CELER_EXPECT(num_actions > 0);
+
+    results_.resize(num_actions);
+    for (Result& r : results_)
+    {
+        r.time_hist.assign(num_edges + 1, 0);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the elapsed time of a host action.
+ */
+void ActionProfiler::record(size_type action,
+                            double seconds,
+                            size_type num_tracks)
+{
+    CELER_EXPECT(action < results_.size());
+
+    Result& r = results_[action];
+    ++r.num_calls;
+    r.num_tracks += num_tracks;
+    r.time += seconds;
+    ++r.time_hist[find_bin(seconds)];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start timing a device action.
+ *
+ * The previous measurement for this action is collected first, since the
+ * events are reused. By then the device has usually finished the previous
+ * step so collecting it does not block.
+ */
+void ActionProfiler::start(size_type action)
+{
+    CELER_EXPECT(action < results_.size());
+
+    if (timers_.empty())
+    {
+        timers_.resize(results_.size());
+        pending_tracks_.assign(results_.size(), 0);
+        pending_.assign(results_.size(), false);
+    }
+    else if (pending_[action])
+    {
+        this->collect(action);
+    }
+    timers_[action].start();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Finish timing a device action.
+ */
+void ActionProfiler::stop(size_type action, size_type num_tracks)
+{
+    CELER_EXPECT(action < timers_.size());
+    CELER_EXPECT(!pending_[action]);
+
+    timers_[action].stop();
+    pending_tracks_[action] = num_tracks;
+    pending_[action] = true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Collect outstanding device timings and get the results.
+ */
+auto ActionProfiler::results() -> VecResult const&
+{
+    for (auto action : range(pending_.size()))
+    {
+        if (pending_[action])
+        {
+            this->collect(action);
+        }
+    }
+    return results_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the edges of the interior histogram bins [s].
+ *
+ * Histograms have one more bin than there are edges: the first bin is below
+ * the first edge and the last is above the last edge.
+ */
+auto ActionProfiler::bin_edges() -> VecDouble
+{
+    VecDouble result(num_edges);
+    for (auto i : range(num_edges))
+    {
+        result[i] = std::pow(10.0,
+                             min_decade
+                                 + static_cast<double>(i) / bins_per_decade);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Collect the result from a device timer.
+ */
+void ActionProfiler::collect(size_type action)
+{
+    CELER_EXPECT(pending_[action]);
+    this->record(action, timers_[action](), pending_tracks_[action]);
+    pending_[action] = false;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
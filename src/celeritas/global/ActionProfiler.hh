@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/ActionProfiler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/sys/EventTimer.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate the elapsed time and number of tracks for a sequence of actions.
+ *
+ * Host actions are timed by the caller and recorded directly. Device actions
+ * are bracketed by event timers so that the stepping loop is never
+ * synchronized: the elapsed time of a device action is collected the next
+ * time the action starts (when the device has almost always finished it) or
+ * when the results are requested.
+ *
+ * Device timers are only created when the first device action is started.
+ *
+ * Besides the totals, the elapsed time of every call (i.e., every step) is
+ * tallied in a histogram with logarithmically spaced bins. The first and last
+ * bins collect calls faster or slower than the bin edges.
+ */
+class ActionProfiler
+{
+  public:
+    //! Accumulated results for a single action
+    struct Result
+    {
+        size_type num_calls{0};  //!< Number of steps the action ran
+        size_type num_tracks{0};  //!< Cumulative active tracks
+        double time{0};  //!< Cumulative elapsed time [s]
+        std::vector<size_type> time_hist;  //!< Calls binned by elapsed time
+    };
+
+    //!@{
+    //! \name Type aliases
+    using VecResult = std::vector<Result>;
+    using VecDouble = std::vector<double>;
+    //!@}
+
+  public:
+    // Construct for a number of actions
+    explicit ActionProfiler(size_type num_actions);
+
+    // Record the elapsed time of a host action
+    void record(size_type action, double seconds, size_type num_tracks);
+
+    // Start timing a device action
+    void start(size_type action);
+
+    // Finish timing a device action
+    void stop(size_type action, size_type num_tracks);
+
+    // Collect outstanding device timings and get the results
+    VecResult const& results();
+
+    // Get the edges of the interior histogram bins [s]
+    static VecDouble bin_edges();
+
+    //! Number of actions being profiled
+    size_type num_actions() const { return results_.size(); }
+
+  private:
+    VecResult results_;
+    std::vector<EventTimer> timers_;
+    std::vector<size_type> pending_tracks_;
+    std::vector<bool> pending_;
+
+    // Collect the result from a device timer
+    void collect(size_type action);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
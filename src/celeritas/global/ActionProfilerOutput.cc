@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/ActionProfilerOutput.cc
+//---------------------------------------------------------------------------//
+#include "ActionProfilerOutput.hh"
+
+#include <utility>
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+#include "corecel/io/JsonPimpl.hh"
+
+#include "ActionProfiler.hh"
+#if CELERITAS_USE_JSON
+#    include <nlohmann/json.hpp>
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a profiler and the labels of the profiled actions.
+ */
+ActionProfilerOutput::ActionProfilerOutput(SPActionProfiler profiler,
+                                           VecString action_labels,
+                                           std::string label)
+    : profiler_(std::move(profiler))
+    , action_labels_(std::move(action_labels))
+    , label_(std::move(label))
+{
+    CELER_EXPECT(profiler_);
+    CELER_EXPECT(action_labels_.size() == profiler_->num_actions());
+    CELER_EXPECT(!label_.empty());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write output to the given JSON object.
+ *
+ * Outstanding device timings are collected, waiting on the device if needed.
+ */
+void ActionProfilerOutput::output(JsonPimpl* j) const
+{
+#if CELERITAS_USE_JSON
+    using json = nlohmann::json;
+
+    auto const& results = profiler_->results();
+
+    auto num_calls = json::array();
+    auto num_tracks = json::array();
+    auto time = json::array();
+    auto throughput = json::array();
+    auto time_hist = json::array();
+    for (auto const& r : results)
+    {
+        num_calls.push_back(r.num_calls);
+        num_tracks.push_back(r.num_tracks);
+        time.push_back(r.time);
+        throughput.push_back(r.time > 0 ? r.num_tracks / r.time : 0.0);
+        time_hist.push_back(r.time_hist);
+    }
+
+    j->obj = {
+        {"label", action_labels_},
+        {"num_calls", std::move(num_calls)},
+        {"num_tracks", std::move(num_tracks)},
+        {"time", std::move(time)},
+        {"throughput", std::move(throughput)},
+        {"time_hist", std::move(time_hist)},
+        {"bin_edges", ActionProfiler::bin_edges()},
+    };
+#else
+    (void)sizeof(j);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
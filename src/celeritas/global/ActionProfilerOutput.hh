@@ -0,0 +1,57 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/ActionProfilerOutput.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "corecel/io/OutputInterface.hh"
+
+namespace celeritas
+{
+class ActionProfiler;
+//---------------------------------------------------------------------------//
+/*!
+ * Save per-action elapsed times, track counts, and timing histograms.
+ *
+ * The throughput of each action is the number of tracks it processed per
+ * second of elapsed time.
+ */
+class ActionProfilerOutput final : public OutputInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPActionProfiler = std::shared_ptr<ActionProfiler>;
+    using VecString = std::vector<std::string>;
+    //!@}
+
+  public:
+    // Construct from a profiler and the labels of the profiled actions
+    ActionProfilerOutput(SPActionProfiler profiler,
+                         VecString action_labels,
+                         std::string label);
+
+    //! Category of data to write
+    Category category() const final { return Category::result; }
+
+    //! Name of the entry inside the category.
+    std::string label() const final { return label_; }
+
+    // Write output to the given JSON object
+    void output(JsonPimpl*) const final;
+
+  private:
+    SPActionProfiler profiler_;
+    VecString action_labels_;
+    std::string label_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -15,6 +15,7 @@
 #include "corecel/Assert.hh"
 #include "corecel/data/Ref.hh"
 #include "corecel/io/BuildOutput.hh"
+#include "corecel/io/MultiStreamOutput.hh"
 #include "corecel/io/OutputRegistry.hh"  // IWYU pragma: keep
 #include "corecel/sys/Device.hh"
 #include "corecel/sys/Environment.hh"
@@ -34,9 +35,11 @@
 #include "celeritas/phys/PhysicsParams.hh"  // IWYU pragma: keep
 #include "celeritas/phys/PhysicsParamsOutput.hh"
 #include "celeritas/random/RngParams.hh"  // IWYU pragma: keep
+#include "celeritas/track/CompactTracksAction.hh"
 #include "celeritas/track/ExtendFromSecondariesAction.hh"
 #include "celeritas/track/InitializeTracksAction.hh"
 #include "celeritas/track/SimParams.hh"  // IWYU pragma: keep
+#include "celeritas/track/SortTracksAction.hh"
 #include "celeritas/track/TrackInitParams.hh"  // IWYU pragma: keep
 
 #include "ActionInterface.hh"
@@ -160,6 +163,27 @@ CoreParams::CoreParams(Input input) : input_(std::move(input))
     input_.action_reg->insert(std::make_shared<ExtendFromSecondariesAction>(
         input_.action_reg->next_id()));
 
+    if (input_.init->compaction_threshold() > 0)
+    {
+        // Construct action to pack live tracks after extending from
+        // secondaries
+        input_.action_reg->insert(std::make_shared<CompactTracksAction>(
+            input_.action_reg->next_id()));
+    }
+
+    switch (auto track_order = input_.init->track_order())
+    {
+        case TrackOrder::sort_step_limit_action:
+        case TrackOrder::partition_charge:
+        case TrackOrder::sort_particle_energy:
+            // Construct action to reorder tracks before along- or post-step
+            input_.action_reg->insert(std::make_shared<SortTracksAction>(
+                input_.action_reg->next_id(), track_order));
+            break;
+        default:
+            break;
+    }
+
     // Save host reference
     host_ref_ = build_params_refs<MemSpace::host>(input_, scalars);
     if (celeritas::device())
@@ -195,6 +219,19 @@ CoreParams::CoreParams(Input input) : input_(std::move(input))
     input_.output_reg->insert(
         std::make_shared<ActionRegistryOutput>(input_.action_reg));
 
+    // Combine the output from each stream's stepper, which may be constructed
+    // concurrently on other threads
+    action_profiles_ = std::make_shared<MultiStreamOutput>(
+        OutputInterface::Category::result,
+        "action-profile",
+        input_.max_streams);
+    input_.output_reg->insert(action_profiles_);
+    stepper_diagnostics_ = std::make_shared<MultiStreamOutput>(
+        OutputInterface::Category::result,
+        "stepper-diagnostics",
+        input_.max_streams);
+    input_.output_reg->insert(stepper_diagnostics_);
+
     CELER_ENSURE(host_ref_);
     CELER_ENSURE(host_ref_.scalars.max_streams == this->max_streams());
 }
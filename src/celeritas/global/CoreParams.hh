@@ -25,6 +25,7 @@ class CutoffParams;
 class FluctuationParams;
 class GeoMaterialParams;
 class MaterialParams;
+class MultiStreamOutput;
 class OutputRegistry;
 class ParticleParams;
 class PhysicsParams;
@@ -51,6 +52,7 @@ class CoreParams
     using SPConstTrackInit = std::shared_ptr<TrackInitParams const>;
     using SPActionRegistry = std::shared_ptr<ActionRegistry>;
     using SPOutputRegistry = std::shared_ptr<OutputRegistry>;
+    using SPStreamOutput = std::shared_ptr<MultiStreamOutput>;
 
     using HostRef = HostCRef<CoreParamsData>;
     using DeviceRef = DeviceCRef<CoreParamsData>;
@@ -114,8 +116,19 @@ class CoreParams
     //! Maximum number of streams
     size_type max_streams() const { return input_.max_streams; }
 
+    //! Per-stream action profiles, written as "action-profile"
+    SPStreamOutput const& action_profiles() const { return action_profiles_; }
+
+    //! Per-stream step diagnostics, written as "stepper-diagnostics"
+    SPStreamOutput const& stepper_diagnostics() const
+    {
+        return stepper_diagnostics_;
+    }
+
   private:
     Input input_;
+    SPStreamOutput action_profiles_;
+    SPStreamOutput stepper_diagnostics_;
     HostRef host_ref_;
     DeviceRef device_ref_;
 };
@@ -36,6 +36,7 @@ void resize(CoreStateData<Ownership::value, M>* state,
     resize(&state->sim, size);
     resize(&state->init, params.init, size);
     resize(&state->track_slots, size);
+    state->num_threads = size;
     state->stream_id = stream_id;
 
     Span track_slots{state->track_slots[AllItems<TrackSlotId::size_type, M>{}]};
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
 #include "celeritas/geo/GeoData.hh"
 #include "celeritas/geo/GeoMaterialData.hh"
 #include "celeritas/mat/MaterialData.hh"
@@ -99,6 +100,9 @@ struct CoreStateData
     template<class T>
     using ThreadItems = Collection<T, W, M, ThreadId>;
 
+    template<class T>
+    using HostActionItems = Collection<T, W, MemSpace::host, ActionId>;
+
     GeoStateData<W, M> geometry;
     MaterialStateData<W, M> materials;
     ParticleStateData<W, M> particles;
@@ -108,6 +112,12 @@ struct CoreStateData
     TrackInitStateData<W, M> init;
     ThreadItems<TrackSlotId::size_type> track_slots;
 
+    //! First thread for each action if partitioned (always on host)
+    HostActionItems<ThreadId::size_type> thread_offsets;
+
+    //! Number of leading threads to launch (less than size if compacted)
+    ThreadId::size_type num_threads{0};
+
     //! Unique identifier for "thread-local" data.
     StreamId stream_id;
 
@@ -134,6 +144,8 @@ struct CoreStateData
         sim = other.sim;
         init = other.init;
         track_slots = other.track_slots;
+        thread_offsets = other.thread_offsets;
+        num_threads = other.num_threads;
         stream_id = other.stream_id;
         return *this;
     }
@@ -172,5 +184,55 @@ void resize(CoreStateData<Ownership::value, M>* state,
             StreamId stream_id,
             size_type size);
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the range of threads whose tracks are about to undergo an action.
+ *
+ * If the track slots have been partitioned by post-step action (see
+ * \c TrackOrder::sort_step_limit_action ) this is the contiguous subset of
+ * threads for the given action; otherwise it is every thread that may point
+ * to a live track (see \c CompactTracksAction ).
+ */
+template<MemSpace M>
+inline Range<ThreadId>
+action_thread_range(CoreStateData<Ownership::reference, M> const& state,
+                    ActionId action)
+{
+    CELER_EXPECT(action);
+    if (state.thread_offsets.empty())
+    {
+        return range(ThreadId{state.num_threads});
+    }
+
+    CELER_ASSERT(action + 1 < state.thread_offsets.size());
+    return range(ThreadId{state.thread_offsets[action]},
+                 ThreadId{state.thread_offsets[action + 1]});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the threads in a chunk that apply to the given action.
+ *
+ * This is used when executing a fused sequence of actions over chunks of
+ * threads (see \c FusibleActionInterface ).
+ */
+template<MemSpace M>
+inline Range<ThreadId>
+action_thread_range(CoreStateData<Ownership::reference, M> const& state,
+                    ActionId action,
+                    Range<ThreadId> chunk)
+{
+    auto threads = action_thread_range(state, action);
+    ThreadId begin = *chunk.begin() < *threads.begin() ? *threads.begin()
+                                                       : *chunk.begin();
+    ThreadId end = *threads.end() < *chunk.end() ? *threads.end()
+                                                 : *chunk.end();
+    if (end < begin)
+    {
+        end = begin;
+    }
+    return range(begin, end);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
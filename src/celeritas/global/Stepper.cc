@@ -7,19 +7,30 @@
 //---------------------------------------------------------------------------//
 #include "Stepper.hh"
 
+#include <cmath>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "corecel/cont/Range.hh"
+#include "corecel/data/Copier.hh"
 #include "corecel/data/Ref.hh"
+#include "corecel/io/MultiStreamOutput.hh"
+#include "corecel/io/OutputRegistry.hh"
+#include "corecel/sys/Stopwatch.hh"
 #include "orange/OrangeData.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/random/XorwowRngData.hh"
 #include "celeritas/track/TrackInitData.hh"
 #include "celeritas/track/TrackInitUtils.hh"
 #include "celeritas/track/TrackInitParams.hh"
+#include "celeritas/track/detail/TrackInitAlgorithms.hh"
 
+#include "ActionProfilerOutput.hh"
+#include "ActionRegistry.hh"
 #include "CoreParams.hh"
+#include "StepperDiagnostics.hh"
 #include "detail/ActionSequence.hh"
 
 namespace celeritas
@@ -35,20 +46,85 @@ Stepper<M>::Stepper(Input input) : params_(std::move(input.params))
     CELER_VALIDATE(input.stream_id, << "stream ID is not set");
     CELER_VALIDATE(input.num_track_slots > 0,
                    << "number of track slots is not set");
-    states_ = CollectionStateStore<CoreStateData, M>(
-        params_->host_ref(), input.stream_id, input.num_track_slots);
+    CELER_VALIDATE(input.min_active_fraction >= 0
+                       && input.min_active_fraction < 1,
+                   << "invalid minimum active fraction "
+                   << input.min_active_fraction
+                   << " (must be in [0, 1))");
 
     // Create action sequence
     {
         ActionSequence::Options opts;
         opts.sync = input.sync;
+        opts.fused_chunk_size = input.fused_chunk_size;
+        opts.profile = input.profile;
         actions_
             = std::make_shared<ActionSequence>(*params_->action_reg(), opts);
     }
 
+    {
+        CoreStateData<Ownership::value, M> states;
+        resize(&states,
+               params_->host_ref(),
+               input.stream_id,
+               input.num_track_slots);
+        if (input.rng_substream > 0)
+        {
+            // Use random streams disjoint from other states on this stream
+            auto const& scalars = params_->host_ref().scalars;
+            resize(&states.rng,
+                   params_->host_ref().rng,
+                   StreamId{input.stream_id.get()
+                            + input.rng_substream * scalars.max_streams},
+                   input.num_track_slots);
+        }
+        if (params_->init()->track_order()
+            == TrackOrder::sort_step_limit_action)
+        {
+            // Allocate the thread offsets for every action in the sequence
+            // plus inactive
+            resize(&states.thread_offsets, actions_->num_actions() + 1);
+        }
+
+        // Spill excess initializers to a backlog owned by this stepper
+        backlog_ = std::make_unique<std::vector<TrackInitializer>>();
+        states.init.backlog = backlog_.get();
+        states_ = CollectionStateStore<CoreStateData, M>(std::move(states));
+    }
+
+    if (auto const& profiler = actions_->profiler())
+    {
+        // Save per-action timing to this stream's output
+        std::vector<std::string> labels;
+        for (auto const& action : actions_->actions())
+        {
+            labels.push_back(action->label());
+        }
+        params_->action_profiles()->set(
+            input.stream_id,
+            std::make_shared<ActionProfilerOutput>(
+                profiler, std::move(labels), "action-profile"));
+    }
+
+    if (input.diagnostics)
+    {
+        // Save per-step occupancy and timing to this stream's output
+        diagnostics_ = std::make_shared<StepperDiagnostics>(
+            input.num_track_slots,
+            "stepper-diagnostics",
+            input.max_diagnostic_samples);
+        params_->stepper_diagnostics()->set(input.stream_id, diagnostics_);
+    }
+
+    // Allocate per-event counts once rather than every step
+    resize(&event_counts_, params_->init()->max_events());
+
     core_ref_.params = get_ref<M>(*params_);
     core_ref_.states = states_.ref();
 
+    min_alive_ = static_cast<size_type>(
+        std::ceil(input.min_active_fraction * input.num_track_slots));
+
     CELER_ENSURE(actions_ && *actions_);
 }
 
@@ -69,6 +145,7 @@ auto Stepper<M>::operator()() -> result_type
 {
     CELER_EXPECT(*this);
 
+    Stopwatch get_step_time;
     actions_->execute(core_ref_.params, core_ref_.states);
 
     // Get the number of track initializers and active tracks
@@ -76,6 +153,24 @@ auto Stepper<M>::operator()() -> result_type
     result.active = core_ref_.states.init.num_active;
     result.alive = states_.size() - core_ref_.states.init.vacancies.size();
     result.queued = core_ref_.states.init.initializers.size();
+    result.backlog = core_ref_.states.init.num_backlog;
+    result.secondaries = core_ref_.states.init.num_secondaries;
+
+    if (result.alive > 0 && result.alive < min_alive_ && result.queued == 0
+        && result.backlog == 0)
+    {
+        // Stop stepping a nearly empty state: remove the remaining tracks
+        auto extracted = extract_tracks(core_ref_.params, core_ref_.states);
+        CELER_ASSERT(extracted.size() == result.alive);
+        result.tail = extracted.size();
+        result.alive = 0;
+        tail_.insert(tail_.end(), extracted.begin(), extracted.end());
+    }
+
+    if (diagnostics_)
+    {
+        diagnostics_->record(result, get_step_time());
+    }
 
     return result;
 }
@@ -113,6 +208,83 @@ auto Stepper<M>::operator()(SpanConstPrimary primaries) -> result_type
     return (*this)();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Count the active and queued tracks for each event.
+ *
+ * The tracks are counted where the state lives, so only the per-event counts
+ * are copied to the host. Track initializers that have been spilled to the
+ * host backlog (see \c StepperResult::backlog) are not counted.
+ */
+template<MemSpace M>
+auto Stepper<M>::count_tracks_by_event() -> VecCount
+{
+    CELER_EXPECT(*this);
+
+    auto const& states = core_ref_.states;
+    auto counts = event_counts_[AllItems<size_type, M>{}];
+
+    using InitId = ItemId<TrackInitializer>;
+    detail::count_tracks_by_event<M>(
+        states.sim.status[AllItems<TrackStatus, M>{}],
+        states.sim.event_ids[AllItems<EventId, M>{}],
+        states.init.initializers.storage[ItemRange<TrackInitializer>{
+            InitId{0}, InitId{states.init.initializers.size()}}],
+        counts);
+
+    VecCount result(counts.size());
+    Copier<size_type, M>{counts}(MemSpace::host, make_span(result));
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Take the tracks removed from the state by the tail policy.
+ *
+ * The returned tracks can be transported with a different stepper using \c
+ * insert_tail . The result also contains the current per-event track
+ * counters, so it can be used to synchronize the counters of two steppers
+ * even if no tracks were extracted.
+ */
+template<MemSpace M>
+StepperTail Stepper<M>::release_tail()
+{
+    CELER_EXPECT(*this);
+
+    StepperTail result;
+    std::swap(result.tracks, tail_);
+    result.track_counters = get_track_counters(core_ref_.states);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Queue tracks released by another stepper.
+ *
+ * The track counters are raised to those of the other stepper so that
+ * secondaries created here get new track IDs. The tracks keep their IDs and
+ * are initialized at the start of the next step.
+ */
+template<MemSpace M>
+void Stepper<M>::insert_tail(StepperTail const& tail)
+{
+    CELER_EXPECT(*this);
+    CELER_EXPECT(tail.track_counters.size() == params_->init()->max_events());
+
+    merge_track_counters(core_ref_.states, make_span(tail.track_counters));
+    if (tail.tracks.empty())
+    {
+        return;
+    }
+
+    auto const& inits = core_ref_.states.init.initializers;
+    CELER_VALIDATE(tail.tracks.size() + inits.size() <= inits.capacity(),
+                   << "insufficient initializer capacity (" << inits.capacity()
+                   << ") with size (" << inits.size() << ") for tail tracks ("
+                   << tail.tracks.size() << ")");
+    extend_from_initializers(core_ref_.states, make_span(tail.tracks));
+}
+
 //---------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATION
 //---------------------------------------------------------------------------//
@@ -25,6 +25,7 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 class CoreParams;
 struct Primary;
+class StepperDiagnostics;
 
 namespace detail
 {
@@ -39,6 +40,24 @@ class ActionSequence;
  * - \c num_track_slots : Maximum number of threads to run in parallel on GPU
  *   \c stream_id : Unique (thread/task) ID for this process
  * - \c sync : Whether to synchronize device between actions
+ * - \c min_active_fraction : Fraction of track slots below which the
+ *   remaining tracks are removed from the state once no more initializers are
+ *   pending (zero to disable)
+ * - \c fused_chunk_size : Number of tracks per chunk when fusing consecutive
+ *   per-track actions on host (zero to disable)
+ * - \c profile : Record the per-step time and active track count of each
+ *   action and add them to this stream's entry in the "action-profile" output (see
+ *   \c CoreParams::action_profiles ), replacing the profile of any earlier
+ *   stepper on the same stream
+ * - \c diagnostics : Record the occupancy, queue depth, and wall time of each
+ *   step and add them to this stream's entry in the "stepper-diagnostics"
+ *   output (see \c CoreParams::stepper_diagnostics ), replacing those of any
+ *   earlier stepper on the same stream
+ * - \c max_diagnostic_samples : Maximum number of steps to store before
+ *   down-sampling the diagnostics (zero for unlimited)
+ * - \c rng_substream : Offset for seeding the random number streams of a
+ *   second state on the same stream (e.g. one that finishes the tail of
+ *   another stepper), so that its random sequence differs from the first
  */
 struct StepperInput
 {
@@ -46,26 +65,58 @@ struct StepperInput
     StreamId stream_id{};
     size_type num_track_slots{};
     bool sync{false};
+    real_type min_active_fraction{0};
+    size_type fused_chunk_size{0};
+    bool profile{false};
+    bool diagnostics{false};
+    size_type max_diagnostic_samples{0};
+    size_type rng_substream{0};
 
     //! True if defined
     explicit operator bool() const
     {
-        return params && stream_id && num_track_slots > 0;
+        return params && stream_id && num_track_slots > 0
+               && min_active_fraction >= 0 && min_active_fraction < 1;
     }
 };
 
 //---------------------------------------------------------------------------//
 /*!
  * Track counters for a step.
+ *
+ * If the stepper's tail policy removed the remaining tracks from the state,
+ * \c tail is nonzero and the tracks must be retrieved with
+ * \c StepperInterface::release_tail .
  */
 struct StepperResult
 {
     size_type queued{};  //!< Pending track initializers at end of step
     size_type active{};  //!< Active tracks at start of step
     size_type alive{};  //!< Active and alive at end of step
+    size_type backlog{};  //!< Track initializers spilled to host at end of step
+    size_type tail{};  //!< Tracks removed by the tail policy at end of step
+    size_type secondaries{};  //!< Secondaries queued as initializers
 
     //! True if more steps need to be run
-    explicit operator bool() const { return queued > 0 || alive > 0; }
+    explicit operator bool() const
+    {
+        return queued > 0 || alive > 0 || backlog > 0;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tracks removed from a stepper's state by the tail policy.
+ *
+ * The track initializers keep the track, parent, and event IDs of the
+ * extracted tracks. The per-event track counters are those of the state they
+ * were removed from, so that a stepper that transports the tail creates
+ * secondaries whose IDs don't collide with the original tracks.
+ */
+struct StepperTail
+{
+    std::vector<TrackInitializer> tracks;
+    std::vector<TrackId::size_type> track_counters;
 };
 
 //---------------------------------------------------------------------------//
@@ -79,6 +130,7 @@ class StepperInterface
     using ActionSequence = detail::ActionSequence;
     using SpanConstPrimary = Span<Primary const>;
     using result_type = StepperResult;
+    using VecCount = std::vector<size_type>;
     //!@}
 
   public:
@@ -94,6 +146,15 @@ class StepperInterface
     //! Get action sequence for timing diagnostics
     virtual ActionSequence const& actions() const = 0;
 
+    //! Count the active and queued tracks for each event
+    virtual VecCount count_tracks_by_event() = 0;
+
+    //! Take the tracks removed from the state by the tail policy
+    virtual StepperTail release_tail() = 0;
+
+    //! Queue tracks released by another stepper
+    virtual void insert_tail(StepperTail const& tail) = 0;
+
   protected:
     // Protected destructor prevents deletion of pointer-to-interface
     ~StepperInterface() = default;
@@ -114,6 +175,26 @@ class StepperInterface
        alive_tracks = step();
    }
    \endcode
+ *
+ * If \c min_active_fraction is set, the stepper stops transporting a nearly
+ * empty state: when no initializers are queued (on device or in the backlog)
+ * and the fraction of occupied track slots drops below the threshold, the
+ * surviving tracks are removed from the state and returned to the caller
+ * through \c release_tail . They can be finished by a second stepper (whose
+ * \c rng_substream differs) with \c insert_tail , which also keeps the track
+ * IDs of both steppers unique.
+ * \code
+   while (alive_tracks)
+   {
+       alive_tracks = step();
+   }
+   tail_step.insert_tail(step.release_tail());
+   while (tail_step())
+   {
+   }
+   // Update track counters for further events in the original stepper
+   step.insert_tail(tail_step.release_tail());
+   \endcode
  */
 template<MemSpace M>
 class Stepper final : public StepperInterface
@@ -146,9 +227,24 @@ class Stepper final : public StepperInterface
     //! Get action sequence for timing diagnostics
     ActionSequence const& actions() const final { return *actions_; }
 
+    // Count the active and queued tracks for each event
+    VecCount count_tracks_by_event() final;
+
+    // Take the tracks removed from the state by the tail policy
+    StepperTail release_tail() final;
+
+    // Queue tracks released by another stepper
+    void insert_tail(StepperTail const& tail) final;
+
     //! Access core data for debugging
     CoreRef<M> const& core_data() const { return core_ref_; }
 
+    //! Get the step diagnostics (null unless 'diagnostics' is enabled)
+    std::shared_ptr<StepperDiagnostics const> diagnostics() const
+    {
+        return diagnostics_;
+    }
+
   private:
     // Params and call sequence
     std::shared_ptr<CoreParams const> params_;
@@ -157,8 +253,21 @@ class Stepper final : public StepperInterface
     // State data
     CollectionStateStore<CoreStateData, M> states_;
 
+    // Host storage for initializers spilled from the state
+    std::unique_ptr<std::vector<TrackInitializer>> backlog_;
+
     // Combined param/state for action calls
     CoreRef<M> core_ref_;
+
+    // Per-event track counts, reused every step
+    Collection<size_type, Ownership::value, M> event_counts_;
+
+    // Tail policy and extracted tracks
+    size_type min_alive_{0};
+    std::vector<TrackInitializer> tail_;
+
+    // Per-step occupancy and timing
+    std::shared_ptr<StepperDiagnostics> diagnostics_;
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,133 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/StepperDiagnostics.cc
+//---------------------------------------------------------------------------//
+#include "StepperDiagnostics.hh"
+
+#include <utility>
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/JsonPimpl.hh"
+
+#include "Stepper.hh"
+#if CELERITAS_USE_JSON
+#    include <nlohmann/json.hpp>
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with state size, output label, and sampling limit.
+ */
+StepperDiagnostics::StepperDiagnostics(size_type num_track_slots,
+                                       std::string label,
+                                       size_type max_samples)
+    : num_track_slots_(num_track_slots)
+    , label_(std::move(label))
+    , max_samples_(max_samples)
+{
+    CELER_EXPECT(num_track_slots_ > 0);
+    CELER_EXPECT(!label_.empty());
+    CELER_VALIDATE(max_samples_ != 1,
+                   << "invalid maximum number of stepper diagnostic samples "
+                   << max_samples_ << " (must be 0 or at least 2)");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the result of a step.
+ */
+void StepperDiagnostics::record(StepperResult const& result, double seconds)
+{
+    size_type step = num_steps_++;
+    time_ += seconds;
+    num_track_steps_ += result.active;
+
+    if (step % stride_ != 0)
+    {
+        return;
+    }
+
+    Sample s;
+    s.step = step;
+    s.active = result.active;
+    s.alive = result.alive;
+    s.queued = result.queued;
+    s.secondaries = result.secondaries;
+    s.time = seconds;
+    samples_.push_back(s);
+
+    if (samples_.size() == max_samples_)
+    {
+        // Keep the samples that are on the coarser stride
+        size_type dst = 0;
+        for (size_type src = 0; src < samples_.size(); src += 2)
+        {
+            samples_[dst++] = samples_[src];
+        }
+        samples_.resize(dst);
+        stride_ *= 2;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write output to the given JSON object.
+ */
+void StepperDiagnostics::output(JsonPimpl* j) const
+{
+#if CELERITAS_USE_JSON
+    using json = nlohmann::json;
+
+    auto step = json::array();
+    auto active = json::array();
+    auto alive = json::array();
+    auto queued = json::array();
+    auto secondaries = json::array();
+    auto time = json::array();
+    auto occupancy = json::array();
+    auto throughput = json::array();
+    for (Sample const& s : samples_)
+    {
+        step.push_back(s.step);
+        active.push_back(s.active);
+        alive.push_back(s.alive);
+        queued.push_back(s.queued);
+        secondaries.push_back(s.secondaries);
+        time.push_back(s.time);
+        occupancy.push_back(static_cast<double>(s.active) / num_track_slots_);
+        throughput.push_back(s.time > 0 ? s.active / s.time : 0.0);
+    }
+
+    j->obj = {
+        {"num_track_slots", num_track_slots_},
+        {"num_steps", num_steps_},
+        {"stride", stride_},
+        {"time", time_},
+        {"num_track_steps", num_track_steps_},
+        {"throughput", time_ > 0 ? num_track_steps_ / time_ : 0.0},
+        {"steps",
+         {
+             {"step", std::move(step)},
+             {"active", std::move(active)},
+             {"alive", std::move(alive)},
+             {"queued", std::move(queued)},
+             {"secondaries", std::move(secondaries)},
+             {"time", std::move(time)},
+             {"occupancy", std::move(occupancy)},
+             {"throughput", std::move(throughput)},
+         }},
+    };
+#else
+    (void)sizeof(j);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
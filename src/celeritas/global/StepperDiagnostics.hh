@@ -0,0 +1,97 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/StepperDiagnostics.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/io/OutputInterface.hh"
+
+namespace celeritas
+{
+struct StepperResult;
+//---------------------------------------------------------------------------//
+/*!
+ * Record the occupancy and throughput of a stepper at each step.
+ *
+ * Each recorded step saves the number of active tracks at the start of the
+ * step, the number of alive tracks and queued initializers at the end of it,
+ * the number of secondaries queued as new initializers, and the wall time of
+ * the step.
+ *
+ * If \c max_samples is nonzero, long runs are down-sampled: once the number
+ * of stored steps reaches the maximum, every other one is discarded and the
+ * sampling stride is doubled. Totals are accumulated over all steps
+ * regardless of sampling.
+ */
+class StepperDiagnostics final : public OutputInterface
+{
+  public:
+    //! Counters for a single sampled step
+    struct Sample
+    {
+        size_type step{};  //!< Step index
+        size_type active{};  //!< Active tracks at start of step
+        size_type alive{};  //!< Alive tracks at end of step
+        size_type queued{};  //!< Pending initializers at end of step
+        size_type secondaries{};  //!< Secondaries queued during step
+        double time{};  //!< Wall time of the step [s]
+    };
+
+    using VecSample = std::vector<Sample>;
+
+  public:
+    // Construct with state size, output label, and sampling limit
+    StepperDiagnostics(size_type num_track_slots,
+                       std::string label,
+                       size_type max_samples = 0);
+
+    // Record the result of a step
+    void record(StepperResult const& result, double seconds);
+
+    //! Category of data to write
+    Category category() const final { return Category::result; }
+
+    //! Name of the entry inside the category.
+    std::string label() const final { return label_; }
+
+    // Write output to the given JSON object
+    void output(JsonPimpl*) const final;
+
+    //// ACCESSORS ////
+
+    //! Sampled steps
+    VecSample const& samples() const { return samples_; }
+
+    //! Number of steps between samples
+    size_type stride() const { return stride_; }
+
+    //! Total number of recorded steps
+    size_type num_steps() const { return num_steps_; }
+
+    //! Total wall time of all steps [s]
+    double time() const { return time_; }
+
+    //! Total number of active track-steps
+    size_type num_track_steps() const { return num_track_steps_; }
+
+  private:
+    size_type num_track_slots_;
+    std::string label_;
+    size_type max_samples_;
+
+    VecSample samples_;
+    size_type stride_{1};
+    size_type num_steps_{0};
+    double time_{0};
+    size_type num_track_steps_{0};
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
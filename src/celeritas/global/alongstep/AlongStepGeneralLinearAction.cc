@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "AlongStepGeneralLinearAction.hh"
 
+#include <exception>
 #include <utility>
 
 #include "corecel/Assert.hh"
@@ -20,6 +21,7 @@
 #include "celeritas/global/CoreTrackData.hh"
 #include "celeritas/global/KernelContextException.hh"
 #include "celeritas/phys/PhysicsParams.hh"
+#include "celeritas/phys/WoodcockParams.hh"
 
 #include "AlongStepLauncher.hh"
 #include "detail/AlongStepGeneralLinear.hh"
@@ -35,7 +37,8 @@ AlongStepGeneralLinearAction::from_params(ActionId id,
                                           MaterialParams const& materials,
                                           ParticleParams const& particles,
                                           SPConstMsc const& msc,
-                                          bool eloss_fluctuation)
+                                          bool eloss_fluctuation,
+                                          SPConstWoodcock const& woodcock)
 {
     SPConstFluctuations fluct;
     if (eloss_fluctuation)
@@ -44,7 +47,7 @@ AlongStepGeneralLinearAction::from_params(ActionId id,
     }
 
     return std::make_shared<AlongStepGeneralLinearAction>(
-        id, std::move(fluct), msc);
+        id, std::move(fluct), msc, woodcock);
 }
 
 //---------------------------------------------------------------------------//
@@ -52,12 +55,16 @@ AlongStepGeneralLinearAction::from_params(ActionId id,
  * Construct with next action ID and optional energy loss parameters.
  */
 AlongStepGeneralLinearAction::AlongStepGeneralLinearAction(
-    ActionId id, SPConstFluctuations fluct, SPConstMsc msc)
+    ActionId id,
+    SPConstFluctuations fluct,
+    SPConstMsc msc,
+    SPConstWoodcock woodcock)
     : id_(id)
     , fluct_(std::move(fluct))
     , msc_(std::move(msc))
-    , host_data_(fluct_, msc_)
-    , device_data_(fluct_, msc_)
+    , woodcock_(std::move(woodcock))
+    , host_data_(fluct_, msc_, woodcock_)
+    , device_data_(fluct_, msc_, woodcock_)
 {
     CELER_EXPECT(id_);
 }
@@ -79,12 +86,12 @@ void AlongStepGeneralLinearAction::execute(ParamsHostCRef const& params,
     auto launch = make_along_step_launcher(params,
                                            state,
                                            host_data_.msc,
-                                           NoData{},
+                                           host_data_.woodcock,
                                            host_data_.fluct,
                                            detail::along_step_general_linear);
 
 #pragma omp parallel for
-    for (size_type i = 0; i < state.size(); ++i)
+    for (size_type i = 0; i < state.num_threads; ++i)
     {
         CELER_TRY_HANDLE_CONTEXT(
             launch(ThreadId{i}),
@@ -94,13 +101,43 @@ void AlongStepGeneralLinearAction::execute(ParamsHostCRef const& params,
     log_and_rethrow(std::move(capture_exception));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the along-step action on a chunk of threads on host.
+ */
+void AlongStepGeneralLinearAction::execute_chunk(ParamsHostCRef const& params,
+                                                 StateHostRef& state,
+                                                 Range<ThreadId> chunk) const
+{
+    auto launch = make_along_step_launcher(params,
+                                           state,
+                                           host_data_.msc,
+                                           host_data_.woodcock,
+                                           host_data_.fluct,
+                                           detail::along_step_general_linear);
+    for (ThreadId tid : chunk)
+    {
+        try
+        {
+            launch(tid);
+        }
+        catch (...)
+        {
+            std::throw_with_nested(
+                KernelContextException(params, state, tid, this->label()));
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Save references from host/device data.
  */
 template<MemSpace M>
 AlongStepGeneralLinearAction::ExternalRefs<M>::ExternalRefs(
-    SPConstFluctuations const& fluct_params, SPConstMsc const& msc_params)
+    SPConstFluctuations const& fluct_params,
+    SPConstMsc const& msc_params,
+    SPConstWoodcock const& woodcock_params)
 {
     if (M == MemSpace::device && !celeritas::device())
     {
@@ -116,6 +153,10 @@ AlongStepGeneralLinearAction::ExternalRefs<M>::ExternalRefs(
     {
         msc = get_ref<M>(*msc_params);
     }
+    if (woodcock_params)
+    {
+        woodcock = get_ref<M>(*woodcock_params);
+    }
 }
 
 //---------------------------------------------------------------------------//
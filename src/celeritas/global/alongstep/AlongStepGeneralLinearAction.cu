@@ -25,16 +25,17 @@ __global__ void
 along_step_general_linear_kernel(DeviceCRef<CoreParamsData> const params,
                                  DeviceRef<CoreStateData> const state,
                                  DeviceCRef<UrbanMscData> const msc_params,
+                                 DeviceCRef<WoodcockParamsData> const woodcock,
                                  DeviceCRef<FluctuationData> const fluct)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < state.size()))
+    if (!(tid < state.num_threads))
         return;
 
     auto launch = make_along_step_launcher(params,
                                            state,
                                            msc_params,
-                                           NoData{},
+                                           woodcock,
                                            fluct,
                                            detail::along_step_general_linear);
     launch(tid);
@@ -52,10 +53,11 @@ void AlongStepGeneralLinearAction::execute(ParamsDeviceCRef const& params,
     CELER_EXPECT(params && state);
     CELER_LAUNCH_KERNEL(along_step_general_linear,
                         celeritas::device().default_block_size(),
-                        state.size(),
+                        state.num_threads,
                         params,
                         state,
                         device_data_.msc,
+                        device_data_.woodcock,
                         device_data_.fluct);
 }
 
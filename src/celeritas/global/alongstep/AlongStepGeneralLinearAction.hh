@@ -16,6 +16,7 @@
 #include "celeritas/em/data/FluctuationData.hh"
 #include "celeritas/em/data/UrbanMscData.hh"
 #include "celeritas/global/ActionInterface.hh"
+#include "celeritas/phys/WoodcockData.hh"
 
 namespace celeritas
 {
@@ -24,6 +25,7 @@ class FluctuationParams;
 class PhysicsParams;
 class MaterialParams;
 class ParticleParams;
+class WoodcockParams;
 
 //---------------------------------------------------------------------------//
 /*!
@@ -31,15 +33,18 @@ class ParticleParams;
  *
  * This kernel is for problems without EM fields, for particle types that may
  * have (but do not *need* to have) along-step energy loss, optional energy
- * fluctuation, and optional multiple scattering.
+ * fluctuation, and optional multiple scattering. If majorant cross sections
+ * are given, eligible neutral particles use Woodcock (delta) tracking.
  */
-class AlongStepGeneralLinearAction final : public ExplicitActionInterface
+class AlongStepGeneralLinearAction final : public ExplicitActionInterface,
+                                           public FusibleActionInterface
 {
   public:
     //!@{
     //! \name Type aliases
     using SPConstFluctuations = std::shared_ptr<FluctuationParams const>;
     using SPConstMsc = std::shared_ptr<UrbanMscParams const>;
+    using SPConstWoodcock = std::shared_ptr<WoodcockParams const>;
     //!@}
 
   public:
@@ -48,12 +53,14 @@ class AlongStepGeneralLinearAction final : public ExplicitActionInterface
                 MaterialParams const& materials,
                 ParticleParams const& particles,
                 SPConstMsc const& msc,
-                bool eloss_fluctuation);
+                bool eloss_fluctuation,
+                SPConstWoodcock const& woodcock = nullptr);
 
     // Construct with next action ID, and optional EM energy fluctuation
     AlongStepGeneralLinearAction(ActionId id,
                                  SPConstFluctuations fluct,
-                                 SPConstMsc msc);
+                                 SPConstMsc msc,
+                                 SPConstWoodcock woodcock = nullptr);
 
     // Default destructor
     ~AlongStepGeneralLinearAction();
@@ -61,6 +68,11 @@ class AlongStepGeneralLinearAction final : public ExplicitActionInterface
     // Launch kernel with host data
     void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+    // Execute on a chunk of threads with host data
+    void execute_chunk(ParamsHostCRef const&,
+                       StateHostRef&,
+                       Range<ThreadId>) const final;
+
     // Launch kernel with device data
     void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
@@ -87,10 +99,14 @@ class AlongStepGeneralLinearAction final : public ExplicitActionInterface
     //! Whether MSC is in use
     bool has_msc() const { return static_cast<bool>(msc_); }
 
+    //! Whether Woodcock tracking is in use
+    bool has_woodcock() const { return static_cast<bool>(woodcock_); }
+
   private:
     ActionId id_;
     SPConstFluctuations fluct_;
     SPConstMsc msc_;
+    SPConstWoodcock woodcock_;
 
     // TODO: kind of hacky way to support fluct/msc being optional
     // (required because we have to pass "empty" refs if they're missing)
@@ -99,9 +115,11 @@ class AlongStepGeneralLinearAction final : public ExplicitActionInterface
     {
         FluctuationData<Ownership::const_reference, M> fluct;
         UrbanMscData<Ownership::const_reference, M> msc;
+        WoodcockParamsData<Ownership::const_reference, M> woodcock;
 
         ExternalRefs(SPConstFluctuations const& fluct_params,
-                     SPConstMsc const& msc_params);
+                     SPConstMsc const& msc_params,
+                     SPConstWoodcock const& woodcock_params);
     };
 
     ExternalRefs<MemSpace::host> host_data_;
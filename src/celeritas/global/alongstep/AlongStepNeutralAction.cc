@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "AlongStepNeutralAction.hh"
 
+#include <exception>
 #include <utility>
 
 #include "corecel/Assert.hh"
@@ -42,7 +43,7 @@ void AlongStepNeutralAction::execute(ParamsHostCRef const& params,
     auto launch = make_along_step_launcher(
         params, state, NoData{}, NoData{}, NoData{}, detail::along_step_neutral);
 #pragma omp parallel for
-    for (size_type i = 0; i < state.size(); ++i)
+    for (size_type i = 0; i < state.num_threads; ++i)
     {
         CELER_TRY_HANDLE_CONTEXT(
             launch(ThreadId{i}),
@@ -52,6 +53,30 @@ void AlongStepNeutralAction::execute(ParamsHostCRef const& params,
     log_and_rethrow(std::move(capture_exception));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the along-step action on a chunk of threads on host.
+ */
+void AlongStepNeutralAction::execute_chunk(ParamsHostCRef const& params,
+                                           StateHostRef& state,
+                                           Range<ThreadId> chunk) const
+{
+    auto launch = make_along_step_launcher(
+        params, state, NoData{}, NoData{}, NoData{}, detail::along_step_neutral);
+    for (ThreadId tid : chunk)
+    {
+        try
+        {
+            launch(tid);
+        }
+        catch (...)
+        {
+            std::throw_with_nested(
+                KernelContextException(params, state, tid, this->label()));
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 #if !CELER_USE_DEVICE
 void AlongStepNeutralAction::execute(ParamsDeviceCRef const&,
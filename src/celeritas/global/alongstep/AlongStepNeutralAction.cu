@@ -26,7 +26,7 @@ along_step_neutral_kernel(DeviceCRef<CoreParamsData> const params,
                           DeviceRef<CoreStateData> const state)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < state.size()))
+    if (!(tid < state.num_threads))
         return;
 
     auto launch = make_along_step_launcher(
@@ -46,7 +46,7 @@ void AlongStepNeutralAction::execute(ParamsDeviceCRef const& params,
     CELER_EXPECT(params && state);
     CELER_LAUNCH_KERNEL(along_step_neutral,
                         celeritas::device().default_block_size(),
-                        state.size(),
+                        state.num_threads,
                         params,
                         state);
 }
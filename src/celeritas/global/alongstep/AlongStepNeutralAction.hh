@@ -22,7 +22,8 @@ namespace celeritas
  * This should only be used for testing and demonstration purposes because real
  * EM physics always has continuous energy loss for charged particles.
  */
-class AlongStepNeutralAction final : public ExplicitActionInterface
+class AlongStepNeutralAction final : public ExplicitActionInterface,
+                                     public FusibleActionInterface
 {
   public:
     // Construct with next action ID
@@ -31,6 +32,11 @@ class AlongStepNeutralAction final : public ExplicitActionInterface
     // Launch kernel with host data
     void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+    // Execute on a chunk of threads with host data
+    void execute_chunk(ParamsHostCRef const&,
+                       StateHostRef&,
+                       Range<ThreadId>) const final;
+
     // Launch kernel with device data
     void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
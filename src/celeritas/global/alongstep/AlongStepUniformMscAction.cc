@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "AlongStepUniformMscAction.hh"
 
+#include <exception>
 #include <utility>
 
 #include "corecel/Assert.hh"
@@ -61,7 +62,7 @@ void AlongStepUniformMscAction::execute(ParamsHostCRef const& params,
                                            detail::along_step_uniform_msc);
 
 #pragma omp parallel for
-    for (size_type i = 0; i < state.size(); ++i)
+    for (size_type i = 0; i < state.num_threads; ++i)
     {
         CELER_TRY_HANDLE_CONTEXT(
             launch(ThreadId{i}),
@@ -71,6 +72,34 @@ void AlongStepUniformMscAction::execute(ParamsHostCRef const& params,
     log_and_rethrow(std::move(capture_exception));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the along-step action on a chunk of threads on host.
+ */
+void AlongStepUniformMscAction::execute_chunk(ParamsHostCRef const& params,
+                                              StateHostRef& state,
+                                              Range<ThreadId> chunk) const
+{
+    auto launch = make_along_step_launcher(params,
+                                           state,
+                                           host_data_.msc,
+                                           field_params_,
+                                           NoData{},
+                                           detail::along_step_uniform_msc);
+    for (ThreadId tid : chunk)
+    {
+        try
+        {
+            launch(tid);
+        }
+        catch (...)
+        {
+            std::throw_with_nested(
+                KernelContextException(params, state, tid, this->label()));
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Save references from host/device data.
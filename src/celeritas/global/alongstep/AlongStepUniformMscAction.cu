@@ -28,7 +28,7 @@ along_step_uniform_msc_kernel(DeviceCRef<CoreParamsData> const params,
                               UniformFieldParams const field_params)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < state.size()))
+    if (!(tid < state.num_threads))
         return;
 
     auto launch = make_along_step_launcher(params,
@@ -52,7 +52,7 @@ void AlongStepUniformMscAction::execute(ParamsDeviceCRef const& params,
     CELER_EXPECT(params && state);
     CELER_LAUNCH_KERNEL(along_step_uniform_msc,
                         celeritas::device().default_block_size(),
-                        state.size(),
+                        state.num_threads,
                         params,
                         state,
                         device_data_.msc,
@@ -27,7 +27,8 @@ class ParticleParams;
 /*!
  * Along-step kernel with optional MSC and uniform magnetic field.
  */
-class AlongStepUniformMscAction final : public ExplicitActionInterface
+class AlongStepUniformMscAction final : public ExplicitActionInterface,
+                                        public FusibleActionInterface
 {
   public:
     //!@{
@@ -47,6 +48,11 @@ class AlongStepUniformMscAction final : public ExplicitActionInterface
     // Launch kernel with host data
     void execute(ParamsHostCRef const&, StateHostRef&) const final;
 
+    // Execute on a chunk of threads with host data
+    void execute_chunk(ParamsHostCRef const&,
+                       StateHostRef&,
+                       Range<ThreadId>) const final;
+
     // Launch kernel with device data
     void execute(ParamsDeviceCRef const&, StateDeviceRef&) const final;
 
@@ -10,8 +10,10 @@
 #include "celeritas/em/data/FluctuationData.hh"
 #include "celeritas/em/data/UrbanMscData.hh"
 #include "celeritas/em/msc/UrbanMsc.hh"  // IWYU pragma: associated
+#include "celeritas/phys/WoodcockData.hh"
 
 #include "AlongStepNeutral.hh"
+#include "AlongStepWoodcock.hh"
 #include "FluctELoss.hh"  // IWYU pragma: associated
 
 namespace celeritas
@@ -21,13 +23,21 @@ namespace detail
 //---------------------------------------------------------------------------//
 /*!
  * Implementation of the "along step" action with MSC and eloss fluctuation.
+ *
+ * If majorant cross sections are provided, eligible neutral particles are
+ * transported with Woodcock tracking instead.
  */
 inline CELER_FUNCTION void
 along_step_general_linear(NativeCRef<UrbanMscData> const& msc,
-                          NoData,
+                          NativeCRef<WoodcockParamsData> const& woodcock,
                           NativeCRef<FluctuationData> const& fluct,
                           CoreTrackView const& track)
 {
+    if (woodcock
+        && woodcock.applies(track.make_particle_view().particle_id()))
+    {
+        return along_step_woodcock(woodcock, track);
+    }
     return along_step(
         UrbanMsc{msc}, LinearPropagatorFactory{}, FluctELoss{fluct}, track);
 }
@@ -0,0 +1,135 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/alongstep/detail/AlongStepWoodcock.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "orange/Types.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/geo/GeoMaterialView.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/grid/XsCalculator.hh"
+#include "celeritas/phys/PhysicsStepUtils.hh"
+#include "celeritas/phys/WoodcockData.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Move a neutral particle to its next real or fictitious collision.
+ *
+ * The distance to the collision is sampled with the majorant cross section,
+ * and the track moves in a straight line without stopping at geometry
+ * boundaries. The geometry state is then reinitialized at the collision point
+ * to find the new volume and material. The collision is real (the step ends
+ * with a discrete interaction) with probability
+ * \f$ \Sigma / \Sigma_\mathrm{maj} \f$; a fictitious collision resets the
+ * number of mean free paths and otherwise leaves the track unchanged, using
+ * the "integral rejection" action since it is equivalent to a rejected
+ * interaction. If the collision point is outside the world, the step ends
+ * with the boundary action, which kills the track.
+ *
+ * The majorant bounds the total cross section by construction (see \c
+ * WoodcockParams), which is checked in debug builds.
+ */
+inline CELER_FUNCTION void
+along_step_woodcock(NativeCRef<WoodcockParamsData> const& woodcock,
+                    CoreTrackView const& track)
+{
+    auto sim = track.make_sim_view();
+    StepLimit step_limit = sim.step_limit();
+    CELER_ASSERT(step_limit);
+
+    auto particle = track.make_particle_view();
+    real_type majorant_xs = 0;
+    {
+        CELER_ASSERT(woodcock.applies(particle.particle_id()));
+        XsCalculator calc_majorant(woodcock.majorant[particle.particle_id()],
+                                   woodcock.reals);
+        majorant_xs = calc_majorant(particle.energy());
+    }
+    CELER_ASSERT(majorant_xs > 0);
+
+    // Sample the distance to the next collision with the majorant
+    step_limit.step = track.make_physics_view().interaction_mfp()
+                      / majorant_xs;
+
+    {
+        // Move to the collision point and locate it
+        auto geo = track.make_geo_view();
+        Real3 pos = geo.pos();
+        Real3 const dir = geo.dir();
+        axpy(step_limit.step, dir, &pos);
+        geo = GeoTrackInitializer{pos, dir};
+
+        if (geo.is_outside())
+        {
+            // Particle left the world before colliding
+            step_limit.action = track.boundary_action();
+        }
+        else
+        {
+            // Update the material at the collision point
+            auto geo_mat = track.make_geo_material_view();
+            auto matid = geo_mat.material_id(geo.volume_id());
+            CELER_ASSERT(matid);
+            auto mat = track.make_material_view();
+            mat = {matid};
+        }
+    }
+
+    // Update track's lab-frame time using the beginning-of-step speed
+    {
+        real_type speed = native_value_from(particle.speed());
+        CELER_ASSERT(speed >= 0);
+        if (speed > 0)
+        {
+            sim.add_time(step_limit.step / speed);
+        }
+    }
+
+    if (step_limit.action != track.boundary_action())
+    {
+        // Calculate the cross sections in the new material
+        auto mat = track.make_material_view();
+        auto phys = track.make_physics_view();
+        auto pstep = track.make_physics_step_view();
+        calc_physics_step_limit(mat, particle, phys, pstep);
+
+        CELER_ASSERT(pstep.macro_xs() <= majorant_xs);
+        auto rng = track.make_rng_engine();
+        if (generate_canonical(rng) * majorant_xs < pstep.macro_xs())
+        {
+            // Real collision: the discrete select action resets the MFP
+            step_limit.action = phys.scalars().discrete_action();
+        }
+        else
+        {
+            // Fictitious collision: continue with a new MFP
+            phys.reset_interaction_mfp();
+            step_limit.action = phys.scalars().integral_rejection_action();
+        }
+    }
+
+    {
+        // Override step limit with action/step changes we applied
+        sim.force_step_limit(step_limit);
+        // Increment the step counter
+        sim.increment_num_steps();
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -12,26 +12,58 @@
 #include <type_traits>
 #include <utility>
 
+#include "celeritas_config.h"
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
 #include "corecel/device_runtime_api.h"
 #include "corecel/Types.hh"
 #include "corecel/cont/EnumArray.hh"
 #include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/Stopwatch.hh"
 #include "celeritas/global/ActionInterface.hh"
 #include "celeritas/global/CoreTrackData.hh"
 
+#include "../ActionProfiler.hh"
 #include "../ActionRegistry.hh"
 
 namespace celeritas
 {
 namespace detail
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get the number of tracks an action is applied to.
+ *
+ * When tracks are partitioned by post-step action, this is exactly the
+ * number of tracks in the action's partition. Otherwise it's the number of
+ * tracks that were active at the start of the step.
+ */
+template<MemSpace M>
+size_type count_tracks(ExplicitActionInterface const& action,
+                       CoreStateData<Ownership::reference, M> const& state)
+{
+    if (action.order() == ActionOrder::post && !state.thread_offsets.empty())
+    {
+        return action_thread_range(state, action.action_id()).size();
+    }
+    return state.init.num_active;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from an action registry and sequence options.
  */
 ActionSequence::ActionSequence(ActionRegistry const& reg, Options options)
-    : options_(std::move(options))
+    : options_(std::move(options)), num_actions_(reg.num_actions())
 {
     using EAI = ExplicitActionInterface;
 
@@ -70,7 +102,24 @@ ActionSequence::ActionSequence(ActionRegistry const& reg, Options options)
     // Initialize timing
     accum_time_.resize(actions_.size());
 
+    // Save the actions that can be executed on chunks of host threads
+    fusible_.resize(actions_.size(), nullptr);
+    if (this->fused())
+    {
+        for (auto i : range(actions_.size()))
+        {
+            fusible_[i] = dynamic_cast<FusibleActionInterface const*>(
+                actions_[i].get());
+        }
+    }
+
+    if (options_.profile && !actions_.empty())
+    {
+        profiler_ = std::make_shared<ActionProfiler>(actions_.size());
+    }
+
     CELER_ENSURE(actions_.size() == accum_time_.size());
+    CELER_ENSURE(actions_.size() == fusible_.size());
 }
 
 //---------------------------------------------------------------------------//
@@ -84,7 +133,40 @@ void ActionSequence::execute(
     CoreParamsData<Ownership::const_reference, M> const& params,
     CoreStateData<Ownership::reference, M>& state)
 {
-    if (M == MemSpace::host || options_.sync)
+    // Accumulate the elapsed time of a synchronous action
+    auto record = [&](size_type i, double seconds) {
+        accum_time_[i] += seconds;
+        if (profiler_)
+        {
+            profiler_->record(i, seconds, count_tracks(*actions_[i], state));
+        }
+    };
+
+    if (M == MemSpace::host && this->fused())
+    {
+        // Execute runs of fusible actions together
+        size_type i = 0;
+        while (i < actions_.size())
+        {
+            size_type end = i;
+            while (end < fusible_.size() && fusible_[end])
+            {
+                ++end;
+            }
+            if (end > i)
+            {
+                this->execute_fused(params, state, i, end);
+                i = end;
+                continue;
+            }
+
+            Stopwatch get_time;
+            actions_[i]->execute(params, state);
+            record(i, get_time());
+            ++i;
+        }
+    }
+    else if (M == MemSpace::host || options_.sync)
     {
         // Execute all actions and record the time elapsed
         for (auto i : range(actions_.size()))
@@ -95,7 +177,17 @@ void ActionSequence::execute(
             {
                 CELER_DEVICE_CALL_PREFIX(DeviceSynchronize());
             }
-            accum_time_[i] += get_time();
+            record(i, get_time());
+        }
+    }
+    else if (profiler_)
+    {
+        // Time device actions asynchronously
+        for (auto i : range(actions_.size()))
+        {
+            profiler_->start(i);
+            actions_[i]->execute(params, state);
+            profiler_->stop(i, count_tracks(*actions_[i], state));
         }
     }
     else
@@ -108,6 +200,87 @@ void ActionSequence::execute(
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Execute a run of fusible actions over chunks of host threads.
+ *
+ * Each chunk is run through every action in the run. Dynamic scheduling
+ * balances the work between threads, since the cost of a chunk depends on the
+ * tracks it contains.
+ */
+void ActionSequence::execute_fused(ParamsHostCRef const& params,
+                                   StateHostRef& state,
+                                   size_type begin,
+                                   size_type end)
+{
+    CELER_EXPECT(begin < end && end <= actions_.size());
+
+    size_type const num_threads = state.num_threads;
+    size_type const chunk_size = options_.fused_chunk_size;
+    size_type const num_chunks = ceil_div(num_threads, chunk_size);
+
+    // Run all actions for a single chunk, accumulating the time spent in each
+    auto execute_chunk = [&](size_type chunk, double* elapsed) {
+        auto threads = range(
+            ThreadId{chunk * chunk_size},
+            ThreadId{celeritas::min((chunk + 1) * chunk_size, num_threads)});
+        for (auto i : range(begin, end))
+        {
+            Stopwatch get_time;
+            fusible_[i]->execute_chunk(params, state, threads);
+            elapsed[i - begin] += get_time();
+        }
+    };
+
+    MultiExceptionHandler capture_exception;
+    VecDouble elapsed(end - begin, 0.0);
+    int num_workers = 1;
+#pragma omp parallel
+    {
+        VecDouble local_elapsed(end - begin, 0.0);
+#pragma omp for schedule(dynamic)
+        for (size_type chunk = 0; chunk < num_chunks; ++chunk)
+        {
+            CELER_TRY_HANDLE(execute_chunk(chunk, local_elapsed.data()),
+                             capture_exception);
+        }
+#pragma omp critical
+        {
+            for (auto i : range(elapsed.size()))
+            {
+                elapsed[i] += local_elapsed[i];
+            }
+#if CELERITAS_USE_OPENMP
+            num_workers = omp_get_num_threads();
+#endif
+        }
+    }
+    log_and_rethrow(std::move(capture_exception));
+
+    for (auto i : range(elapsed.size()))
+    {
+        double seconds = elapsed[i] / num_workers;
+        accum_time_[begin + i] += seconds;
+        if (profiler_)
+        {
+            profiler_->record(
+                begin + i, seconds, count_tracks(*actions_[begin + i], state));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fused execution is only implemented on host.
+ */
+void ActionSequence::execute_fused(ParamsDeviceCRef const&,
+                                   StateDeviceRef&,
+                                   size_type,
+                                   size_type)
+{
+    CELER_ASSERT_UNREACHABLE();
+}
+
 //---------------------------------------------------------------------------//
 // Explicit template instantiation
 //---------------------------------------------------------------------------//
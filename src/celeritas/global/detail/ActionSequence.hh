@@ -18,6 +18,7 @@
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
+class ActionProfiler;
 class ActionRegistry;
 
 namespace detail
@@ -25,6 +26,21 @@ namespace detail
 //---------------------------------------------------------------------------//
 /*!
  * Sequence of explicit actions to invoke as part of a single step.
+ *
+ * If \c fused_chunk_size is nonzero, host execution fuses each run of
+ * consecutive actions that implement \c FusibleActionInterface into a single
+ * parallel region. The active threads are divided into chunks of the given
+ * size that are dynamically scheduled (so idle threads take the remaining
+ * chunks), and each chunk is run through every action in the run before the
+ * next chunk is taken. Other actions act as barriers between fused runs.
+ *
+ * The accumulated time of a fused action is its share of the wall time of the
+ * fused region, estimated from the time spent in it summed over all
+ * threads.
+ *
+ * If \c profile is enabled, the elapsed time and number of active tracks of
+ * every action are recorded at each step by an \c ActionProfiler . Device
+ * actions are timed with events rather than by synchronizing the device.
  */
 class ActionSequence
 {
@@ -34,12 +50,15 @@ class ActionSequence
     using SPConstExplicit = std::shared_ptr<ExplicitActionInterface const>;
     using VecAction = std::vector<SPConstExplicit>;
     using VecDouble = std::vector<double>;
+    using SPActionProfiler = std::shared_ptr<ActionProfiler>;
     //!@}
 
     //! Construction/execution options
     struct Options
     {
         bool sync{false};  //!< Call DeviceSynchronize and add timer
+        size_type fused_chunk_size{0};  //!< Host tracks per fused chunk
+        bool profile{false};  //!< Record per-step action times and tracks
     };
 
   public:
@@ -67,13 +86,40 @@ class ActionSequence
     //! Get the ordered vector of actions in the sequence
     VecAction const& actions() const { return actions_; }
 
+    //! Number of registered actions when the sequence was built
+    ActionId::size_type num_actions() const { return num_actions_; }
+
     //! Get the corresponding accumulated time, if 'sync' or host called
     VecDouble const& accum_time() const { return accum_time_; }
 
+    //! Whether consecutive host actions are fused
+    bool fused() const { return options_.fused_chunk_size > 0; }
+
+    //! Get the per-action profiler (null unless 'profile' is enabled)
+    SPActionProfiler const& profiler() const { return profiler_; }
+
   private:
+    using ParamsHostCRef = HostCRef<CoreParamsData>;
+    using StateHostRef = HostRef<CoreStateData>;
+    using ParamsDeviceCRef = DeviceCRef<CoreParamsData>;
+    using StateDeviceRef = DeviceRef<CoreStateData>;
+
     Options options_;
+    ActionId::size_type num_actions_{0};
     VecAction actions_;
     VecDouble accum_time_;
+    std::vector<FusibleActionInterface const*> fusible_;
+    SPActionProfiler profiler_;
+
+    // Execute a run of fusible actions over chunks of host threads
+    void execute_fused(ParamsHostCRef const& params,
+                       StateHostRef& state,
+                       size_type begin,
+                       size_type end);
+    void execute_fused(ParamsDeviceCRef const&,
+                       StateDeviceRef&,
+                       size_type,
+                       size_type);
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,163 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/grid/FusedXsCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/grid/UniformGrid.hh"
+#include "corecel/math/Quantity.hh"
+
+#include "XsGridData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate the cross sections of several processes at a single energy.
+ *
+ * The energy bin is located once at construction, and the cross section of
+ * each process is then a linear interpolation between two adjacent values.
+ * Out-of-bounds energies are snapped to the closest grid point, and the
+ * interpolation is identical to \c XsCalculator when the process's original
+ * grid is the common grid.
+ *
+ * \code
+    FusedXsCalculator calc_xs(grid, reals, indices, particle.energy());
+    for (auto i : range(grid.num_values()))
+    {
+        real_type xs = calc_xs(i);
+    }
+   \endcode
+ */
+class FusedXsCalculator
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Energy = Quantity<FusedXsGridData::EnergyUnits>;
+    using Values = Collection<table_real_type,
+                              Ownership::const_reference,
+                              MemSpace::native>;
+    using Indices
+        = Collection<size_type, Ownership::const_reference, MemSpace::native>;
+    //!@}
+
+  public:
+    // Construct from state-independent data and locate the energy
+    inline CELER_FUNCTION FusedXsCalculator(FusedXsGridData const& grid,
+                                            Values const& values,
+                                            Indices const& indices,
+                                            Energy energy);
+
+    // Interpolate the cross section of the given process
+    inline CELER_FUNCTION real_type operator()(size_type process) const;
+
+  private:
+    FusedXsGridData const& data_;
+    Values const& reals_;
+    Indices const& indices_;
+    real_type energy_;
+    size_type lower_idx_;
+    real_type lower_energy_;
+    real_type upper_energy_;
+    bool snapped_;
+
+    CELER_FORCEINLINE_FUNCTION real_type get(size_type index,
+                                             size_type process) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from fused cross section data and locate the energy bin.
+ */
+CELER_FUNCTION
+FusedXsCalculator::FusedXsCalculator(FusedXsGridData const& grid,
+                                     Values const& values,
+                                     Indices const& indices,
+                                     Energy energy)
+    : data_(grid), reals_(values), indices_(indices), energy_(energy.value())
+{
+    CELER_EXPECT(data_);
+
+    const UniformGrid loge_grid(data_.log_energy);
+    const real_type loge = std::log(energy_);
+
+    // Snap out-of-bounds values to closest grid points
+    snapped_ = true;
+    if (loge <= loge_grid.front())
+    {
+        lower_idx_ = 0;
+    }
+    else if (loge >= loge_grid.back())
+    {
+        lower_idx_ = loge_grid.size() - 1;
+    }
+    else
+    {
+        lower_idx_ = loge_grid.find(loge);
+        CELER_ASSERT(lower_idx_ + 1 < loge_grid.size());
+        snapped_ = false;
+    }
+
+    lower_energy_ = reals_[data_.energy[lower_idx_]];
+    upper_energy_ = snapped_ ? lower_energy_
+                             : reals_[data_.energy[lower_idx_ + 1]];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate the cross section of the given process.
+ */
+CELER_FUNCTION real_type FusedXsCalculator::operator()(size_type process) const
+{
+    CELER_EXPECT(process < data_.num_values());
+
+    bool const scaled = lower_idx_ >= indices_[data_.prime_index[process]];
+    real_type result = this->get(lower_idx_, process);
+    if (scaled)
+    {
+        result *= lower_energy_;
+    }
+
+    if (!snapped_)
+    {
+        // Interpolate *linearly* on energy
+        real_type upper = this->get(lower_idx_ + 1, process);
+        if (scaled)
+        {
+            upper *= upper_energy_;
+        }
+        result += (energy_ - lower_energy_) * (upper - result)
+                  / (upper_energy_ - lower_energy_);
+    }
+
+    if (scaled)
+    {
+        result /= energy_;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the cross section at a particular grid point.
+ */
+CELER_FUNCTION real_type FusedXsCalculator::get(size_type index,
+                                                size_type process) const
+{
+    size_type idx = index * data_.num_values() + process;
+    CELER_EXPECT(idx < data_.value.size());
+    return reals_[data_.value[idx]];
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -28,8 +28,9 @@ class GenericXsCalculator
   public:
     //@{
     //! Type aliases
-    using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Values = Collection<table_real_type,
+                              Ownership::const_reference,
+                              MemSpace::native>;
     //@}
 
   public:
@@ -68,7 +69,7 @@ GenericXsCalculator::GenericXsCalculator(GenericGridData const& grid,
 CELER_FUNCTION real_type
 GenericXsCalculator::operator()(const real_type energy) const
 {
-    NonuniformGrid<real_type> const energy_grid(data_.grid, reals_);
+    NonuniformGrid<table_real_type> const energy_grid(data_.grid, reals_);
 
     // Snap out-of-bounds values to closest grid points
     size_type lower_idx;
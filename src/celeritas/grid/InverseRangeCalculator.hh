@@ -45,8 +45,9 @@ class InverseRangeCalculator
     //!@{
     //! \name Type aliases
     using Energy = Quantity<XsGridData::EnergyUnits>;
-    using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Values = Collection<table_real_type,
+                              Ownership::const_reference,
+                              MemSpace::native>;
     //!@}
 
   public:
@@ -59,7 +60,7 @@ class InverseRangeCalculator
 
   private:
     UniformGrid log_energy_;
-    NonuniformGrid<real_type> range_;
+    NonuniformGrid<table_real_type> range_;
 };
 
 //---------------------------------------------------------------------------//
@@ -7,8 +7,14 @@
 //---------------------------------------------------------------------------//
 #include "ValueGridInserter.hh"
 
+#include <cmath>
+
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/grid/UniformGrid.hh"
+#include "corecel/math/Algorithms.hh"
 
+#include "XsCalculator.hh"
 #include "XsGridData.hh"
 
 namespace celeritas
@@ -18,8 +24,13 @@ namespace celeritas
  * Construct with a reference to mutable host data.
  */
 ValueGridInserter::ValueGridInserter(RealCollection* real_data,
-                                     XsGridCollection* xs_grid)
-    : values_(real_data), xs_grids_(xs_grid)
+                                     XsGridCollection* xs_grid,
+                                     ValueGridAccuracy* accuracy)
+    : reals_(real_data)
+    , values_(std::make_shared<DedupeCollectionBuilder<table_real_type>>(
+          real_data))
+    , xs_grids_(xs_grid)
+    , accuracy_(accuracy)
 {
     CELER_EXPECT(real_data && xs_grid);
 }
@@ -40,7 +51,11 @@ auto ValueGridInserter::operator()(UniformGridData const& log_grid,
     XsGridData grid;
     grid.log_energy = log_grid;
     grid.prime_index = prime_index;
-    grid.value = values_.insert_back(values.begin(), values.end());
+    grid.value = values_->insert_back(values.begin(), values.end());
+    if (accuracy_)
+    {
+        this->validate(grid, values);
+    }
     return xs_grids_.push_back(grid);
 }
 
@@ -64,5 +79,82 @@ auto ValueGridInserter::operator()(InterpolatedGrid, InterpolatedGrid)
     CELER_NOT_IMPLEMENTED("generic grids");
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Number of values that were not stored because they were duplicates.
+ */
+size_type ValueGridInserter::num_deduplicated() const
+{
+    return values_->num_deduplicated();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compare interpolated stored values against the source data.
+ *
+ * The reference interpolation is done in double precision on the source
+ * values and follows the same scaling as \c XsCalculator .
+ */
+void ValueGridInserter::validate(XsGridData const& grid,
+                                 SpanConstReal values) const
+{
+    CELER_EXPECT(accuracy_);
+
+    Collection<table_real_type, Ownership::const_reference, MemSpace::host>
+        reals;
+    reals = *reals_;
+    XsCalculator calc_xs(grid, reals);
+    UniformGrid const loge_grid(grid.log_energy);
+
+    auto update = [this](real_type expected, real_type actual) {
+        real_type rel_error = 0;
+        if (expected != 0)
+        {
+            rel_error = std::fabs(actual - expected) / std::fabs(expected);
+        }
+        else if (actual != 0)
+        {
+            rel_error = 1;
+        }
+        accuracy_->max_rel_error = max(accuracy_->max_rel_error, rel_error);
+        ++accuracy_->num_points;
+    };
+
+    for (auto i : range(values.size()))
+    {
+        // Compare at the grid point
+        real_type energy = std::exp(loge_grid[i]);
+        real_type expected = values[i];
+        if (i >= grid.prime_index)
+        {
+            expected /= energy;
+        }
+        update(expected, calc_xs[i]);
+
+        if (i + 1 == values.size())
+        {
+            break;
+        }
+
+        // Compare at the log-midpoint of the interval
+        real_type lower_energy = energy;
+        real_type upper_energy = std::exp(loge_grid[i + 1]);
+        real_type upper = values[i + 1];
+        if (i + 1 == grid.prime_index)
+        {
+            upper /= upper_energy;
+        }
+        energy = std::sqrt(lower_energy * upper_energy);
+        expected = values[i]
+                   + (energy - lower_energy) * (upper - values[i])
+                         / (upper_energy - lower_energy);
+        if (i >= grid.prime_index)
+        {
+            expected /= energy;
+        }
+        update(expected, calc_xs(XsCalculator::Energy{energy}));
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -14,6 +15,7 @@
 #include "corecel/cont/Span.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/DedupeCollectionBuilder.hh"
 #include "corecel/grid/UniformGridData.hh"
 #include "celeritas/Types.hh"
 
@@ -21,6 +23,20 @@
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Difference between stored value grids and their source data.
+ *
+ * When tables are stored with reduced precision (\c table_real_type is
+ * \c float ), the interpolated values differ from those of the original
+ * double-precision data by roundoff.
+ */
+struct ValueGridAccuracy
+{
+    size_type num_points{0};  //!< Number of interpolated points compared
+    real_type max_rel_error{0};  //!< Largest relative difference
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Manage data and help construction of physics value grids.
@@ -30,6 +46,15 @@ namespace celeritas
  * ValueGridXsBuilder::build method taking an instance of this class) it can be
  * extended to build additional grid types as well.
  *
+ * Identical value arrays (for example, the cross sections of materials with
+ * the same composition) are stored only once. The deduplication is shared by
+ * copies of the inserter, but not by separately constructed inserters.
+ *
+ * If an accuracy result is given, each inserted cross section grid is
+ * validated by interpolating it at the grid points and at the log-midpoint of
+ * each interval and comparing against the same interpolation of the source
+ * values.
+ *
  * \code
     ValueGridInserter insert(&data.host.values, &data.host.grids);
     insert(uniform_grid, values);
@@ -43,7 +68,7 @@ class ValueGridInserter
     //!@{
     //! \name Type aliases
     using RealCollection
-        = Collection<real_type, Ownership::value, MemSpace::host>;
+        = Collection<table_real_type, Ownership::value, MemSpace::host>;
     using XsGridCollection
         = Collection<XsGridData, Ownership::value, MemSpace::host>;
     using SpanConstReal = Span<real_type const>;
@@ -54,7 +79,9 @@ class ValueGridInserter
 
   public:
     // Construct with a reference to mutable host data
-    ValueGridInserter(RealCollection* real_data, XsGridCollection* xs_grid);
+    ValueGridInserter(RealCollection* real_data,
+                      XsGridCollection* xs_grid,
+                      ValueGridAccuracy* accuracy = nullptr);
 
     // Add a grid of xs-like data
     XsIndex operator()(UniformGridData const& log_grid,
@@ -67,9 +94,16 @@ class ValueGridInserter
     // Add a grid of generic data
     GenericIndex operator()(InterpolatedGrid grid, InterpolatedGrid values);
 
+    // Number of values that were not stored because they were duplicates
+    size_type num_deduplicated() const;
+
   private:
-    CollectionBuilder<real_type, MemSpace::host, ItemId<real_type>> values_;
+    RealCollection* reals_;
+    std::shared_ptr<DedupeCollectionBuilder<table_real_type>> values_;
     CollectionBuilder<XsGridData, MemSpace::host, ItemId<XsGridData>> xs_grids_;
+    ValueGridAccuracy* accuracy_;
+
+    void validate(XsGridData const& grid, SpanConstReal values) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -38,7 +38,7 @@ struct XsGridData
 
     UniformGridData log_energy;
     size_type prime_index{no_scaling()};
-    ItemRange<real_type> value;
+    ItemRange<table_real_type> value;
 
     //! Whether the interface is initialized and valid
     explicit CELER_FUNCTION operator bool() const
@@ -49,14 +49,49 @@ struct XsGridData
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Cross sections for several processes on a common log-energy grid.
+ *
+ * The values are interleaved so that all processes' cross sections at a grid
+ * point are contiguous: \code value[i * num_values + j] \endcode is the
+ * (unscaled) cross section of the \em j th process at the \em i th grid point.
+ * The energy of each grid point is stored to avoid recalculating it.
+ *
+ * Each process has its own \c prime_index : interpolation in bins at or above
+ * that index is performed on the cross section scaled by E, matching the
+ * behavior of \c XsGridData .
+ */
+struct FusedXsGridData
+{
+    using EnergyUnits = XsGridData::EnergyUnits;
+    using XsUnits = XsGridData::XsUnits;
+
+    UniformGridData log_energy;
+    ItemRange<table_real_type> energy;  //!< Energy of each grid point [MeV]
+    ItemRange<table_real_type> value;  //!< Cross sections [energy][process]
+    ItemRange<size_type> prime_index;  //!< First scaled bin [process]
+
+    //! Number of processes
+    CELER_FUNCTION size_type num_values() const { return prime_index.size(); }
+
+    //! Whether the interface is initialized and valid
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return log_energy && energy.size() == log_energy.size
+               && !prime_index.empty()
+               && value.size() == log_energy.size * prime_index.size();
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * A generic grid of 1D data with arbitrary interpolation.
  */
 struct GenericGridData
 {
-    ItemRange<real_type> grid;  //!< x grid
-    ItemRange<real_type> value;  //!< f(x) value
+    ItemRange<table_real_type> grid;  //!< x grid
+    ItemRange<table_real_type> value;  //!< f(x) value
     Interp grid_interp;  //!< Interpolation along x
     Interp value_interp;  //!< Interpolation along f(x)
 
@@ -109,14 +109,16 @@ CELER_FUNCTION bool CutoffView::apply_post_interaction() const
  * Whether the post-interaction cutoff should be applied to the secondary.
  *
  * This will be true if the \c apply_post_interaction option is enabled and the
- * seccondary is an electron, positron, or gamma with energy below the
- * production cut.
+ * secondary is an electron, positron, or gamma with energy below the
+ * production cut. Empty secondaries (e.g., from an interactor that already
+ * applied its own cutoff) are never matched.
  */
 CELER_FUNCTION bool CutoffView::apply(Secondary const& secondary) const
 {
-    return (secondary.particle_id == params_.ids.gamma
-            || secondary.particle_id == params_.ids.electron
-            || secondary.particle_id == params_.ids.positron)
+    return secondary
+           && (secondary.particle_id == params_.ids.gamma
+               || secondary.particle_id == params_.ids.electron
+               || secondary.particle_id == params_.ids.positron)
            && secondary.energy < this->energy(secondary.particle_id);
 }
 
@@ -31,6 +31,7 @@ namespace celeritas
 using ValueGrid = XsGridData;
 using ValueGridId = OpaqueId<XsGridData>;
 using ValueTableId = OpaqueId<struct ValueTable>;
+using FusedXsGridId = OpaqueId<FusedXsGridData>;
 
 //---------------------------------------------------------------------------//
 // PARAMS
@@ -124,7 +125,8 @@ struct IntegralXsProcess
  * be \code tables[ValueGridType::macro_xs][2] \endcode. This
  * awkward access is encapsulated by the PhysicsTrackView. \c integral_xs will
  * only be assigned if the integral approach is used and the particle has
- * continuous-discrete processes.
+ * continuous-discrete processes. \c fused_xs is only assigned if the fused
+ * cross section tables are enabled.
  */
 struct ProcessGroup
 {
@@ -132,6 +134,7 @@ struct ProcessGroup
     ValueGridArray<ItemRange<ValueTable>> tables;  //!< [vgt][ppid]
     ItemRange<IntegralXsProcess> integral_xs;  //!< [ppid]
     ItemRange<ModelGroup> models;  //!< Model applicability [ppid]
+    ItemRange<FusedXsGridData> fused_xs;  //!< All-process macro xs [mat]
     ParticleProcessId eloss_ppid{};  //!< Process with de/dx and range tables
     bool has_at_rest{};  //!< Whether the particle type has an at-rest process
 
@@ -306,7 +309,8 @@ struct PhysicsParamsData
     //// DATA ////
 
     // Backend storage
-    Items<real_type> reals;
+    Items<table_real_type> reals;  //!< Tabulated grid values
+    Items<real_type> energies;  //!< Model bounds and max-xs energies [MeV]
     Items<ParticleModelId> pmodel_ids;
     Items<ValueGrid> value_grids;
     Items<ValueGridId> value_grid_ids;
@@ -315,6 +319,8 @@ struct PhysicsParamsData
     Items<ValueTableId> value_table_ids;
     Items<IntegralXsProcess> integral_xs;
     Items<ModelGroup> model_groups;
+    Items<size_type> fused_prime_indices;
+    Items<FusedXsGridData> fused_xs_grids;
     ParticleItems<ProcessGroup> process_groups;
     ParticleModelItems<ModelId> model_ids;
     ParticleModelItems<ModelXsTable> model_xs;
@@ -340,6 +346,7 @@ struct PhysicsParamsData
         CELER_EXPECT(other);
 
         reals = other.reals;
+        energies = other.energies;
         pmodel_ids = other.pmodel_ids;
         value_grids = other.value_grids;
         value_grid_ids = other.value_grid_ids;
@@ -348,6 +355,8 @@ struct PhysicsParamsData
         value_table_ids = other.value_table_ids;
         integral_xs = other.integral_xs;
         model_groups = other.model_groups;
+        fused_prime_indices = other.fused_prime_indices;
+        fused_xs_grids = other.fused_xs_grids;
         process_groups = other.process_groups;
         model_ids = other.model_ids;
         model_xs = other.model_xs;
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <map>
 #include <set>
 #include <tuple>
@@ -18,8 +19,10 @@
 #include "corecel/Types.hh"
 #include "corecel/cont/Label.hh"
 #include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/DedupeCollectionBuilder.hh"
 #include "corecel/data/Ref.hh"
 #include "corecel/grid/UniformGrid.hh"
 #include "corecel/io/Logger.hh"
@@ -136,8 +139,22 @@ PhysicsParams::PhysicsParams(Input inp)
     HostValue host_data;
     this->build_options(inp.options, &host_data);
     this->build_ids(*inp.particles, &host_data);
-    this->build_xs(inp.options, *inp.materials, &host_data);
+    this->build_xs(inp.options,
+                   *inp.materials,
+                   inp.options.validate_tables ? &table_accuracy_ : nullptr,
+                   &host_data);
+    if (inp.options.validate_tables)
+    {
+        CELER_LOG(info) << "Largest relative error of "
+                        << table_accuracy_.num_points
+                        << " interpolated physics table values: "
+                        << table_accuracy_.max_rel_error;
+    }
     this->build_model_xs(*inp.materials, &host_data);
+    if (inp.options.fused_xs)
+    {
+        this->build_fused_xs(*inp.materials, &host_data);
+    }
 
     // Add step limiter if being used (TODO: remove this hack from physics)
     if (inp.options.fixed_step_limiter > 0)
@@ -290,7 +307,7 @@ void PhysicsParams::build_ids(ParticleParams const& particles,
     auto process_ids = make_builder(&data->process_ids);
     auto model_groups = make_builder(&data->model_groups);
     auto pmodel_ids = make_builder(&data->pmodel_ids);
-    auto reals = make_builder(&data->reals);
+    auto energies = make_builder(&data->energies);
 
     process_groups.reserve(particle_models.size());
 
@@ -346,8 +363,8 @@ void PhysicsParams::build_ids(ParticleParams const& particles,
             }
 
             ModelGroup mdata;
-            mdata.energy = reals.insert_back(temp_energy_grid.begin(),
-                                             temp_energy_grid.end());
+            mdata.energy = energies.insert_back(temp_energy_grid.begin(),
+                                                temp_energy_grid.end());
             mdata.model = pmodel_ids.insert_back(temp_models.begin(),
                                                  temp_models.end());
             CELER_ASSERT(mdata);
@@ -406,6 +423,7 @@ void PhysicsParams::build_ids(ParticleParams const& particles,
  */
 void PhysicsParams::build_xs(Options const& opts,
                              MaterialParams const& mats,
+                             ValueGridAccuracy* accuracy,
                              HostValue* data) const
 {
     CELER_EXPECT(*data);
@@ -413,7 +431,7 @@ void PhysicsParams::build_xs(Options const& opts,
     using UPGridBuilder = Process::UPConstGridBuilder;
     using Energy = Applicability::Energy;
 
-    ValueGridInserter insert_grid(&data->reals, &data->value_grids);
+    ValueGridInserter insert_grid(&data->reals, &data->value_grids, accuracy);
     auto value_tables = make_builder(&data->value_tables);
     auto integral_xs = make_builder(&data->integral_xs);
     auto value_grid_ids = make_builder(&data->value_grid_ids);
@@ -451,7 +469,7 @@ void PhysicsParams::build_xs(Options const& opts,
         {
             // Get energy bounds for this process
             Span<real_type const> energy_grid
-                = data->reals[model_groups[pp_idx].energy];
+                = data->energies[model_groups[pp_idx].energy];
             applic.lower = Energy{energy_grid.front()};
             applic.upper = Energy{energy_grid.back()};
             CELER_ASSERT(applic.lower < applic.upper);
@@ -574,7 +592,7 @@ void PhysicsParams::build_xs(Options const& opts,
             if (!energy_max_xs.empty())
             {
                 temp_integral_xs[pp_idx].energy_max_xs
-                    = make_builder(&data->reals)
+                    = make_builder(&data->energies)
                           .insert_back(energy_max_xs.begin(),
                                        energy_max_xs.end());
             }
@@ -591,6 +609,142 @@ void PhysicsParams::build_xs(Options const& opts,
                 temp_tables[vgt].begin(), temp_tables[vgt].end());
         }
     }
+
+    CELER_LOG(debug) << "Reused " << insert_grid.num_deduplicated()
+                     << " identical physics table values";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct fused cross section grids for each particle type and material.
+ *
+ * The common grid spans all of the processes' macroscopic cross section grids
+ * and has the finest of their spacings, so when all processes share the same
+ * grid the fused values are identical to the original ones. Processes without
+ * a cross section table (or whose cross sections are calculated on the fly)
+ * are stored as zero.
+ */
+void PhysicsParams::build_fused_xs(MaterialParams const& mats,
+                                   HostValue* data) const
+{
+    CELER_EXPECT(*data);
+
+    using Energy = XsCalculator::Energy;
+
+    auto fused_xs_grids = make_builder(&data->fused_xs_grids);
+    auto prime_indices = make_dedupe_builder(&data->fused_prime_indices);
+    auto reals = make_dedupe_builder(&data->reals);
+
+    size_type num_values = 0;
+    for (auto particle_id : range(ParticleId(data->process_groups.size())))
+    {
+        ProcessGroup& process_group = data->process_groups[particle_id];
+        auto const& tables = process_group.tables[ValueGridType::macro_xs];
+        size_type const num_processes = process_group.size();
+
+        std::vector<FusedXsGridData> temp_grids(mats.size());
+        for (auto mat_id : range(MaterialId{mats.size()}))
+        {
+            // Find the tabulated cross sections and the common grid bounds
+            std::vector<XsGridData const*> grids(num_processes, nullptr);
+            real_type front = std::numeric_limits<real_type>::infinity();
+            real_type back = -front;
+            real_type delta = front;
+            for (auto pp_idx : range(num_processes))
+            {
+                ValueTable const& table = data->value_tables[tables[pp_idx]];
+                if (!table)
+                {
+                    continue;
+                }
+                if (auto grid_id
+                    = data->value_grid_ids[table.grids[mat_id.get()]])
+                {
+                    grids[pp_idx] = &data->value_grids[grid_id];
+                    auto const& loge = grids[pp_idx]->log_energy;
+                    front = std::min(front, loge.front);
+                    back = std::max(back, loge.back);
+                    delta = std::min(delta, loge.delta);
+                }
+            }
+            if (!(front < back))
+            {
+                // No tabulated cross sections for this particle and material
+                continue;
+            }
+
+            // Construct the common grid, with a tolerance to avoid adding a
+            // point from floating point error
+            auto const num_bins = static_cast<size_type>(
+                std::ceil((back - front) / delta - real_type(1e-6)));
+            auto const fused_grid
+                = UniformGridData::from_bounds(front, back, num_bins + 1);
+            UniformGrid const loge_grid(fused_grid);
+
+            std::vector<real_type> energy(loge_grid.size());
+            for (auto i : range(loge_grid.size()))
+            {
+                energy[i] = std::exp(loge_grid[i]);
+            }
+
+            // Interpolate each process's cross sections on the common grid
+            std::vector<real_type> values(loge_grid.size() * num_processes,
+                                          0);
+            std::vector<size_type> primes(num_processes,
+                                          XsGridData::no_scaling());
+            auto data_ref = make_const_ref(*data);
+            for (auto pp_idx : range(num_processes))
+            {
+                if (!grids[pp_idx])
+                {
+                    continue;
+                }
+                XsGridData const& grid = *grids[pp_idx];
+                XsCalculator const calc_xs(grid, data_ref.reals);
+                for (auto i : range(loge_grid.size()))
+                {
+                    // Use the original value if the grid points coincide to
+                    // avoid roundoff when locating the energy
+                    real_type pos = (loge_grid[i] - grid.log_energy.front)
+                                    / grid.log_energy.delta;
+                    real_type nearest = std::round(pos);
+                    real_type& xs = values[i * num_processes + pp_idx];
+                    if (std::fabs(pos - nearest) < real_type(1e-6)
+                        && nearest >= 0 && nearest < grid.log_energy.size)
+                    {
+                        xs = calc_xs[static_cast<size_type>(nearest)];
+                    }
+                    else
+                    {
+                        xs = calc_xs(Energy{energy[i]});
+                    }
+                }
+                if (grid.prime_index != XsGridData::no_scaling())
+                {
+                    // First common grid point at or above the original
+                    real_type loge_prime = UniformGrid(
+                        grid.log_energy)[grid.prime_index];
+                    primes[pp_idx] = static_cast<size_type>(std::ceil(
+                        (loge_prime - front) / fused_grid.delta
+                        - real_type(1e-6)));
+                }
+            }
+
+            FusedXsGridData& temp = temp_grids[mat_id.get()];
+            temp.log_energy = fused_grid;
+            temp.energy = reals.insert_back(energy.begin(), energy.end());
+            temp.value = reals.insert_back(values.begin(), values.end());
+            temp.prime_index
+                = prime_indices.insert_back(primes.begin(), primes.end());
+            CELER_ASSERT(temp);
+            num_values += values.size();
+        }
+        process_group.fused_xs
+            = fused_xs_grids.insert_back(temp_grids.begin(), temp_grids.end());
+    }
+
+    CELER_LOG(debug) << "Constructed fused cross section grids with "
+                     << num_values << " values";
 }
 
 //---------------------------------------------------------------------------//
@@ -602,7 +756,11 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
 {
     CELER_EXPECT(*data);
 
-    ValueGridInserter insert_grid(&data->reals, &data->value_grids);
+    // Micro xs grids are built in scratch space since their values are
+    // replaced by the CDF before being stored
+    ValueGridInserter::RealCollection micro_reals;
+    ValueGridInserter::XsGridCollection micro_grids;
+    ValueGridInserter insert_micro(&micro_reals, &micro_grids);
 
     // Micro xs grid IDs for each model and applicable particle, each material,
     // and each element in the material
@@ -655,7 +813,7 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
                     {
                         CELER_ASSERT(builders[elcomp_idx]);
                         grid_ids[elcomp_idx]
-                            = builders[elcomp_idx]->build(insert_grid);
+                            = builders[elcomp_idx]->build(insert_micro);
                     }
                 }
             }
@@ -663,6 +821,7 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
         }
     }
 
+    ValueGridInserter insert_grid(&data->reals, &data->value_grids);
     auto model_xs = make_builder(&data->model_xs);
     auto value_tables = make_builder(&data->value_tables);
     auto value_table_ids = make_builder(&data->value_table_ids);
@@ -681,27 +840,24 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
                 continue;
             }
 
-            // Get the xs value for the given element and bin
-            auto get_value = [&](size_type elcomp, size_type bin) -> real_type& {
-                XsGridData& grid = data->value_grids[grid_ids[elcomp]];
-                CELER_ASSERT(bin < grid.value.size());
-                return data->reals[grid.value[bin]];
-            };
-
             // Get the number of grid points: the energy grids are the
             // same for each element in the material
-            size_type num_bins = data->value_grids[grid_ids[0]].value.size();
+            size_type num_bins = micro_grids[grid_ids[0]].value.size();
 
             // Calculate the cross section CDF
             auto const&& elements = mats.get(MaterialId{mat_idx}).elements();
+            std::vector<std::vector<real_type>> cdf(
+                elements.size(), std::vector<real_type>(num_bins));
             for (auto bin_idx : range(num_bins))
             {
                 real_type cum_xs{0};
                 for (auto elcomp_idx : range(elements.size()))
                 {
-                    real_type& xs = get_value(elcomp_idx, bin_idx);
-                    cum_xs += xs * elements[elcomp_idx].fraction;
-                    xs = cum_xs;
+                    XsGridData const& grid = micro_grids[grid_ids[elcomp_idx]];
+                    CELER_ASSERT(bin_idx < grid.value.size());
+                    cum_xs += micro_reals[grid.value[bin_idx]]
+                              * elements[elcomp_idx].fraction;
+                    cdf[elcomp_idx][bin_idx] = cum_xs;
                 }
 
                 // Normalize
@@ -709,11 +865,20 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
                 {
                     for (auto elcomp_idx : range(elements.size()))
                     {
-                        real_type& xs = get_value(elcomp_idx, bin_idx);
-                        xs /= cum_xs;
+                        cdf[elcomp_idx][bin_idx] /= cum_xs;
                     }
                 }
             }
+
+            // Store the CDF grids, reusing identical values
+            for (auto elcomp_idx : range(elements.size()))
+            {
+                XsGridData const& grid = micro_grids[grid_ids[elcomp_idx]];
+                grid_ids[elcomp_idx] = insert_grid(grid.log_energy,
+                                                   grid.prime_index,
+                                                   make_span(cdf[elcomp_idx]));
+            }
+
             // Construct value grid table
             ValueTable temp_table;
             temp_table.grids
@@ -20,6 +20,7 @@
 #include "celeritas/Types.hh"
 #include "celeritas/Units.hh"
 #include "celeritas/global/ActionInterface.hh"
+#include "celeritas/grid/ValueGridInserter.hh"
 
 #include "Model.hh"
 #include "PhysicsData.hh"
@@ -59,6 +60,15 @@ class ParticleParams;
  *   processes use MC integration to sample the discrete interaction length
  *   with the correct probability. Disable this integral approach for all
  *   processes.
+ * - \c fused_xs: for each particle type and material, resample the
+ *   macroscopic cross sections of all processes onto a single log-energy grid
+ *   so that the cross sections can be calculated with one grid lookup during
+ *   the pre-step.
+ * - \c validate_tables: compare the cross section, energy loss, and range
+ *   values interpolated from the stored tables against the original
+ *   double-precision data, and report the largest relative difference. This
+ *   is mainly useful when tables are stored in single precision (\c
+ *   CELERITAS_FLOAT_TABLES ).
  *
  * NOTE: min_range/max_step_over_range are not accessible through Geant4, and
  * they can also be set to be different for electrons, mu/hadrons, and ions
@@ -84,6 +94,8 @@ struct PhysicsParamsOptions
 
     real_type secondary_stack_factor = 3;
     bool disable_integral_xs = false;
+    bool fused_xs = false;
+    bool validate_tables = false;
 };
 
 //---------------------------------------------------------------------------//
@@ -178,6 +190,9 @@ class PhysicsParams
     //! Access physics properties on the device
     DeviceRef const& device_ref() const { return data_.device(); }
 
+    //! Accuracy of the stored tables (if validated)
+    ValueGridAccuracy const& table_accuracy() const { return table_accuracy_; }
+
   private:
     using SPAction = std::shared_ptr<ConcreteAction>;
     using VecModel = std::vector<std::pair<SPConstModel, ProcessId>>;
@@ -200,14 +215,19 @@ class PhysicsParams
     // Host/device storage and reference
     CollectionMirror<PhysicsParamsData> data_;
 
+    // Difference between stored and source tables
+    ValueGridAccuracy table_accuracy_;
+
   private:
     VecModel build_models(ActionRegistry*) const;
     void build_options(Options const& opts, HostValue* data) const;
     void build_ids(ParticleParams const& particles, HostValue* data) const;
     void build_xs(Options const& opts,
                   MaterialParams const& mats,
+                  ValueGridAccuracy* accuracy,
                   HostValue* data) const;
     void build_model_xs(MaterialParams const& mats, HostValue* data) const;
+    void build_fused_xs(MaterialParams const& mats, HostValue* data) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "PhysicsParamsOutput.hh"
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -99,6 +100,7 @@ void PhysicsParamsOutput::output(JsonPimpl* j) const
         auto sizes = json::object();
 #    define PPO_SAVE_SIZE(NAME) sizes[#NAME] = data.NAME.size()
         PPO_SAVE_SIZE(reals);
+        PPO_SAVE_SIZE(energies);
         PPO_SAVE_SIZE(model_ids);
         PPO_SAVE_SIZE(value_grids);
         PPO_SAVE_SIZE(value_grid_ids);
@@ -111,6 +113,43 @@ void PhysicsParamsOutput::output(JsonPimpl* j) const
         obj["sizes"] = std::move(sizes);
     }
 
+    // Save memory saved by reusing identical table values
+    {
+        auto const& data = physics_->host_ref();
+
+        std::size_t num_reals = 0;
+        for (auto const& grid :
+             data.value_grids[AllItems<XsGridData, MemSpace::host>{}])
+        {
+            num_reals += grid.value.size();
+        }
+        std::size_t num_primes = 0;
+        for (auto const& grid :
+             data.fused_xs_grids[AllItems<FusedXsGridData, MemSpace::host>{}])
+        {
+            num_reals += grid.energy.size() + grid.value.size();
+            num_primes += grid.prime_index.size();
+        }
+        CELER_ASSERT(num_reals >= data.reals.size()
+                     && num_primes >= data.fused_prime_indices.size());
+        obj["dedup"] = {
+            {"num_reals", num_reals - data.reals.size()},
+            {"bytes_saved",
+             (num_reals - data.reals.size()) * sizeof(table_real_type)
+                 + (num_primes - data.fused_prime_indices.size())
+                       * sizeof(size_type)},
+        };
+    }
+
+    // Save table validation results
+    if (auto const& accuracy = physics_->table_accuracy(); accuracy.num_points)
+    {
+        obj["table_accuracy"] = {
+            {"num_points", accuracy.num_points},
+            {"max_rel_error", accuracy.max_rel_error},
+        };
+    }
+
     j->obj = std::move(obj);
 #else
     (void)sizeof(j);
@@ -30,6 +30,108 @@
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a process's cross section can be interpolated from the fused grid.
+ *
+ * Hardwired cross sections are calculated on the fly, and integral processes
+ * whose maximum cross section lies inside the step's energy range need the
+ * cross section at that energy.
+ */
+inline CELER_FUNCTION bool
+is_fused_xs(PhysicsTrackView const& physics,
+            ParticleProcessId ppid,
+            units::MevEnergy energy,
+            units::MevEnergy energy_xi)
+{
+    if (physics.hardwired_model(ppid, energy))
+    {
+        return false;
+    }
+    if (auto const& process = physics.integral_xs_process(ppid))
+    {
+        real_type energy_max_xs = physics.energy_max_xs(process);
+        return !physics.hardwired_model(ppid, energy_xi)
+               && !(energy_max_xs >= energy_xi.value()
+                    && energy_max_xs < energy.value());
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate all process cross sections using the fused cross section grid.
+ *
+ * The energy is located once on the common grid, and the cross sections of
+ * all processes are interpolated from adjacent values. Integral processes use
+ * a second lookup at the lower bound of the step's energy range. The
+ * per-process cross sections are saved and the total is returned.
+ */
+inline CELER_FUNCTION real_type
+calc_fused_macro_xs(FusedXsGridId grid_id,
+                    MaterialTrackView const& material,
+                    ParticleTrackView const& particle,
+                    PhysicsTrackView const& physics,
+                    PhysicsStepView& pstep)
+{
+    using Energy = units::MevEnergy;
+
+    auto const num_processes = physics.num_particle_processes();
+    Energy const energy = particle.energy();
+    Energy const energy_xi{energy.value()
+                           * physics.scalars().min_eprime_over_e};
+
+    bool needs_xi = false;
+    {
+        auto const calc_xs = physics.make_fused_xs_calculator(grid_id, energy);
+        for (auto ppid : range(ParticleProcessId{num_processes}))
+        {
+            auto const& process = physics.integral_xs_process(ppid);
+            real_type process_xs = 0;
+            if (is_fused_xs(physics, ppid, energy, energy_xi))
+            {
+                process_xs = calc_xs(ppid.get());
+                needs_xi = needs_xi || static_cast<bool>(process);
+            }
+            else if (process)
+            {
+                process_xs = physics.calc_max_xs(
+                    process, ppid, material.make_material_view(), energy);
+            }
+            else
+            {
+                process_xs = physics.calc_xs(
+                    ppid, material.make_material_view(), energy);
+            }
+            pstep.per_process_xs(ppid) = process_xs;
+        }
+    }
+
+    if (needs_xi)
+    {
+        // Integral processes use the larger of the cross sections at the
+        // bounds of the step's energy range
+        auto const calc_xs
+            = physics.make_fused_xs_calculator(grid_id, energy_xi);
+        for (auto ppid : range(ParticleProcessId{num_processes}))
+        {
+            if (physics.integral_xs_process(ppid)
+                && is_fused_xs(physics, ppid, energy, energy_xi))
+            {
+                real_type& process_xs = pstep.per_process_xs(ppid);
+                process_xs = max(process_xs, calc_xs(ppid.get()));
+            }
+        }
+    }
+
+    real_type total_macro_xs = 0;
+    for (auto ppid : range(ParticleProcessId{num_processes}))
+    {
+        total_macro_xs += pstep.per_process_xs(ppid);
+    }
+    return total_macro_xs;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Calculate physics step limits based on cross sections and range limiters.
@@ -51,26 +153,39 @@ calc_physics_step_limit(MaterialTrackView const& material,
     // Loop over all processes that apply to this track (based on particle
     // type) and calculate cross section and particle range.
     real_type total_macro_xs = 0;
-    for (auto ppid : range(ParticleProcessId{physics.num_particle_processes()}))
+    if (auto grid_id = physics.fused_xs_grid())
     {
-        real_type process_xs = 0;
-        if (auto const& process = physics.integral_xs_process(ppid))
-        {
-            // If the integral approach is used and this particle has an energy
-            // loss process, estimate the maximum cross section over the step
-            process_xs = physics.calc_max_xs(
-                process, ppid, material.make_material_view(), particle.energy());
-        }
-        else
+        // Interpolate all processes after a single grid lookup
+        total_macro_xs = calc_fused_macro_xs(
+            grid_id, material, particle, physics, pstep);
+    }
+    else
+    {
+        auto const num_processes = physics.num_particle_processes();
+        for (auto ppid : range(ParticleProcessId{num_processes}))
         {
-            // Calculate the macroscopic cross section for this process
-            process_xs = physics.calc_xs(
-                ppid, material.make_material_view(), particle.energy());
+            real_type process_xs = 0;
+            if (auto const& process = physics.integral_xs_process(ppid))
+            {
+                // If the integral approach is used and this particle has an
+                // energy loss process, estimate the maximum cross section
+                // over the step
+                process_xs = physics.calc_max_xs(process,
+                                                 ppid,
+                                                 material.make_material_view(),
+                                                 particle.energy());
+            }
+            else
+            {
+                // Calculate the macroscopic cross section for this process
+                process_xs = physics.calc_xs(
+                    ppid, material.make_material_view(), particle.energy());
+            }
+            // Accumulate process cross section into the total cross section
+            // and save it for later
+            total_macro_xs += process_xs;
+            pstep.per_process_xs(ppid) = process_xs;
         }
-        // Accumulate process cross section into the total cross section and
-        // save it for later
-        total_macro_xs += process_xs;
-        pstep.per_process_xs(ppid) = process_xs;
     }
     pstep.macro_xs(total_macro_xs);
     CELER_ASSERT(total_macro_xs > 0 || !particle.is_stopped());
@@ -15,6 +15,7 @@
 #include "celeritas/Types.hh"
 #include "celeritas/em/xs/EPlusGGMacroXsCalculator.hh"
 #include "celeritas/em/xs/LivermorePEMacroXsCalculator.hh"
+#include "celeritas/grid/FusedXsCalculator.hh"
 #include "celeritas/grid/GridIdFinder.hh"
 #include "celeritas/grid/XsCalculator.hh"
 #include "celeritas/mat/MaterialView.hh"
@@ -111,6 +112,13 @@ class PhysicsTrackView
                                                 MaterialView const& material,
                                                 Energy energy) const;
 
+    // Energy of the largest cross section in the current material
+    inline CELER_FUNCTION real_type
+    energy_max_xs(IntegralXsProcess const& process) const;
+
+    // Get the fused cross section grid, null if not present for this material
+    inline CELER_FUNCTION FusedXsGridId fused_xs_grid() const;
+
     // Models that apply to the given process ID
     inline CELER_FUNCTION
         ModelFinder make_model_finder(ParticleProcessId) const;
@@ -150,6 +158,10 @@ class PhysicsTrackView
     template<class T>
     inline CELER_FUNCTION T make_calculator(ValueGridId) const;
 
+    // Construct a calculator for all processes' cross sections at an energy
+    inline CELER_FUNCTION FusedXsCalculator
+    make_fused_xs_calculator(FusedXsGridId, Energy) const;
+
     //// HACKS ////
 
     // Get hardwired model, null if not present
@@ -450,11 +462,7 @@ PhysicsTrackView::calc_max_xs(IntegralXsProcess const& process,
                               MaterialView const& material,
                               Energy energy) const
 {
-    CELER_EXPECT(process);
-    CELER_EXPECT(material_ < process.energy_max_xs.size());
-
-    real_type energy_max_xs
-        = params_.reals[process.energy_max_xs[material_.get()]];
+    real_type energy_max_xs = this->energy_max_xs(process);
     real_type energy_xi = energy.value() * params_.scalars.min_eprime_over_e;
     if (energy_max_xs >= energy_xi && energy_max_xs < energy.value())
     {
@@ -464,6 +472,42 @@ PhysicsTrackView::calc_max_xs(IntegralXsProcess const& process,
                this->calc_xs(ppid, material, Energy{energy_xi}));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Energy of the largest cross section in the current material.
+ */
+CELER_FUNCTION real_type
+PhysicsTrackView::energy_max_xs(IntegralXsProcess const& process) const
+{
+    CELER_EXPECT(process);
+    CELER_EXPECT(material_ < process.energy_max_xs.size());
+
+    return params_.energies[process.energy_max_xs[material_.get()]];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the fused cross section grid for the current particle and material.
+ *
+ * The result is null if fused cross sections are disabled or if no process
+ * has tabulated cross sections for this particle in the current material.
+ */
+CELER_FUNCTION FusedXsGridId PhysicsTrackView::fused_xs_grid() const
+{
+    auto const& grids = this->process_group().fused_xs;
+    if (grids.empty())
+    {
+        return {};
+    }
+    CELER_ASSERT(material_ < grids.size());
+    FusedXsGridId id = grids[material_.get()];
+    if (!params_.fused_xs_grids[id])
+    {
+        return {};
+    }
+    return id;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Return the model ID that applies to the given process ID and energy if the
@@ -505,7 +549,8 @@ PhysicsTrackView::make_model_finder(ParticleProcessId ppid) const
     CELER_EXPECT(ppid < this->num_particle_processes());
     ModelGroup const& md
         = params_.model_groups[this->process_group().models[ppid.get()]];
-    return ModelFinder(params_.reals[md.energy], params_.pmodel_ids[md.model]);
+    return ModelFinder(params_.energies[md.energy],
+                       params_.pmodel_ids[md.model]);
 }
 
 //---------------------------------------------------------------------------//
@@ -664,6 +709,25 @@ CELER_FUNCTION T PhysicsTrackView::make_calculator(ValueGridId id) const
     return T{params_.value_grids[id], params_.reals};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a calculator for all processes' cross sections at an energy.
+ *
+ * The process index of the calculator is the \c ParticleProcessId value.
+ */
+CELER_FUNCTION FusedXsCalculator
+PhysicsTrackView::make_fused_xs_calculator(FusedXsGridId id,
+                                           Energy energy) const
+{
+    CELER_EXPECT(id < params_.fused_xs_grids.size());
+    CELER_EXPECT(params_.fused_xs_grids[id].num_values()
+                 == this->num_particle_processes());
+    return FusedXsCalculator{params_.fused_xs_grids[id],
+                             params_.reals,
+                             params_.fused_prime_indices,
+                             energy};
+}
+
 //---------------------------------------------------------------------------//
 // IMPLEMENTATION HELPER FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -59,6 +59,7 @@ ProcessBuilder::ProcessBuilder(ImportData const& data,
     : input_{std::move(material), std::move(particle), nullptr}
     , user_build_map_(std::move(user_build))
     , brem_combined_(options.brem_combined)
+    , brem_sb_alias_(options.brem_sb_alias)
     , enable_lpm_(data.em_params.lpm)
     , use_integral_xs_(data.em_params.integral_approach)
 {
@@ -154,6 +155,7 @@ auto ProcessBuilder::build_ebrems() -> SPProcess
     options.combined_model = brem_combined_;
     options.enable_lpm = enable_lpm_;
     options.use_integral_xs = use_integral_xs_;
+    options.sb_alias_sampling = brem_sb_alias_;
 
     if (!read_sb_)
     {
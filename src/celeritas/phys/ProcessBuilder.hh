@@ -33,6 +33,7 @@ struct ImportSBTable;
 struct ProcessBuilderOptions
 {
     bool brem_combined{false};
+    bool brem_sb_alias{false};
 };
 
 //---------------------------------------------------------------------------//
@@ -114,6 +115,7 @@ class ProcessBuilder
     std::function<ImportLivermorePE(AtomicNumber)> read_livermore_;
 
     bool brem_combined_;
+    bool brem_sb_alias_;
     bool enable_lpm_;
     bool use_integral_xs_;
 
@@ -0,0 +1,68 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/WoodcockData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/grid/XsGridData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Majorant cross sections for Woodcock (delta) tracking.
+ *
+ * The majorant for each particle type is an upper bound of the total
+ * macroscopic cross section over all materials in the geometry. A particle
+ * type whose majorant grid is not assigned is transported conventionally.
+ */
+template<Ownership W, MemSpace M>
+struct WoodcockParamsData
+{
+    //// TYPES ////
+
+    template<class T>
+    using Items = Collection<T, W, M>;
+    template<class T>
+    using ParticleItems = Collection<T, W, M, ParticleId>;
+
+    //// DATA ////
+
+    Items<table_real_type> reals;
+    ParticleItems<XsGridData> majorant;  //!< Majorant xs [particle]
+
+    //// METHODS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !reals.empty() && !majorant.empty();
+    }
+
+    //! Whether the given particle type uses Woodcock tracking
+    CELER_FUNCTION bool applies(ParticleId particle) const
+    {
+        return particle < majorant.size()
+               && static_cast<bool>(majorant[particle]);
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    WoodcockParamsData& operator=(WoodcockParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        reals = other.reals;
+        majorant = other.majorant;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
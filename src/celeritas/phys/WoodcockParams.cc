@@ -0,0 +1,363 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/WoodcockParams.cc
+//---------------------------------------------------------------------------//
+#include "WoodcockParams.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/Ref.hh"
+#include "corecel/grid/NonuniformGrid.hh"
+#include "corecel/grid/UniformGrid.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/em/data/LivermorePEData.hh"
+#include "celeritas/em/xs/LivermorePEMacroXsCalculator.hh"
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/grid/GenericXsCalculator.hh"
+#include "celeritas/grid/XsCalculator.hh"
+#include "celeritas/mat/MaterialParams.hh"
+#include "celeritas/mat/MaterialView.hh"
+
+#include "ParticleParams.hh"
+#include "ParticleView.hh"
+#include "PhysicsParams.hh"
+#include "PhysicsTrackView.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+using Energy = PhysicsTrackView::Energy;
+
+//! Relative margin for roundoff when evaluating the cross sections
+constexpr real_type roundoff_margin = 1e-5;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Largest tabulated cross section over an energy interval.
+ *
+ * Between adjacent grid points the cross section is either linear in energy
+ * or (above the prime index) \f$ a / E + b \f$, and outside the grid it is
+ * constant or decreasing, so it's monotonic between grid points. One extra
+ * grid point on each side also bounds the values resampled onto a common
+ * grid with equal or finer spacing (the fused cross sections).
+ */
+real_type max_tabulated_xs(XsGridData const& grid,
+                           XsCalculator::Values const& reals,
+                           real_type lo,
+                           real_type hi)
+{
+    XsCalculator const calc_xs(grid, reals);
+    real_type result = std::max(calc_xs(Energy{lo}), calc_xs(Energy{hi}));
+
+    auto const& loge = grid.log_energy;
+    auto to_index = [&loge](real_type energy) {
+        real_type idx = (std::log(energy) - loge.front) / loge.delta;
+        return std::clamp(idx, real_type(0), real_type(loge.size - 1));
+    };
+    auto first = static_cast<size_type>(std::floor(to_index(lo)));
+    auto last = static_cast<size_type>(std::ceil(to_index(hi)));
+    first = first > 0 ? first - 1 : 0;
+    last = std::min(last + 1, loge.size - 1);
+    for (auto i : range(first, last + 1))
+    {
+        result = std::max(result, calc_xs[i]);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Largest value of a linearly interpolated nonuniform grid over an interval.
+ */
+real_type max_generic_xs(GenericGridData const& grid,
+                         GenericXsCalculator::Values const& reals,
+                         real_type lo,
+                         real_type hi)
+{
+    GenericXsCalculator const calc_xs(grid, reals);
+    real_type result = std::max(calc_xs(lo), calc_xs(hi));
+
+    NonuniformGrid<table_real_type> const energy_grid(grid.grid, reals);
+    for (auto i : range(energy_grid.size()))
+    {
+        if (energy_grid[i] > lo && energy_grid[i] < hi)
+        {
+            result = std::max(result, real_type(reals[grid.value[i]]));
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Largest Livermore photoelectric micro cross section over an interval.
+ *
+ * This bounds each regime of \c LivermorePEMicroXsCalculator : the energy is
+ * clamped to the lowest binding energy, the tabulated regimes are linear in
+ * energy scaled by \f$ E^{-3} \f$, and each term of the parameterization is
+ * a power of \f$ 1/E \f$.
+ */
+real_type max_livermore_pe_micro_xs(HostCRef<LivermorePEData> const& pe,
+                                    ElementId el_id,
+                                    real_type lo,
+                                    real_type hi)
+{
+    LivermoreElement const& el = pe.xs.elements[el_id];
+    auto const& shells = pe.xs.shells[el.shells];
+    real_type const k_energy = shells.front().binding_energy.value();
+    real_type const thresh_lo = el.thresh_lo.value();
+    real_type const thresh_hi = el.thresh_hi.value();
+
+    // Split the interval at the boundaries between regimes
+    real_type const min_energy = shells.back().binding_energy.value();
+    std::vector<real_type> edges{std::max(lo, min_energy),
+                                 std::max(hi, min_energy)};
+    for (real_type e : {k_energy, thresh_lo, thresh_hi})
+    {
+        if (e > edges[0] && e < edges[1])
+        {
+            edges.push_back(e);
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+
+    real_type result = 0;
+    for (auto i : range(edges.size() - 1))
+    {
+        real_type const a = edges[i];
+        real_type const b = edges[i + 1];
+        real_type xs = 0;
+        if (a >= thresh_lo)
+        {
+            auto const& param = shells.back().param[a < thresh_hi ? 0 : 1];
+            real_type inv_a_pow = 1 / a;
+            real_type inv_b_pow = 1 / b;
+            for (real_type c : param)
+            {
+                xs += std::max(c * inv_a_pow, c * inv_b_pow);
+                inv_a_pow /= a;
+                inv_b_pow /= b;
+            }
+        }
+        else
+        {
+            auto const& table = a >= k_energy ? el.xs_hi : el.xs_lo;
+            CELER_ASSERT(table);
+            xs = max_generic_xs(table, pe.xs.reals, a, b) / ipow<3>(a);
+        }
+        result = std::max(result, xs);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Largest macroscopic cross section of a process over an energy interval.
+ */
+real_type max_process_xs(PhysicsTrackView const& phys,
+                         HostCRef<PhysicsParamsData> const& phys_ref,
+                         ParticleProcessId ppid,
+                         MaterialView const& material,
+                         real_type lo,
+                         real_type hi)
+{
+    auto const& hardwired = phys_ref.hardwired;
+    if (phys.process(ppid) == hardwired.photoelectric)
+    {
+        // Split at the energy below which the cross sections are calculated
+        // on the fly
+        real_type thresh = hardwired.photoelectric_table_thresh.value();
+        if (lo < thresh && thresh <= hi)
+        {
+            return std::max(
+                max_process_xs(phys, phys_ref, ppid, material, lo, thresh),
+                max_process_xs(phys, phys_ref, ppid, material, thresh, hi));
+        }
+    }
+
+    if (auto model_id = phys.hardwired_model(ppid, Energy{lo}))
+    {
+        CELER_VALIDATE(model_id == hardwired.livermore_pe,
+                       << "Woodcock tracking does not support on-the-fly "
+                          "cross sections for model "
+                       << model_id.unchecked_get());
+        real_type result = 0;
+        for (auto const& el_comp : material.elements())
+        {
+            result += el_comp.fraction
+                      * max_livermore_pe_micro_xs(
+                          hardwired.livermore_pe_data, el_comp.element, lo, hi);
+        }
+        return result * LivermorePEMacroXsCalculator::MicroXsUnits::value()
+               * material.number_density();
+    }
+    if (auto grid_id = phys.value_grid(ValueGridType::macro_xs, ppid))
+    {
+        return max_tabulated_xs(
+            phys_ref.value_grids[grid_id], phys_ref.reals, lo, hi);
+    }
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from physics data and the materials present in the geometry.
+ */
+WoodcockParams::WoodcockParams(ParticleParams const& particles,
+                               MaterialParams const& materials,
+                               GeoMaterialParams const& geo_materials,
+                               PhysicsParams const& physics)
+{
+    // Find the materials present in the geometry
+    std::vector<MaterialId> mat_ids;
+    {
+        std::vector<bool> is_used(materials.size(), false);
+        auto const& volume_materials = geo_materials.host_ref().materials;
+        for (auto vol_id : range(VolumeId{volume_materials.size()}))
+        {
+            if (auto mat_id = volume_materials[vol_id])
+            {
+                is_used[mat_id.get()] = true;
+            }
+        }
+        for (auto mat_id : range(MaterialId{materials.size()}))
+        {
+            if (is_used[mat_id.get()])
+            {
+                mat_ids.push_back(mat_id);
+            }
+        }
+    }
+    CELER_VALIDATE(!mat_ids.empty(),
+                   << "no materials are assigned to geometry volumes");
+
+    // Create a single-track physics state to calculate cross sections
+    auto const& phys_ref = physics.host_ref();
+    HostVal<PhysicsStateData> phys_state;
+    resize(&phys_state, phys_ref, 1);
+    auto phys_state_ref = make_ref(phys_state);
+
+    HostVal<WoodcockParamsData> data;
+    auto reals = make_builder(&data.reals);
+    std::vector<XsGridData> majorants(particles.size());
+    for (auto par_id : range(ParticleId{particles.size()}))
+    {
+        if (particles.get(par_id).charge() != zero_quantity())
+        {
+            continue;
+        }
+
+        // Find the bounds and finest spacing of the cross section grids,
+        // skipping particle types whose energy changes over a step
+        real_type front = std::numeric_limits<real_type>::infinity();
+        real_type back = -front;
+        real_type delta = front;
+        bool is_eligible = true;
+        for (auto mat_id : mat_ids)
+        {
+            PhysicsTrackView phys(
+                phys_ref, phys_state_ref, par_id, mat_id, TrackSlotId{0});
+            is_eligible = is_eligible && !phys.eloss_ppid();
+            for (auto ppid :
+                 range(ParticleProcessId{phys.num_particle_processes()}))
+            {
+                is_eligible = is_eligible && !phys.integral_xs_process(ppid);
+                if (auto grid_id
+                    = phys.value_grid(ValueGridType::macro_xs, ppid))
+                {
+                    auto const& loge = phys_ref.value_grids[grid_id].log_energy;
+                    front = std::min(front, loge.front);
+                    back = std::max(back, loge.back);
+                    delta = std::min(delta, loge.delta);
+                }
+            }
+        }
+        if (!is_eligible || !(front < back))
+        {
+            continue;
+        }
+
+        auto const num_cells = static_cast<size_type>(
+            std::ceil((back - front) / delta - real_type(1e-6)));
+        auto const grid_data
+            = UniformGridData::from_bounds(front, back, num_cells + 1);
+        UniformGrid const loge_grid(grid_data);
+
+        // Bound the total cross section in each grid cell by the sum of the
+        // processes' largest values over the cell
+        std::vector<real_type> cell_max(num_cells, 0);
+        for (auto mat_id : mat_ids)
+        {
+            PhysicsTrackView phys(
+                phys_ref, phys_state_ref, par_id, mat_id, TrackSlotId{0});
+            auto const mat_view = materials.get(mat_id);
+            auto const num_ppids = phys.num_particle_processes();
+            for (auto i : range(num_cells))
+            {
+                real_type const lo = std::exp(loge_grid[i]);
+                real_type const hi = std::exp(loge_grid[i + 1]);
+                real_type total_xs = 0;
+                for (auto ppid : range(ParticleProcessId{num_ppids}))
+                {
+                    total_xs += max_process_xs(
+                        phys, phys_ref, ppid, mat_view, lo, hi);
+                }
+                cell_max[i] = std::max(cell_max[i], total_xs);
+            }
+        }
+
+        // Each grid point bounds both of its adjacent cells so that the
+        // linearly interpolated majorant bounds the cross sections
+        std::vector<real_type> values(loge_grid.size());
+        for (auto i : range(loge_grid.size()))
+        {
+            real_type xs = 0;
+            if (i > 0)
+            {
+                xs = cell_max[i - 1];
+            }
+            if (i < num_cells)
+            {
+                xs = std::max(xs, cell_max[i]);
+            }
+            values[i] = (1 + roundoff_margin) * xs;
+        }
+
+        XsGridData& grid = majorants[par_id.get()];
+        grid.log_energy = grid_data;
+        grid.value = reals.insert_back(values.begin(), values.end());
+        CELER_ASSERT(grid);
+
+        CELER_LOG(debug) << "Built Woodcock majorant cross section for '"
+                         << particles.id_to_label(par_id) << "' over "
+                         << mat_ids.size() << " materials";
+    }
+    CELER_VALIDATE(std::any_of(majorants.begin(),
+                               majorants.end(),
+                               [](XsGridData const& g) { return bool(g); }),
+                   << "no particle types are eligible for Woodcock tracking");
+    make_builder(&data.majorant)
+        .insert_back(majorants.begin(), majorants.end());
+
+    data_ = CollectionMirror<WoodcockParamsData>{std::move(data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,74 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/WoodcockParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+#include "corecel/data/CollectionMirror.hh"
+
+#include "WoodcockData.hh"
+
+namespace celeritas
+{
+class GeoMaterialParams;
+class MaterialParams;
+class ParticleParams;
+class PhysicsParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build majorant cross sections for Woodcock (delta) tracking.
+ *
+ * Woodcock tracking samples the distance to the next collision using a
+ * majorant cross section that bounds the total cross section in every
+ * material, so that neutral particles can travel through geometry boundaries
+ * without stopping. At each collision the geometry is queried for the
+ * material, and the collision is real with probability \f$ \Sigma(E) /
+ * \Sigma_\mathrm{maj}(E) \f$ and fictitious otherwise.
+ *
+ * The entire geometry is treated as a single region: the majorant is taken
+ * over every material assigned to a volume. It is applied to neutral particle
+ * types that have discrete processes but no energy loss or integral cross
+ * sections (i.e., photons in EM physics).
+ *
+ * The majorant is tabulated on the union of the particle's cross section
+ * grids. In each grid cell, every process's cross section is bounded
+ * exactly: tabulated cross sections are monotonic between their grid points,
+ * and each regime of the on-the-fly Livermore photoelectric cross section
+ * (including the absorption edges) is bounded analytically. Each majorant
+ * grid point takes the larger bound of its two adjacent cells, plus a tiny
+ * margin for roundoff, so that the interpolated majorant is never less than
+ * the total cross section.
+ */
+class WoodcockParams
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using HostRef = HostCRef<WoodcockParamsData>;
+    using DeviceRef = DeviceCRef<WoodcockParamsData>;
+    //!@}
+
+  public:
+    // Construct from physics data and the materials present in the geometry
+    WoodcockParams(ParticleParams const& particles,
+                   MaterialParams const& materials,
+                   GeoMaterialParams const& geo_materials,
+                   PhysicsParams const& physics);
+
+    //! Access majorant data on the host
+    HostRef const& host_ref() const { return data_.host(); }
+
+    //! Access majorant data on the device
+    DeviceRef const& device_ref() const { return data_.device(); }
+
+  private:
+    CollectionMirror<WoodcockParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
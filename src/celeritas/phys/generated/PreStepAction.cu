@@ -11,6 +11,7 @@
 #include "corecel/device_runtime_api.h"
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/KernelParamCalculator.device.hh"
 #include "corecel/sys/Device.hh"
 #include "celeritas/global/TrackLauncher.hh"
@@ -33,26 +34,32 @@ __launch_bounds__(1024, 7)
 #endif // CELERITAS_LAUNCH_BOUNDS
 pre_step_kernel(
     DeviceCRef<CoreParamsData> const params,
-    DeviceRef<CoreStateData> const state
+    DeviceRef<CoreStateData> const state,
+    Range<ThreadId> const threads
 )
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < state.size()))
+    if (!(tid < threads.size()))
         return;
 
     auto launch = make_track_launcher(params, state, detail::pre_step_track);
-    launch(tid);
+    launch(threads[tid.get()]);
 }
 }  // namespace
 
 void PreStepAction::execute(ParamsDeviceCRef const& params, StateDeviceRef& state) const
 {
     CELER_EXPECT(params && state);
+    auto const threads = range(ThreadId{state.num_threads});
+    if (threads.empty())
+        return;
+
     CELER_LAUNCH_KERNEL(pre_step,
                         celeritas::device().default_block_size(),
-                        state.size(),
+                        threads.size(),
                         params,
-                        state);
+                        state,
+                        threads);
 }
 
 }  // namespace generated
@@ -0,0 +1,79 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/CompactTracksAction.cc
+//---------------------------------------------------------------------------//
+#include "CompactTracksAction.hh"
+
+#include <algorithm>
+
+#include "corecel/Assert.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+#include "detail/TrackSortUtils.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+void compact_tracks(CoreParamsData<Ownership::const_reference, M> const& params,
+                    CoreStateData<Ownership::reference, M>& states)
+{
+    auto const& init = states.init;
+
+    // Live tracks plus the tracks to be initialized at the next step
+    size_type num_threads
+        = states.size() - init.vacancies.size()
+          + std::min(init.vacancies.size(), init.initializers.size());
+
+    if (num_threads < params.init.compaction_threshold * states.size())
+    {
+        detail::compact_track_slots(states);
+        states.num_threads = num_threads;
+    }
+    else
+    {
+        states.num_threads = states.size();
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with action ID.
+ */
+CompactTracksAction::CompactTracksAction(ActionId id) : id_(id)
+{
+    CELER_EXPECT(id_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the action with host data.
+ */
+void CompactTracksAction::execute(ParamsHostCRef const& params,
+                                  StateHostRef& states) const
+{
+    CELER_EXPECT(params && states);
+    compact_tracks(params, states);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the action with device data.
+ */
+void CompactTracksAction::execute(ParamsDeviceCRef const& params,
+                                  StateDeviceRef& states) const
+{
+    CELER_EXPECT(params && states);
+    compact_tracks(params, states);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,66 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/CompactTracksAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "celeritas/global/ActionInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Pack live tracks to the front of the thread range when occupancy is low.
+ *
+ * New tracks are initialized in place, so as a shower dies out the remaining
+ * live tracks become scattered across the full state and every kernel still
+ * launches over all track slots. At the end of each step, if fewer than the
+ * \c TrackInitParams compaction threshold of the track slots will be occupied
+ * at the next step, this action reorders the thread-to-slot mapping so that
+ * the live tracks and the vacancies about to be filled come first, and it
+ * reduces the number of threads launched by the thread-indexed actions.
+ * Otherwise the number of threads is reset to the full state size.
+ *
+ * This must execute after the track initializers and vacancies have been
+ * updated at the end of the step.
+ *
+ * \sa celeritas::action_thread_range
+ */
+class CompactTracksAction final : public ExplicitActionInterface
+{
+  public:
+    // Construct with explicit Id
+    explicit CompactTracksAction(ActionId id);
+
+    // Execute the action with host data
+    void
+    execute(ParamsHostCRef const& params, StateHostRef& states) const final;
+
+    // Execute the action with device data
+    void execute(ParamsDeviceCRef const& params,
+                 StateDeviceRef& states) const final;
+
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+
+    //! Short name for the action
+    std::string label() const final { return "compact-tracks"; }
+
+    //! Description of the action for user interaction
+    std::string description() const final
+    {
+        return "compact live tracks at low occupancy";
+    }
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return ActionOrder::end; }
+
+  private:
+    ActionId id_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -15,6 +15,10 @@ namespace celeritas
 /*!
  * Create track initializers on device from secondary particles.
  *
+ * Pending track initializers that exceed the initializer capacity are moved
+ * to the state's host backlog, if it has one, and returned to the device as
+ * track slots become vacant.
+ *
  * \sa celeritas::extend_from_secondaries
  */
 class ExtendFromSecondariesAction final : public ExplicitActionInterface
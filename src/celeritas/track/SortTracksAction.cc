@@ -0,0 +1,122 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/SortTracksAction.cc
+//---------------------------------------------------------------------------//
+#include "SortTracksAction.hh"
+
+#include "corecel/Assert.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+#include "detail/TrackSortUtils.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+void sort_tracks(TrackOrder track_order,
+                 CoreParamsData<Ownership::const_reference, M> const& params,
+                 CoreStateData<Ownership::reference, M>& states)
+{
+    switch (track_order)
+    {
+        case TrackOrder::sort_step_limit_action:
+            CELER_VALIDATE(!states.thread_offsets.empty(),
+                           << "thread offsets were not allocated for sorting");
+            return detail::partition_tracks_by_action(states);
+        case TrackOrder::partition_charge:
+            return detail::partition_tracks_by_charge(params, states);
+        case TrackOrder::sort_particle_energy:
+            return detail::sort_tracks_by_particle_energy(states);
+        default:
+            CELER_ASSERT_UNREACHABLE();
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with action ID and sort criteria.
+ */
+SortTracksAction::SortTracksAction(ActionId id, TrackOrder track_order)
+    : id_(id), track_order_(track_order)
+{
+    CELER_EXPECT(id_);
+    CELER_VALIDATE(track_order_ == TrackOrder::sort_step_limit_action
+                       || track_order_ == TrackOrder::partition_charge
+                       || track_order_ == TrackOrder::sort_particle_energy,
+                   << "track order " << static_cast<int>(track_order_)
+                   << " does not require a sorting action");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the action with host data.
+ */
+void SortTracksAction::execute(ParamsHostCRef const& params,
+                               StateHostRef& states) const
+{
+    CELER_EXPECT(params && states);
+    sort_tracks(track_order_, params, states);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the action with device data.
+ */
+void SortTracksAction::execute(ParamsDeviceCRef const& params,
+                               StateDeviceRef& states) const
+{
+    CELER_EXPECT(params && states);
+    sort_tracks(track_order_, params, states);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Short name for the action.
+ */
+std::string SortTracksAction::label() const
+{
+    return track_order_ == TrackOrder::sort_step_limit_action
+               ? "sort-tracks-post-step"
+               : "sort-tracks-along-step";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Description of the action for user interaction.
+ */
+std::string SortTracksAction::description() const
+{
+    switch (track_order_)
+    {
+        case TrackOrder::sort_step_limit_action:
+            return "partition tracks by post-step action";
+        case TrackOrder::partition_charge:
+            return "partition tracks by particle charge";
+        case TrackOrder::sort_particle_energy:
+            return "sort tracks by particle type and energy";
+        default:
+            CELER_ASSERT_UNREACHABLE();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Dependency ordering of the action.
+ */
+ActionOrder SortTracksAction::order() const
+{
+    return track_order_ == TrackOrder::sort_step_limit_action
+               ? ActionOrder::sort_pre_post
+               : ActionOrder::sort_pre;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
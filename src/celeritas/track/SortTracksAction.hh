@@ -0,0 +1,68 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/SortTracksAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "celeritas/Types.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Reorder track slots to improve coherence of subsequent actions.
+ *
+ * For \c TrackOrder::sort_step_limit_action , after the discrete interaction
+ * has been selected, the track slots are reordered so that all tracks
+ * undergoing the same post-step action are contiguous, and the first thread of
+ * each action is saved to the state. Post-step actions such as interactions
+ * and boundary crossings then only launch over their own range of threads
+ * rather than the entire state.
+ *
+ * For \c TrackOrder::partition_charge and \c TrackOrder::sort_particle_energy
+ * the track slots are reordered after the pre-step so that neighboring threads
+ * in the along-step kernels take the same branches (neutral versus charged
+ * propagation) and access nearby physics table data.
+ *
+ * \sa celeritas::action_thread_range
+ */
+class SortTracksAction final : public ExplicitActionInterface
+{
+  public:
+    // Construct with action ID and sort criteria
+    SortTracksAction(ActionId id, TrackOrder track_order);
+
+    //! Default destructor
+    ~SortTracksAction() = default;
+
+    // Execute the action with host data
+    void
+    execute(ParamsHostCRef const& params, StateHostRef& states) const final;
+
+    // Execute the action with device data
+    void execute(ParamsDeviceCRef const& params,
+                 StateDeviceRef& states) const final;
+
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+
+    // Short name for the action
+    std::string label() const final;
+
+    // Description of the action for user interaction
+    std::string description() const final;
+
+    // Dependency ordering of the action
+    ActionOrder order() const final;
+
+  private:
+    ActionId id_;
+    TrackOrder track_order_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
+
 #include "corecel/Types.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/data/Collection.hh"
@@ -37,13 +39,16 @@ struct TrackInitParamsData
     size_type max_events{0};  //!< Maximum number of events that can be run
     TrackOrder track_order{TrackOrder::unsorted};  //!< How to sort tracks on
                                                     //!< gpu
+    real_type compaction_threshold{0};  //!< Fraction of track slots below
+                                        //!< which live tracks are compacted
 
     //// METHODS ////
 
     //! Whether the data are assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return capacity > 0 && max_events > 0;
+        return capacity > 0 && max_events > 0 && compaction_threshold >= 0
+               && compaction_threshold <= 1;
     }
 
     //! Assign from another set of data
@@ -54,6 +59,7 @@ struct TrackInitParamsData
         capacity = other.capacity;
         max_events = other.max_events;
         track_order = other.track_order;
+        compaction_threshold = other.compaction_threshold;
         return *this;
     }
 };
@@ -152,6 +158,8 @@ struct ResizableData
  * - \c track_counters stores the total number of particles that have been
  *   created per event.
  * - \c secondary_counts stores the number of secondaries created by each track
+ * - \c backlog is optional host storage, owned by the stepper, for pending
+ *   initializers that exceed the capacity
  */
 template<Ownership W, MemSpace M>
 struct TrackInitStateData
@@ -175,6 +183,8 @@ struct TrackInitStateData
 
     size_type num_secondaries{};  //!< Number of secondaries produced in a step
     size_type num_active{}; //!< Number of active tracks at start of a step
+    size_type num_backlog{};  //!< Number of initializers spilled to host
+    std::vector<TrackInitializer>* backlog{nullptr};  //!< Host only
 
     //// METHODS ////
 
@@ -196,6 +206,8 @@ struct TrackInitStateData
         secondary_counts = other.secondary_counts;
         track_counters = other.track_counters;
         num_secondaries = other.num_secondaries;
+        num_backlog = other.num_backlog;
+        backlog = other.backlog;
         return *this;
     }
 };
@@ -22,11 +22,16 @@ TrackInitParams::TrackInitParams(Input const& inp)
 {
     CELER_EXPECT(inp.capacity > 0);
     CELER_EXPECT(inp.max_events > 0);
+    CELER_VALIDATE(inp.compaction_threshold >= 0
+                       && inp.compaction_threshold <= 1,
+                   << "invalid compaction threshold "
+                   << inp.compaction_threshold << " (must be in [0, 1])");
 
     HostVal<TrackInitParamsData> host_data;
     host_data.capacity = inp.capacity;
     host_data.max_events = inp.max_events;
     host_data.track_order = inp.track_order;
+    host_data.compaction_threshold = inp.compaction_threshold;
     CELER_ASSERT(host_data);
     data_ = CollectionMirror<TrackInitParamsData>{std::move(host_data)};
 }
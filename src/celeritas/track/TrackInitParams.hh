@@ -32,7 +32,8 @@ class TrackInitParams
     {
         size_type capacity;  //!< Max number of initializers
         size_type max_events;  //!< Max number of events that can be run
-        TrackOrder track_order;  //!< How to sort tracks on gpu
+        TrackOrder track_order{TrackOrder::unsorted};  //!< How to sort tracks
+        real_type compaction_threshold{0};  //!< Occupancy to compact below
     };
 
   public:
@@ -42,6 +43,15 @@ class TrackInitParams
     //! Event number cannot exceed this value
     size_type max_events() const { return host_ref().max_events; }
 
+    //! Track sorting strategy
+    TrackOrder track_order() const { return host_ref().track_order; }
+
+    //! Fraction of occupied track slots below which tracks are compacted
+    real_type compaction_threshold() const
+    {
+        return host_ref().compaction_threshold;
+    }
+
     //! Access primaries for contructing track initializer states
     HostRef const& host_ref() const { return data_.host(); }
 
@@ -8,8 +8,12 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <algorithm>
+#include <numeric>
 #include <type_traits>
+#include <vector>
 
+#include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionBuilder.hh"
 #include "corecel/data/Copier.hh"
 #include "corecel/data/Ref.hh"
@@ -18,6 +22,8 @@
 
 #include "TrackInitData.hh"
 #include "detail/TrackInitAlgorithms.hh"
+#include "detail/TrackInitBacklog.hh"
+#include "generated/ExtractTracks.hh"
 #include "generated/InitTracks.hh"
 #include "generated/LocateAlive.hh"
 #include "generated/ProcessPrimaries.hh"
@@ -46,6 +52,10 @@ inline void extend_from_primaries(
     // Resizing the initializers is a non-const operation, but the only one.
     data.resize(data.size() + host_primaries.size());
 
+    // Primaries may be initialized in any vacant slot, so launch over every
+    // thread until the tracks are compacted again
+    core_states.num_threads = core_states.size();
+
     // Allocate memory and copy primaries
     Collection<Primary, Ownership::value, M> primaries;
     resize(&primaries, host_primaries.size());
@@ -150,6 +160,12 @@ inline void initialize_tracks(
    vacancies          | 1  4
 
    \endverbatim
+ *
+ * If the state has a host \c backlog , pending track initializers that don't
+ * fit alongside the new secondaries are moved ("spilled") to it rather than
+ * raising an error, and they are moved back to the device as vacancies open
+ * up. The secondaries created in this step are never spilled since they may
+ * need to copy the geometry state from their parents.
  */
 template<MemSpace M>
 inline void extend_from_secondaries(
@@ -180,8 +196,13 @@ inline void extend_from_secondaries(
     data.num_secondaries = detail::exclusive_scan_counts<M>(
         data.secondary_counts[AllItems<size_type, M>{}]);
 
-    // TODO: if we don't have space for all the secondaries, we will need to
-    // buffer the current track initializers to create room
+    if (data.backlog)
+    {
+        // Move pending track initializers between the device and the host
+        // backlog to make room for the new secondaries or fill vacancies
+        detail::exchange_backlog<M>(data, data.backlog);
+    }
+
     CELER_VALIDATE(data.num_secondaries + data.initializers.size()
                        <= data.initializers.capacity(),
                    << "insufficient capacity (" << data.initializers.capacity()
@@ -195,5 +216,124 @@ inline void extend_from_secondaries(
     generated::process_secondaries(core_params, core_states);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Remove all alive tracks from the state and return them as initializers.
+ *
+ * This is used to hand a small number of remaining tracks to another state
+ * (e.g. to finish transporting them on the host) rather than stepping a mostly
+ * empty state. The extracted initializers keep the track, parent, and event
+ * IDs of the original tracks. Afterward, every track slot is vacant. This must
+ * only be called at the end of a step when there are no pending track
+ * initializers.
+ */
+template<MemSpace M>
+inline std::vector<TrackInitializer> extract_tracks(
+    CoreParamsData<Ownership::const_reference, M> const& core_params,
+    CoreStateData<Ownership::reference, M>& core_states)
+{
+    CELER_EXPECT(core_params && core_states);
+    CELER_EXPECT(core_states.init.initializers.size() == 0);
+
+    // Launch a kernel to save and deactivate the alive tracks
+    Collection<TrackInitializer, Ownership::value, M> inits;
+    resize(&inits, core_states.size());
+    generated::extract_tracks(
+        core_params, core_states, inits[AllItems<TrackInitializer, M>{}]);
+
+    // Copy to host and remove empty slots
+    std::vector<TrackInitializer> result(core_states.size());
+    Copier<TrackInitializer, M> copy_inits{
+        inits[AllItems<TrackInitializer, M>{}]};
+    copy_inits(MemSpace::host, make_span(result));
+    result.erase(std::remove_if(result.begin(),
+                                result.end(),
+                                [](TrackInitializer const& init) {
+                                    return !init.particle.particle_id;
+                                }),
+                 result.end());
+
+    // Mark all track slots as vacant
+    auto& vacancies = core_states.init.vacancies;
+    std::vector<TrackSlotId> slots(core_states.size());
+    std::iota(slots.begin(), slots.end(), TrackSlotId{0});
+    vacancies.resize(slots.size());
+    Copier<TrackSlotId, MemSpace::host> copy_slots{make_span(slots)};
+    copy_slots(M, vacancies.data());
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add track initializers that were extracted from another state.
+ *
+ * The initializers already have unique track IDs, so unlike \c
+ * extend_from_primaries this does not increment the per-event track counters.
+ */
+template<MemSpace M>
+inline void
+extend_from_initializers(CoreStateData<Ownership::reference, M>& core_states,
+                         Span<TrackInitializer const> host_inits)
+{
+    CELER_EXPECT(core_states);
+    CELER_EXPECT(!host_inits.empty());
+
+    auto& data = core_states.init.initializers;
+    CELER_ASSERT(host_inits.size() + data.size() <= data.capacity());
+    data.resize(data.size() + host_inits.size());
+
+    // Tracks may be initialized in any vacant slot, so launch over every
+    // thread until the tracks are compacted again
+    core_states.num_threads = core_states.size();
+
+    Copier<TrackInitializer, MemSpace::host> copy{host_inits};
+    copy(M, data.data().last(host_inits.size()));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the number of tracks created so far in each event to the host.
+ */
+template<MemSpace M>
+inline std::vector<TrackId::size_type>
+get_track_counters(CoreStateData<Ownership::reference, M> const& core_states)
+{
+    CELER_EXPECT(core_states);
+
+    auto const& counters = core_states.init.track_counters;
+    std::vector<TrackId::size_type> result(counters.size());
+    Copier<TrackId::size_type, M> copy{
+        counters[AllItems<TrackId::size_type, M>{}]};
+    copy(MemSpace::host, make_span(result));
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Raise the per-event track counters to at least the given values.
+ *
+ * This is used when tracks are moved between states so that new secondaries
+ * in either state get track IDs that weren't used by the other.
+ */
+template<MemSpace M>
+inline void
+merge_track_counters(CoreStateData<Ownership::reference, M>& core_states,
+                     Span<TrackId::size_type const> host_counters)
+{
+    CELER_EXPECT(core_states);
+
+    auto counters = get_track_counters(core_states);
+    CELER_EXPECT(host_counters.size() == counters.size());
+    for (auto i : range(counters.size()))
+    {
+        counters[i] = std::max(counters[i], host_counters[i]);
+    }
+
+    Copier<TrackId::size_type, MemSpace::host> copy{make_span(counters)};
+    copy(M,
+         core_states.init.track_counters[AllItems<TrackId::size_type, M>{}]);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
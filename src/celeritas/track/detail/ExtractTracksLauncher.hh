@@ -0,0 +1,123 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/ExtractTracksLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/phys/ParticleTrackView.hh"
+
+#include "../SimTrackView.hh"
+#include "../TrackInitData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Remove alive tracks from the state and save them as track initializers.
+ *
+ * Each track slot writes to the initializer with the same index. Initializers
+ * for slots without an alive track have an invalid particle ID. The track,
+ * parent, and event IDs are preserved. Extracted tracks are marked as inactive
+ * so that the slot can be reused. Tracks that are on a boundary are moved
+ * slightly forward into their current volume since a geometry state can't be
+ * initialized from a point on a surface.
+ */
+template<MemSpace M>
+class ExtractTracksLauncher
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using ParamsRef = CoreParamsData<Ownership::const_reference, M>;
+    using StateRef = CoreStateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    // Construct with shared and state data
+    CELER_FUNCTION ExtractTracksLauncher(ParamsRef const& params,
+                                         StateRef const& states,
+                                         Span<TrackInitializer> initializers)
+        : params_(params), states_(states), initializers_(initializers)
+    {
+        CELER_EXPECT(params_);
+        CELER_EXPECT(states_);
+        CELER_EXPECT(initializers_.size() == states_.size());
+    }
+
+    // Extract the track in a single slot
+    inline CELER_FUNCTION void operator()(TrackSlotId tid) const;
+
+    CELER_FORCEINLINE_FUNCTION void operator()(ThreadId tid) const
+    {
+        // The grid size should be equal to the state size and no thread/slot
+        // remapping should be performed
+        return (*this)(TrackSlotId{tid.unchecked_get()});
+    }
+
+  private:
+    ParamsRef const& params_;
+    StateRef const& states_;
+    Span<TrackInitializer> initializers_;
+
+    //! Relative distance to move tracks off a boundary
+    static CELER_CONSTEXPR_FUNCTION real_type bump_rel() { return 1e-8; }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Extract the track in a single slot.
+ */
+template<MemSpace M>
+CELER_FUNCTION void ExtractTracksLauncher<M>::operator()(TrackSlotId tid) const
+{
+    TrackInitializer& result = initializers_[tid.unchecked_get()];
+
+    SimTrackView sim(params_.sim, states_.sim, tid);
+    if (sim.status() != TrackStatus::alive)
+    {
+        result = {};
+        return;
+    }
+
+    ParticleTrackView particle(params_.particles, states_.particles, tid);
+    GeoTrackView geo(params_.geometry, states_.geometry, tid);
+
+    result.sim.track_id = sim.track_id();
+    result.sim.parent_id = sim.parent_id();
+    result.sim.event_id = sim.event_id();
+    result.sim.time = sim.time();
+    result.sim.status = TrackStatus::alive;
+    result.particle.particle_id = particle.particle_id();
+    result.particle.energy = particle.energy();
+    result.geo.pos = geo.pos();
+    result.geo.dir = geo.dir();
+    if (geo.is_on_boundary())
+    {
+        // Tracks can't be initialized on a surface: bump the position into
+        // the volume being entered, scaled to the magnitude of the position
+        real_type bump
+            = bump_rel() * celeritas::max(real_type{1}, norm(result.geo.pos));
+        axpy(bump, result.geo.dir, &result.geo.pos);
+    }
+
+    // Free the track slot
+    sim.status(TrackStatus::inactive);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
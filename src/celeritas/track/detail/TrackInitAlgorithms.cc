@@ -9,6 +9,8 @@
 
 #include <algorithm>
 
+#include "corecel/cont/Range.hh"
+
 #include "Utils.hh"
 
 namespace celeritas
@@ -56,6 +58,40 @@ size_type exclusive_scan_counts<MemSpace::host>(Span<size_type> counts)
     return acc;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Count the alive tracks and queued initializers in each event.
+ *
+ * The counts are indexed by event ID and are overwritten.
+ */
+template<>
+void count_tracks_by_event<MemSpace::host>(
+    Span<TrackStatus const> status,
+    Span<EventId const> event_ids,
+    Span<TrackInitializer const> initializers,
+    Span<size_type> counts)
+{
+    CELER_EXPECT(status.size() == event_ids.size());
+
+    std::fill(counts.begin(), counts.end(), size_type(0));
+    auto count_track = [&counts](EventId event) {
+        CELER_ASSERT(event < counts.size());
+        ++counts[event.unchecked_get()];
+    };
+
+    for (auto i : range(status.size()))
+    {
+        if (status[i] == TrackStatus::alive)
+        {
+            count_track(event_ids[i]);
+        }
+    }
+    for (TrackInitializer const& init : initializers)
+    {
+        count_track(init.sim.event_id);
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
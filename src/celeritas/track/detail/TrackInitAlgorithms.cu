@@ -8,11 +8,16 @@
 #include "TrackInitAlgorithms.hh"
 
 #include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/remove.h>
 #include <thrust/scan.h>
 
 #include "corecel/Macros.hh"
 #include "corecel/data/Copier.hh"
+#include "corecel/math/Atomics.hh"
 
 #include "Utils.hh"
 
@@ -73,6 +78,75 @@ size_type exclusive_scan_counts<MemSpace::device>(Span<size_type> counts)
     return partial1 + partial2;
 }
 
+//---------------------------------------------------------------------------//
+namespace
+{
+//! Increment the count of a track's event if it's alive
+struct CountAliveTrack
+{
+    TrackStatus const* status;
+    EventId const* event_ids;
+    size_type* counts;
+
+    CELER_FUNCTION void operator()(size_type i) const
+    {
+        if (status[i] == TrackStatus::alive)
+        {
+            atomic_add(counts + event_ids[i].unchecked_get(), size_type(1));
+        }
+    }
+};
+
+//! Increment the count of an initializer's event
+struct CountInitializer
+{
+    TrackInitializer const* initializers;
+    size_type* counts;
+
+    CELER_FUNCTION void operator()(size_type i) const
+    {
+        atomic_add(counts + initializers[i].sim.event_id.unchecked_get(),
+                   size_type(1));
+    }
+};
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count the alive tracks and queued initializers in each event.
+ *
+ * The counts are indexed by event ID and are overwritten. Each track
+ * atomically increments the count for its event, so only the per-event
+ * counts (rather than the track states) need to be copied to the host.
+ */
+template<>
+void count_tracks_by_event<MemSpace::device>(
+    Span<TrackStatus const> status,
+    Span<EventId const> event_ids,
+    Span<TrackInitializer const> initializers,
+    Span<size_type> counts)
+{
+    CELER_EXPECT(status.size() == event_ids.size());
+
+    thrust::fill(thrust::device_pointer_cast(counts.data()),
+                 thrust::device_pointer_cast(counts.data() + counts.size()),
+                 size_type(0));
+    thrust::for_each(
+        thrust::device,
+        thrust::counting_iterator<size_type>(0),
+        thrust::counting_iterator<size_type>(status.size()),
+        CountAliveTrack{status.data(), event_ids.data(), counts.data()});
+    if (!initializers.empty())
+    {
+        thrust::for_each(
+            thrust::device,
+            thrust::counting_iterator<size_type>(0),
+            thrust::counting_iterator<size_type>(initializers.size()),
+            CountInitializer{initializers.data(), counts.data()});
+    }
+    CELER_DEVICE_CHECK_ERROR();
+}
+
 //---------------------------------------------------------------------------//
 #undef LAUNCH_KERNEL
 }  // namespace detail
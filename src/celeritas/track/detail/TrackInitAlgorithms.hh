@@ -12,6 +12,9 @@
 #include "corecel/Types.hh"
 #include "corecel/cont/Span.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "celeritas/Types.hh"
+
+#include "../TrackInitData.hh"
 
 namespace celeritas
 {
@@ -37,6 +40,27 @@ size_type exclusive_scan_counts<MemSpace::host>(Span<size_type> counts);
 template<>
 size_type exclusive_scan_counts<MemSpace::device>(Span<size_type> counts);
 
+//---------------------------------------------------------------------------//
+// Count the alive tracks and queued initializers in each event
+template<MemSpace M>
+void count_tracks_by_event(Span<TrackStatus const> status,
+                           Span<EventId const> event_ids,
+                           Span<TrackInitializer const> initializers,
+                           Span<size_type> counts);
+
+template<>
+void count_tracks_by_event<MemSpace::host>(
+    Span<TrackStatus const> status,
+    Span<EventId const> event_ids,
+    Span<TrackInitializer const> initializers,
+    Span<size_type> counts);
+template<>
+void count_tracks_by_event<MemSpace::device>(
+    Span<TrackStatus const> status,
+    Span<EventId const> event_ids,
+    Span<TrackInitializer const> initializers,
+    Span<size_type> counts);
+
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
@@ -53,6 +77,16 @@ inline size_type exclusive_scan_counts<MemSpace::device>(Span<size_type>)
     CELER_NOT_CONFIGURED("CUDA or HIP");
 }
 
+template<>
+inline void
+count_tracks_by_event<MemSpace::device>(Span<TrackStatus const>,
+                                        Span<EventId const>,
+                                        Span<TrackInitializer const>,
+                                        Span<size_type>)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+
 #endif
 //---------------------------------------------------------------------------//
 }  // namespace detail
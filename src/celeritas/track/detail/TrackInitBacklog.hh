@@ -0,0 +1,77 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/TrackInitBacklog.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/Copier.hh"
+
+#include "../TrackInitData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Exchange pending track initializers with a host backlog.
+ *
+ * This must be called after the number of new secondaries has been calculated
+ * but before the track initializers are created from them.
+ * - If the new secondaries don't fit in the remaining capacity, the most
+ *   recently added pending initializers are appended to the backlog.
+ * - Otherwise, if there are more vacancies than initializers (including the
+ *   new secondaries), initializers are moved from the back of the backlog to
+ *   fill them.
+ *
+ * The number of initializers in the backlog is saved to the state.
+ */
+template<MemSpace M>
+void exchange_backlog(TrackInitStateData<Ownership::reference, M>& data,
+                      std::vector<TrackInitializer>* backlog)
+{
+    CELER_EXPECT(backlog);
+
+    size_type const capacity = data.initializers.capacity();
+    size_type const num_pending = data.initializers.size();
+    size_type const required = data.num_secondaries + num_pending;
+
+    if (required > capacity)
+    {
+        // Spill existing initializers to the host to make room
+        size_type num_spill = std::min(required - capacity, num_pending);
+        Copier<TrackInitializer, M> copy{
+            data.initializers.data().last(num_spill)};
+        backlog->resize(backlog->size() + num_spill);
+        copy(MemSpace::host, make_span(*backlog).last(num_spill));
+
+        data.initializers.resize(num_pending - num_spill);
+    }
+    else if (!backlog->empty() && data.vacancies.size() > required)
+    {
+        // Reload initializers from the host to fill empty track slots
+        size_type num_reload = std::min({backlog->size(),
+                                         capacity - required,
+                                         data.vacancies.size() - required});
+        Copier<TrackInitializer, MemSpace::host> copy{
+            make_span(*backlog).last(num_reload)};
+        data.initializers.resize(num_pending + num_reload);
+        copy(M, data.initializers.data().last(num_reload));
+        backlog->resize(backlog->size() - num_reload);
+    }
+
+    data.num_backlog = backlog->size();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -10,11 +10,44 @@
 #include <algorithm>
 #include <numeric>
 #include <random>
+#include <utility>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/Collection.hh"
 
 namespace celeritas
 {
 namespace detail
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sort track slots by a key calculated from each track slot.
+ *
+ * Ties are broken by track slot so the result is deterministic.
+ */
+template<class F>
+void sort_by_key(Span<TrackSlotId::size_type> track_slots, F&& get_key)
+{
+    using size_type = TrackSlotId::size_type;
+
+    std::vector<std::pair<unsigned int, size_type>> keyed(track_slots.size());
+    for (auto i : range(track_slots.size()))
+    {
+        keyed[i] = {get_key(track_slots[i]), track_slots[i]};
+    }
+    std::sort(keyed.begin(), keyed.end());
+    for (auto i : range(track_slots.size()))
+    {
+        track_slots[i] = keyed[i].second;
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Initialize default threads to track_slots mapping, track_slots[i] = i
@@ -35,6 +68,135 @@ void shuffle_track_slots<MemSpace::host>(Span<TrackSlotId::size_type> track_slot
     std::mt19937 g{seed};
     std::shuffle(track_slots.begin(), track_slots.end(), g);
 }
+
+/*!
+ * Partition track slots by post-step action and calculate thread offsets.
+ *
+ * This is a stable counting sort over the action IDs: the relative order of
+ * tracks undergoing the same action is preserved. On output, the threads
+ * \f$ [o_a, o_{a+1}) \f$ point to the tracks with action \em a, and the
+ * threads past the last offset point to inactive tracks. Only the threads
+ * in use (see \c CoreStateData::num_threads ) are partitioned.
+ */
+template<>
+void partition_tracks_by_action<MemSpace::host>(
+    CoreStateData<Ownership::reference, MemSpace::host>& states)
+{
+    using size_type = TrackSlotId::size_type;
+
+    Span<size_type> track_slots
+        = states.track_slots[AllItems<size_type, MemSpace::host>{}].first(
+            states.num_threads);
+    Span<ThreadId::size_type> offsets = states.thread_offsets[
+        AllItems<ThreadId::size_type, MemSpace::host>{}];
+    CELER_ASSERT(!offsets.empty());
+
+    StepLimitActionKey get_key{
+        states.sim.step_limit[AllItems<StepLimit, MemSpace::host>{}].data(),
+        static_cast<ActionId::size_type>(offsets.size() - 1)};
+
+    // Count the number of tracks for each action
+    std::vector<size_type> counts(offsets.size() + 1, 0);
+    for (size_type track_slot : track_slots)
+    {
+        ++counts[get_key(track_slot)];
+    }
+
+    // Starting thread for each action is the exclusive sum of the counts
+    std::exclusive_scan(
+        counts.begin(), counts.end(), counts.begin(), size_type{0});
+    std::copy(counts.begin(), counts.end() - 1, offsets.begin());
+
+    // Scatter track slots into their partitions
+    std::vector<size_type> sorted(track_slots.size());
+    for (size_type track_slot : track_slots)
+    {
+        sorted[counts[get_key(track_slot)]++] = track_slot;
+    }
+    std::copy(sorted.begin(), sorted.end(), track_slots.begin());
+}
+
+/*!
+ * Partition track slots so that neutral tracks precede charged tracks.
+ */
+template<>
+void partition_tracks_by_charge<MemSpace::host>(
+    CoreParamsData<Ownership::const_reference, MemSpace::host> const& params,
+    CoreStateData<Ownership::reference, MemSpace::host>& states)
+{
+    using size_type = TrackSlotId::size_type;
+
+    sort_by_key(
+        states.track_slots[AllItems<size_type, MemSpace::host>{}].first(
+            states.num_threads),
+        ChargeKey{
+            params.particles
+                .particles[AllItems<ParticleRecord, MemSpace::host>{}]
+                .data(),
+            states.particles
+                .state[AllItems<ParticleTrackState, MemSpace::host>{}]
+                .data(),
+            states.sim.status[AllItems<TrackStatus, MemSpace::host>{}].data()});
+}
+
+/*!
+ * Sort track slots by particle type and then by energy bin.
+ */
+template<>
+void sort_tracks_by_particle_energy<MemSpace::host>(
+    CoreStateData<Ownership::reference, MemSpace::host>& states)
+{
+    using size_type = TrackSlotId::size_type;
+
+    sort_by_key(
+        states.track_slots[AllItems<size_type, MemSpace::host>{}].first(
+            states.num_threads),
+        ParticleEnergyKey{
+            states.particles
+                .state[AllItems<ParticleTrackState, MemSpace::host>{}]
+                .data(),
+            states.sim.status[AllItems<TrackStatus, MemSpace::host>{}].data()});
+}
+
+/*!
+ * Move live track slots to the front, followed by slots about to be filled.
+ *
+ * The live (non-vacant) track slots keep their relative order. They are
+ * followed by the vacancies in reverse order, since new tracks are
+ * initialized into the vacancies starting from the back. The threads
+ * covering the live tracks and the tracks initialized at the next step are
+ * thus contiguous at the start of the state.
+ */
+template<>
+void compact_track_slots<MemSpace::host>(
+    CoreStateData<Ownership::reference, MemSpace::host>& states)
+{
+    using size_type = TrackSlotId::size_type;
+
+    Span<size_type> track_slots
+        = states.track_slots[AllItems<size_type, MemSpace::host>{}];
+    Span<TrackSlotId const> vacancies = states.init.vacancies.data();
+
+    std::vector<char> is_vacant(track_slots.size(), 0);
+    for (TrackSlotId slot : vacancies)
+    {
+        is_vacant[slot.unchecked_get()] = 1;
+    }
+
+    auto dst = track_slots.begin();
+    for (auto slot : range(size_type(track_slots.size())))
+    {
+        if (!is_vacant[slot])
+        {
+            *dst++ = slot;
+        }
+    }
+    for (auto i : range(vacancies.size()))
+    {
+        *dst++ = vacancies[vacancies.size() - 1 - i].unchecked_get();
+    }
+    CELER_ENSURE(dst == track_slots.end());
+}
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
@@ -8,18 +8,76 @@
 #include "TrackSortUtils.hh"
 
 #include <random>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/device_ptr.h>
 #include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
 #include <thrust/random.h>
 #include <thrust/sequence.h>
 #include <thrust/shuffle.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
 
 #include "corecel/Macros.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/DeviceVector.hh"
 
 namespace celeritas
 {
 namespace detail
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Stably sort track slots by a key calculated from each track slot.
+ */
+template<class F>
+void sort_by_key(Span<TrackSlotId::size_type> track_slots, F get_key)
+{
+    auto slots_begin = thrust::device_pointer_cast(track_slots.data());
+    auto slots_end = slots_begin + track_slots.size();
+
+    DeviceVector<unsigned int> keys(track_slots.size());
+    auto keys_begin = thrust::device_pointer_cast(keys.data());
+    thrust::transform(
+        thrust::device, slots_begin, slots_end, keys_begin, get_key);
+    CELER_DEVICE_CHECK_ERROR();
+
+    thrust::stable_sort_by_key(
+        thrust::device, keys_begin, keys_begin + keys.size(), slots_begin);
+    CELER_DEVICE_CHECK_ERROR();
+}
+
+//---------------------------------------------------------------------------//
+//! Mark a vacant track slot
+struct FlagVacancy
+{
+    char* is_vacant;
+
+    CELER_FUNCTION void operator()(TrackSlotId slot) const
+    {
+        is_vacant[slot.unchecked_get()] = 1;
+    }
+};
+
+//! Get the index of a track slot
+struct GetSlotIndex
+{
+    CELER_FUNCTION TrackSlotId::size_type operator()(TrackSlotId slot) const
+    {
+        return slot.unchecked_get();
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Initialize default threads to track_slots mapping, track_slots[i] = i
@@ -51,6 +109,154 @@ void shuffle_track_slots<MemSpace::device>(
         g);
     CELER_DEVICE_CHECK_ERROR();
 }
+
+/*!
+ * Partition track slots by post-step action and calculate thread offsets.
+ *
+ * The track slots are stably sorted by action ID, and the thread offsets are
+ * found with a vectorized binary search over the sorted keys before being
+ * copied to the host.
+ */
+template<>
+void partition_tracks_by_action<MemSpace::device>(
+    CoreStateData<Ownership::reference, MemSpace::device>& states)
+{
+    using size_type = TrackSlotId::size_type;
+    using key_type = ActionId::size_type;
+
+    Span<size_type> track_slots
+        = states.track_slots[AllItems<size_type, MemSpace::device>{}].first(
+            states.num_threads);
+    Span<ThreadId::size_type> host_offsets = states.thread_offsets[
+        AllItems<ThreadId::size_type, MemSpace::host>{}];
+    CELER_ASSERT(!host_offsets.empty());
+
+    auto slots_begin = thrust::device_pointer_cast(track_slots.data());
+    auto slots_end = slots_begin + track_slots.size();
+
+    // Calculate the sort key for every thread
+    DeviceVector<key_type> keys(track_slots.size());
+    auto keys_begin = thrust::device_pointer_cast(keys.data());
+    auto keys_end = keys_begin + keys.size();
+    thrust::transform(
+        thrust::device,
+        slots_begin,
+        slots_end,
+        keys_begin,
+        StepLimitActionKey{
+            states.sim.step_limit[AllItems<StepLimit, MemSpace::device>{}]
+                .data(),
+            static_cast<key_type>(host_offsets.size() - 1)});
+    CELER_DEVICE_CHECK_ERROR();
+
+    // Partition the track slots
+    thrust::stable_sort_by_key(
+        thrust::device, keys_begin, keys_end, slots_begin);
+    CELER_DEVICE_CHECK_ERROR();
+
+    // Find the first thread for each action
+    DeviceVector<ThreadId::size_type> offsets(host_offsets.size());
+    thrust::lower_bound(thrust::device,
+                        keys_begin,
+                        keys_end,
+                        thrust::counting_iterator<key_type>(0),
+                        thrust::counting_iterator<key_type>(offsets.size()),
+                        thrust::device_pointer_cast(offsets.data()));
+    CELER_DEVICE_CHECK_ERROR();
+
+    // Copy offsets to host for sizing kernel launches
+    offsets.copy_to_host(host_offsets);
+}
+
+/*!
+ * Partition track slots so that neutral tracks precede charged tracks.
+ */
+template<>
+void partition_tracks_by_charge<MemSpace::device>(
+    CoreParamsData<Ownership::const_reference, MemSpace::device> const& params,
+    CoreStateData<Ownership::reference, MemSpace::device>& states)
+{
+    using size_type = TrackSlotId::size_type;
+
+    sort_by_key(
+        states.track_slots[AllItems<size_type, MemSpace::device>{}].first(
+            states.num_threads),
+        ChargeKey{params.particles
+                      .particles[AllItems<ParticleRecord, MemSpace::device>{}]
+                      .data(),
+                  states.particles
+                      .state[AllItems<ParticleTrackState, MemSpace::device>{}]
+                      .data(),
+                  states.sim.status[AllItems<TrackStatus, MemSpace::device>{}]
+                      .data()});
+}
+
+/*!
+ * Sort track slots by particle type and then by energy bin.
+ */
+template<>
+void sort_tracks_by_particle_energy<MemSpace::device>(
+    CoreStateData<Ownership::reference, MemSpace::device>& states)
+{
+    using size_type = TrackSlotId::size_type;
+
+    sort_by_key(
+        states.track_slots[AllItems<size_type, MemSpace::device>{}].first(
+            states.num_threads),
+        ParticleEnergyKey{
+            states.particles
+                .state[AllItems<ParticleTrackState, MemSpace::device>{}]
+                .data(),
+            states.sim.status[AllItems<TrackStatus, MemSpace::device>{}]
+                .data()});
+}
+
+/*!
+ * Move live track slots to the front, followed by slots about to be filled.
+ *
+ * The vacant slots are flagged, the remaining slots are stably copied to the
+ * front, and the vacancies are copied after them in reverse order.
+ */
+template<>
+void compact_track_slots<MemSpace::device>(
+    CoreStateData<Ownership::reference, MemSpace::device>& states)
+{
+    using size_type = TrackSlotId::size_type;
+
+    Span<size_type> track_slots
+        = states.track_slots[AllItems<size_type, MemSpace::device>{}];
+    Span<TrackSlotId> vacancies = states.init.vacancies.data();
+    auto slots_begin = thrust::device_pointer_cast(track_slots.data());
+    auto vac_begin = thrust::device_pointer_cast(vacancies.data());
+    auto vac_end = vac_begin + vacancies.size();
+
+    // Flag vacant track slots
+    DeviceVector<char> is_vacant(track_slots.size());
+    auto flags_begin = thrust::device_pointer_cast(is_vacant.data());
+    thrust::fill(
+        thrust::device, flags_begin, flags_begin + is_vacant.size(), 0);
+    thrust::for_each(
+        thrust::device, vac_begin, vac_end, FlagVacancy{is_vacant.data()});
+    CELER_DEVICE_CHECK_ERROR();
+
+    // Copy live track slots to the front
+    auto dst = thrust::copy_if(
+        thrust::device,
+        thrust::counting_iterator<size_type>(0),
+        thrust::counting_iterator<size_type>(track_slots.size()),
+        flags_begin,
+        slots_begin,
+        thrust::logical_not<char>());
+    CELER_DEVICE_CHECK_ERROR();
+
+    // Append vacancies in the order they're filled
+    thrust::transform(thrust::device,
+                      thrust::make_reverse_iterator(vac_end),
+                      thrust::make_reverse_iterator(vac_begin),
+                      dst,
+                      GetSlotIndex{});
+    CELER_DEVICE_CHECK_ERROR();
+}
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
@@ -7,12 +7,16 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cmath>
 #include <type_traits>
 
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/Span.hh"
+#include "corecel/math/Algorithms.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/CoreTrackData.hh"
 
 namespace celeritas
 {
@@ -47,6 +51,140 @@ template<>
 void shuffle_track_slots<MemSpace::device>(
     Span<TrackSlotId::size_type> track_slots);
 
+//---------------------------------------------------------------------------//
+// Partition tracks by post-step action and calculate thread offsets
+template<MemSpace M>
+void partition_tracks_by_action(CoreStateData<Ownership::reference, M>& states);
+
+template<>
+void partition_tracks_by_action<MemSpace::host>(
+    CoreStateData<Ownership::reference, MemSpace::host>& states);
+template<>
+void partition_tracks_by_action<MemSpace::device>(
+    CoreStateData<Ownership::reference, MemSpace::device>& states);
+
+//---------------------------------------------------------------------------//
+// Partition tracks so that neutral tracks precede charged ones
+template<MemSpace M>
+void partition_tracks_by_charge(
+    CoreParamsData<Ownership::const_reference, M> const& params,
+    CoreStateData<Ownership::reference, M>& states);
+
+template<>
+void partition_tracks_by_charge<MemSpace::host>(
+    CoreParamsData<Ownership::const_reference, MemSpace::host> const& params,
+    CoreStateData<Ownership::reference, MemSpace::host>& states);
+template<>
+void partition_tracks_by_charge<MemSpace::device>(
+    CoreParamsData<Ownership::const_reference, MemSpace::device> const& params,
+    CoreStateData<Ownership::reference, MemSpace::device>& states);
+
+//---------------------------------------------------------------------------//
+// Sort tracks by particle type and then by energy bin
+template<MemSpace M>
+void sort_tracks_by_particle_energy(
+    CoreStateData<Ownership::reference, M>& states);
+
+template<>
+void sort_tracks_by_particle_energy<MemSpace::host>(
+    CoreStateData<Ownership::reference, MemSpace::host>& states);
+template<>
+void sort_tracks_by_particle_energy<MemSpace::device>(
+    CoreStateData<Ownership::reference, MemSpace::device>& states);
+
+//---------------------------------------------------------------------------//
+// Move live track slots to the front, followed by slots about to be filled
+template<MemSpace M>
+void compact_track_slots(CoreStateData<Ownership::reference, M>& states);
+
+template<>
+void compact_track_slots<MemSpace::host>(
+    CoreStateData<Ownership::reference, MemSpace::host>& states);
+template<>
+void compact_track_slots<MemSpace::device>(
+    CoreStateData<Ownership::reference, MemSpace::device>& states);
+
+//---------------------------------------------------------------------------//
+// HELPER CLASSES
+//---------------------------------------------------------------------------//
+/*!
+ * Get the sort key of a track slot from its post-step action.
+ *
+ * Track slots without a post-step action (i.e. inactive tracks) are given the
+ * largest key so that they are partitioned to the back.
+ */
+struct StepLimitActionKey
+{
+    StepLimit const* step_limit;
+    ActionId::size_type num_actions;
+
+    CELER_FUNCTION ActionId::size_type
+    operator()(TrackSlotId::size_type track_slot) const
+    {
+        ActionId action = step_limit[track_slot].action;
+        CELER_ASSERT(!action || action.unchecked_get() < num_actions);
+        return action ? action.unchecked_get() : num_actions;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the sort key of a track slot from the charge of its particle.
+ *
+ * Neutral tracks come first, then charged tracks, then inactive tracks.
+ */
+struct ChargeKey
+{
+    ParticleRecord const* particles;
+    ParticleTrackState const* particle_state;
+    TrackStatus const* status;
+
+    CELER_FUNCTION unsigned int
+    operator()(TrackSlotId::size_type track_slot) const
+    {
+        if (status[track_slot] == TrackStatus::inactive)
+        {
+            return 2;
+        }
+        ParticleId pid = particle_state[track_slot].particle_id;
+        return particles[pid.unchecked_get()].charge == zero_quantity() ? 0
+                                                                        : 1;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the sort key of a track slot from its particle type and energy.
+ *
+ * The energy bins are octaves (powers of two in MeV) clamped to
+ * \f$ [2^{-32}, 2^{31}] \f$ MeV, so that tracks of the same particle type
+ * and similar energy use the same region of the physics tables. Inactive
+ * tracks are sorted to the back.
+ */
+struct ParticleEnergyKey
+{
+    ParticleTrackState const* particle_state;
+    TrackStatus const* status;
+
+    static constexpr int min_exponent = -32;
+    static constexpr int max_exponent = 31;
+    static constexpr unsigned int num_bins = max_exponent - min_exponent + 1;
+
+    CELER_FUNCTION unsigned int
+    operator()(TrackSlotId::size_type track_slot) const
+    {
+        if (status[track_slot] == TrackStatus::inactive)
+        {
+            return static_cast<unsigned int>(-1);
+        }
+        ParticleTrackState const& ps = particle_state[track_slot];
+        int exponent = ps.energy > 0 ? ilogb(ps.energy) : min_exponent;
+        exponent = celeritas::clamp(exponent, min_exponent, max_exponent);
+        return ps.particle_id.unchecked_get() * num_bins
+               + static_cast<unsigned int>(exponent - min_exponent);
+    }
+};
+
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
@@ -62,6 +200,35 @@ inline void shuffle_track_slots<MemSpace::device>(Span<TrackSlotId::size_type>)
 {
     CELER_NOT_CONFIGURED("CUDA or HIP");
 }
+
+template<>
+inline void partition_tracks_by_action<MemSpace::device>(
+    CoreStateData<Ownership::reference, MemSpace::device>&)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+
+template<>
+inline void partition_tracks_by_charge<MemSpace::device>(
+    CoreParamsData<Ownership::const_reference, MemSpace::device> const&,
+    CoreStateData<Ownership::reference, MemSpace::device>&)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+
+template<>
+inline void sort_tracks_by_particle_energy<MemSpace::device>(
+    CoreStateData<Ownership::reference, MemSpace::device>&)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+
+template<>
+inline void compact_track_slots<MemSpace::device>(
+    CoreStateData<Ownership::reference, MemSpace::device>&)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
 #endif
 //---------------------------------------------------------------------------//
 }  // namespace detail
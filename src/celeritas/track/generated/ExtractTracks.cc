@@ -0,0 +1,40 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022-2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/generated/ExtractTracks.cc
+//! \note Auto-generated by gen-trackinit.py: DO NOT MODIFY!
+//---------------------------------------------------------------------------//
+#include <utility>
+
+#include "corecel/sys/MultiExceptionHandler.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "corecel/Types.hh"
+#include "celeritas/global/KernelContextException.hh"
+#include "celeritas/track/detail/ExtractTracksLauncher.hh" // IWYU pragma: associated
+
+namespace celeritas
+{
+namespace generated
+{
+void extract_tracks(
+    HostCRef<CoreParamsData> const& core_params,
+    HostRef<CoreStateData> const& core_states,
+    Span<TrackInitializer> const initializers)
+{
+    MultiExceptionHandler capture_exception;
+    detail::ExtractTracksLauncher<MemSpace::host> launch(core_params, core_states, initializers);
+    #pragma omp parallel for
+    for (ThreadId::size_type i = 0; i < core_states.size(); ++i)
+    {
+        CELER_TRY_HANDLE_CONTEXT(
+            launch(ThreadId{i}),
+            capture_exception,
+            KernelContextException(core_params, core_states, ThreadId{i}, "extract_tracks"));
+    }
+    log_and_rethrow(std::move(capture_exception));
+}
+
+}  // namespace generated
+}  // namespace celeritas
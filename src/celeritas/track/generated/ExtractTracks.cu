@@ -0,0 +1,48 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2022-2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/generated/ExtractTracks.cu
+//! \note Auto-generated by gen-trackinit.py: DO NOT MODIFY!
+//---------------------------------------------------------------------------//
+#include "celeritas/track/detail/ExtractTracksLauncher.hh"
+#include "corecel/device_runtime_api.h"
+#include "corecel/sys/KernelParamCalculator.device.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/Types.hh"
+
+namespace celeritas
+{
+namespace generated
+{
+namespace
+{
+__global__ void extract_tracks_kernel(
+    DeviceCRef<CoreParamsData> const core_params,
+    DeviceRef<CoreStateData> const core_states,
+    Span<TrackInitializer> const initializers)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < core_states.size()))
+        return;
+
+    detail::ExtractTracksLauncher<MemSpace::device> launch(core_params, core_states, initializers);
+    launch(tid);
+}
+}  // namespace
+
+void extract_tracks(
+    DeviceCRef<CoreParamsData> const& core_params,
+    DeviceRef<CoreStateData> const& core_states,
+    Span<TrackInitializer> const initializers)
+{
+    CELER_LAUNCH_KERNEL(
+        extract_tracks,
+        celeritas::device().default_block_size(),
+        core_states.size(),
+        core_params, core_states, initializers);
+}
+
+}  // namespace generated
+}  // namespace celeritas
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/track/TrackInitData.hh"
+
+namespace celeritas
+{
+namespace generated
+{
+
+void extract_tracks(
+    HostCRef<CoreParamsData> const& core_params,
+    HostRef<CoreStateData> const& core_states,
+    Span<TrackInitializer> const initializers);
+
+void extract_tracks(
+    DeviceCRef<CoreParamsData> const& core_params,
+    DeviceRef<CoreStateData> const& core_states,
+    Span<TrackInitializer> const initializers);
+
+#if !CELER_USE_DEVICE
+inline void extract_tracks(DeviceCRef<CoreParamsData> const&, DeviceRef<CoreStateData> const&, Span<TrackInitializer> const)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+#endif
+
+}  // namespace generated
+}  // namespace celeritas
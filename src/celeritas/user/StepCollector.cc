@@ -14,10 +14,12 @@
 
 #include "corecel/cont/EnumArray.hh"
 #include "corecel/cont/Label.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionBuilder.hh"
 #include "corecel/data/CollectionMirror.hh"
 #include "celeritas/geo/GeoParams.hh"  // IWYU pragma: keep
 #include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
 #include "celeritas/user/StepInterface.hh"
 #include "celeritas/user/detail/StepStorage.hh"
 
@@ -123,6 +125,19 @@ StepCollector::StepCollector(VecInterface callbacks,
                 .insert_back(temp_det.begin(), temp_det.end());
 
             host_data.nonzero_energy_deposition = nonzero_energy_deposition;
+
+            // Check whether neutral tracks can cross into a detector
+            // without stopping at its boundary
+            for (auto i : range(action_registry->num_actions()))
+            {
+                auto const* along_step
+                    = dynamic_cast<AlongStepGeneralLinearAction const*>(
+                        action_registry->action(ActionId{i}).get());
+                if (along_step && along_step->has_woodcock())
+                {
+                    host_data.woodcock = true;
+                }
+            }
         }
 
         storage_->params
@@ -35,6 +35,10 @@ struct StepStorage;
  * interfacing with the GPU track states at the beginning and/or end of every
  * step.
  *
+ * If the along-step action uses Woodcock tracking, neutral particles can
+ * collide in a detector after starting the step elsewhere, so the along-step
+ * action must be registered before the collector is constructed.
+ *
  * \todo The step collector serves two purposes: supporting "sensitive
  * detectors" (mapping volume IDs to detector IDs and ignoring unmapped
  * volumes) and supporting unfiltered output for "MC truth" . Right now only
@@ -138,6 +138,9 @@ struct StepParamsData
     //! Filter out steps that have not deposited energy (for sensitive det)
     bool nonzero_energy_deposition{false};
 
+    //! Neutral particles use Woodcock tracking (for sensitive det)
+    bool woodcock{false};
+
     //// METHODS ////
 
     //! Whether the data is assigned
@@ -154,6 +157,7 @@ struct StepParamsData
         selection = other.selection;
         detector = other.detector;
         nonzero_energy_deposition = other.nonzero_energy_deposition;
+        woodcock = other.woodcock;
         return *this;
     }
 };
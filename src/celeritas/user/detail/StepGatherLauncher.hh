@@ -84,23 +84,51 @@ CELER_FUNCTION void StepGatherLauncher<P>::operator()(ThreadId thread) const
 
     if (!this->step_params.detector.empty())
     {
-        // Apply detector filter at beginning of step (volume in which we're
-        // stepping)
+        auto const geo = track.make_geo_view();
+        DetectorId& detector = this->step_state.detector[track.track_slot_id()];
+
+        // Woodcock (delta) tracking moves neutral particles through
+        // boundaries before colliding, so their step can end in a detector
+        bool const woodcock
+            = this->step_params.woodcock
+              && track.make_particle_view().charge() == zero_quantity();
+
         if (P == StepPoint::pre)
         {
-            auto const geo = track.make_geo_view();
+            // Apply detector filter at beginning of step (volume in which
+            // we're stepping)
             CELER_ASSERT(!geo.is_outside());
             VolumeId vol = geo.volume_id();
             CELER_ASSERT(vol);
 
             // Map volume ID to detector ID
-            this->step_state.detector[track.track_slot_id()]
-                = this->step_params.detector[vol];
+            detector = this->step_params.detector[vol];
+        }
+        else if (woodcock && !geo.is_outside() && !geo.is_on_boundary())
+        {
+            // Credit the collision to the post-step volume
+            DetectorId post_detector
+                = this->step_params.detector[geo.volume_id()];
+            if (post_detector != detector)
+            {
+                detector = post_detector;
+                if (detector)
+                {
+                    // The step in the detector begins at the collision
+                    auto const sim = track.make_sim_view();
+                    SGL_SET_IF_SELECTED(points[StepPoint::pre].time,
+                                        sim.time());
+                    SGL_SET_IF_SELECTED(points[StepPoint::pre].pos, geo.pos());
+                    SGL_SET_IF_SELECTED(points[StepPoint::pre].volume_id,
+                                        geo.volume_id());
+                }
+            }
         }
 
-        if (!this->step_state.detector[track.track_slot_id()])
+        if (!detector && !(P == StepPoint::pre && woodcock))
         {
             // We're not in a sensitive detector: don't save any further data
+            // (unless a Woodcock step may still end in one)
             return;
         }
 
@@ -111,7 +139,7 @@ CELER_FUNCTION void StepGatherLauncher<P>::operator()(ThreadId thread) const
             if (pstep.energy_deposition() == zero_quantity())
             {
                 // Clear detector ID and stop recording
-                this->step_state.detector[track.track_slot_id()] = {};
+                detector = {};
                 return;
             }
         }
@@ -25,6 +25,13 @@ using size_type = std::size_t;
 //! Numerical type for real numbers
 using real_type = double;
 
+//! Storage type for tabulated data: arithmetic on it uses \c real_type
+#if CELERITAS_FLOAT_TABLES
+using table_real_type = float;
+#else
+using table_real_type = real_type;
+#endif
+
 //! Equivalent to std::size_t but compatible with CUDA atomics
 using ull_int = unsigned long long int;
 
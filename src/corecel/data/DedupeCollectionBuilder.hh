@@ -0,0 +1,153 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/DedupeCollectionBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "corecel/math/HashUtils.hh"
+
+#include "Collection.hh"
+#include "CollectionBuilder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Build a host collection, reusing previously inserted identical ranges.
+ *
+ * Each range inserted through this class is hashed by its contents (after
+ * conversion to the stored type). If an identical range was already inserted
+ * by this builder, that range is returned instead of storing a copy. This is
+ * useful for tabulated data such as energy grids and cross sections that are
+ * often the same for many materials or elements.
+ *
+ * Items are compared bitwise, so they must be trivially copyable. Since
+ * returned ranges may be shared, the inserted data must not be modified
+ * afterward.
+ *
+ * \code
+    auto reals = make_dedupe_builder(&data->reals);
+    ItemRange<real_type> grid = reals.insert_back(x.begin(), x.end());
+    // Returns the same range
+    ItemRange<real_type> grid2 = reals.insert_back(x.begin(), x.end());
+   \endcode
+ */
+template<class T, class I = ItemId<T>>
+class DedupeCollectionBuilder
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Deduplicated items must be trivially copyable");
+
+  public:
+    //!@{
+    //! \name Type aliases
+    using CollectionT = Collection<T, Ownership::value, MemSpace::host, I>;
+    using value_type = T;
+    using size_type = typename CollectionT::size_type;
+    using ItemRangeT = typename CollectionT::ItemRangeT;
+    //!@}
+
+  public:
+    // Construct from a collection
+    explicit inline DedupeCollectionBuilder(CollectionT* collection);
+
+    // Extend with a series of elements, or reuse an identical range
+    template<class InputIterator>
+    inline ItemRangeT insert_back(InputIterator first, InputIterator last);
+
+    //! Number of elements in the collection
+    size_type size() const { return col_->size(); }
+
+    //! Number of elements that were not stored because they were duplicates
+    size_type num_deduplicated() const { return num_deduplicated_; }
+
+  private:
+    CollectionT* col_;
+    std::unordered_multimap<std::size_t, ItemRangeT> ranges_;
+    size_type num_deduplicated_{0};
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a collection.
+ */
+template<class T, class I>
+DedupeCollectionBuilder<T, I>::DedupeCollectionBuilder(CollectionT* collection)
+    : col_(collection)
+{
+    CELER_EXPECT(col_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Insert the given elements unless an identical range was already inserted.
+ */
+template<class T, class I>
+template<class InputIterator>
+auto DedupeCollectionBuilder<T, I>::insert_back(InputIterator first,
+                                                InputIterator last)
+    -> ItemRangeT
+{
+    // Convert to the stored type before hashing
+    std::vector<T> const values(first, last);
+    if (values.empty())
+    {
+        return make_builder(col_).insert_back(values.begin(), values.end());
+    }
+    std::size_t const num_bytes = values.size() * sizeof(T);
+
+    // Hash the contents
+    std::size_t key;
+    {
+        auto hash = detail::make_fast_hasher(&key);
+        auto const* bytes = reinterpret_cast<Byte const*>(values.data());
+        for (std::size_t i = 0; i < num_bytes; ++i)
+        {
+            hash(bytes[i]);
+        }
+    }
+
+    // Look for an identical range
+    auto [iter, end] = ranges_.equal_range(key);
+    for (; iter != end; ++iter)
+    {
+        auto existing = (*col_)[iter->second];
+        if (existing.size() == values.size()
+            && std::memcmp(existing.data(), values.data(), num_bytes) == 0)
+        {
+            num_deduplicated_ += values.size();
+            return iter->second;
+        }
+    }
+
+    auto result = make_builder(col_).insert_back(values.begin(), values.end());
+    ranges_.emplace(key, result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Helper function for constructing deduplicating collection builders.
+ */
+template<class T, class I>
+DedupeCollectionBuilder<T, I>
+make_dedupe_builder(Collection<T, Ownership::value, MemSpace::host, I>* col)
+{
+    CELER_EXPECT(col);
+    return DedupeCollectionBuilder<T, I>(col);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -58,7 +58,8 @@ class NonuniformGrid
     inline CELER_FUNCTION value_type operator[](size_type i) const;
 
     // Find the index of the given value (*must* be in bounds)
-    inline CELER_FUNCTION size_type find(value_type value) const;
+    template<class U>
+    inline CELER_FUNCTION size_type find(U value) const;
 
   private:
     // TODO: change backend for effiency if needeed
@@ -113,9 +114,14 @@ CELER_FUNCTION auto NonuniformGrid<T>::operator[](size_type i) const
  * require different treatment (e.g. clipping to the boundary values rather
  * than interpolating). It's easier to test the exceptional cases (final grid
  * point) outside of the grid view.
+ *
+ * The value is compared at its own precision so that a higher-precision value
+ * is not rounded onto a grid point of lower-precision (e.g. \c
+ * table_real_type ) data.
  */
 template<class T>
-CELER_FUNCTION size_type NonuniformGrid<T>::find(value_type value) const
+template<class U>
+CELER_FUNCTION size_type NonuniformGrid<T>::find(U value) const
 {
     CELER_EXPECT(value >= this->front() && value < this->back());
 
@@ -36,8 +36,9 @@ class TwodGridCalculator
     //!@{
     //! \name Type aliases
     using Point = Array<real_type, 2>;
-    using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Values = Collection<table_real_type,
+                              Ownership::const_reference,
+                              MemSpace::native>;
     //!@}
 
   public:
@@ -92,7 +93,7 @@ CELER_FUNCTION real_type TwodGridCalculator::operator()(Point const& inp) const
 CELER_FUNCTION TwodSubgridCalculator
 TwodGridCalculator::operator()(real_type x) const
 {
-    NonuniformGrid<real_type> const x_grid{grids_.x, storage_};
+    NonuniformGrid<table_real_type> const x_grid{grids_.x, storage_};
     CELER_EXPECT(x >= x_grid.front() && x < x_grid.back());
     return {grids_, storage_, detail::find_interp(x_grid, x)};
 }
@@ -18,13 +18,13 @@ namespace celeritas
  * Definition of a structured nonuniform 2D grid with node-centered data.
  *
  * This relies on an external Collection of reals. Data is indexed as `[x][y]`,
- * C-style row-major.
+ * C-style row-major. The values are stored as \c table_real_type .
  */
 struct TwodGridData
 {
-    ItemRange<real_type> x;  //!< x grid definition
-    ItemRange<real_type> y;  //!< y grid definition
-    ItemRange<real_type> values;  //!< [x][y]
+    ItemRange<table_real_type> x;  //!< x grid definition
+    ItemRange<table_real_type> y;  //!< y grid definition
+    ItemRange<table_real_type> values;  //!< [x][y]
 
     //! True if assigned and valid
     explicit CELER_FUNCTION operator bool() const
@@ -34,14 +34,14 @@ struct TwodGridData
     }
 
     //! Get the data location for a specified x-y coordinate.
-    CELER_FUNCTION ItemId<real_type> at(size_type ix, size_type iy) const
+    CELER_FUNCTION ItemId<table_real_type> at(size_type ix, size_type iy) const
     {
         CELER_EXPECT(ix < this->x.size());
         CELER_EXPECT(iy < this->y.size());
         size_type index = ix * this->y.size() + iy;
 
         CELER_ENSURE(index < this->x.size() * this->y.size());
-        return ItemId<real_type>{index + this->values.front().get()};
+        return ItemId<table_real_type>{index + this->values.front().get()};
     }
 };
 
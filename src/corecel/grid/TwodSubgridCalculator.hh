@@ -27,8 +27,9 @@ class TwodSubgridCalculator
   public:
     //!@{
     //! \name Type aliases
-    using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Values = Collection<table_real_type,
+                              Ownership::const_reference,
+                              MemSpace::native>;
     using InterpT = detail::FindInterp<real_type>;
     //!@}
 
@@ -92,7 +93,7 @@ TwodSubgridCalculator::TwodSubgridCalculator(TwodGridData const& grids,
  */
 CELER_FUNCTION real_type TwodSubgridCalculator::operator()(real_type y) const
 {
-    NonuniformGrid<real_type> const y_grid{grids_.y, storage_};
+    NonuniformGrid<table_real_type> const y_grid{grids_.y, storage_};
     CELER_EXPECT(y >= y_grid.front() && y < y_grid.back());
 
     const InterpT y_loc = detail::find_interp(y_grid, y);
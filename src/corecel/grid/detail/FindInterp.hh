@@ -40,19 +40,19 @@ struct FindInterp
  * result will always have an index such that its neighbor to the right is a
  * valid point on the grid, and the fraction between neghbors may be zero (in
  * the case where the value is exactly on a grid point) but is always less than
- * one.
+ * one. The fraction is calculated at the precision of the given value, which
+ * may be higher than that of the grid.
  */
-template<class Grid>
-inline CELER_FUNCTION FindInterp<typename Grid::value_type>
-find_interp(Grid const& grid, typename Grid::value_type value)
+template<class Grid, class T>
+inline CELER_FUNCTION FindInterp<T> find_interp(Grid const& grid, T value)
 {
     CELER_EXPECT(value >= grid.front() && value < grid.back());
 
-    FindInterp<typename Grid::value_type> result;
+    FindInterp<T> result;
     result.index = grid.find(value);
     CELER_ASSERT(result.index + 1 < grid.size());
-    auto const lower_val = grid[result.index];
-    auto const upper_val = grid[result.index + 1];
+    T const lower_val = grid[result.index];
+    T const upper_val = grid[result.index + 1];
     result.fraction = (value - lower_val) / (upper_val - lower_val);
 
     return result;
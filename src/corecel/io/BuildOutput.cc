@@ -46,6 +46,7 @@ void BuildOutput::output(JsonPimpl* j) const
         CO_SAVE_CFG(CELERITAS_USE_VECGEOM);
         CO_SAVE_CFG(CELERITAS_DEBUG);
         CO_SAVE_CFG(CELERITAS_LAUNCH_BOUNDS);
+        CO_SAVE_CFG(CELERITAS_FLOAT_TABLES);
 #    undef CO_SAVE_CFG
         cfg["CELERITAS_BUILD_TYPE"] = celeritas_build_type;
         cfg["CELERITAS_HOSTNAME"] = celeritas_hostname;
@@ -0,0 +1,93 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/MultiStreamOutput.cc
+//---------------------------------------------------------------------------//
+#include "MultiStreamOutput.hh"
+
+#include <algorithm>
+#include <utility>
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+
+#include "JsonPimpl.hh"
+#if CELERITAS_USE_JSON
+#    include <nlohmann/json.hpp>
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with category, label, and number of streams.
+ */
+MultiStreamOutput::MultiStreamOutput(Category cat,
+                                     std::string label,
+                                     size_type num_streams)
+    : cat_(cat), label_(std::move(label)), streams_(num_streams)
+{
+    CELER_EXPECT(cat_ != Category::size_);
+    CELER_EXPECT(!label_.empty());
+    CELER_EXPECT(num_streams > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the output for a single stream.
+ *
+ * This may be called concurrently for different streams.
+ */
+void MultiStreamOutput::set(StreamId stream, SPConstInterface output)
+{
+    CELER_EXPECT(stream < streams_.size());
+    CELER_EXPECT(output);
+    streams_[stream.get()] = std::move(output);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the output for a single stream, null if not set.
+ */
+auto MultiStreamOutput::get(StreamId stream) const -> SPConstInterface const&
+{
+    CELER_EXPECT(stream < streams_.size());
+    return streams_[stream.get()];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write output to the given JSON object.
+ */
+void MultiStreamOutput::output(JsonPimpl* j) const
+{
+#if CELERITAS_USE_JSON
+    if (std::none_of(streams_.begin(),
+                     streams_.end(),
+                     [](SPConstInterface const& s) { return bool(s); }))
+    {
+        // No stream has output
+        j->obj = nullptr;
+        return;
+    }
+
+    auto result = nlohmann::json::array();
+    for (auto const& stream_output : streams_)
+    {
+        JsonPimpl json_wrap;
+        if (stream_output)
+        {
+            stream_output->output(&json_wrap);
+        }
+        result.push_back(std::move(json_wrap.obj));
+    }
+    j->obj = std::move(result);
+#else
+    (void)sizeof(j);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
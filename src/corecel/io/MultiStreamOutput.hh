@@ -0,0 +1,72 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/MultiStreamOutput.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/sys/ThreadId.hh"
+
+#include "OutputInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Combine the output of each stream into a single registry entry.
+ *
+ * This is created and added to the \c OutputRegistry once, on the thread that
+ * owns the problem parameters, and each stream then sets its own output. The
+ * per-stream storage is allocated on construction, so different streams can
+ * set their outputs concurrently. Setting the output of a stream replaces any
+ * existing output for that stream.
+ *
+ * The output is an array indexed by stream ID, with \c null for streams whose
+ * output was never set. If no stream sets an output, the whole entry is
+ * \c null .
+ */
+class MultiStreamOutput final : public OutputInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstInterface = std::shared_ptr<OutputInterface const>;
+    //!@}
+
+  public:
+    // Construct with category, label, and number of streams
+    MultiStreamOutput(Category cat, std::string label, size_type num_streams);
+
+    // Set the output for a single stream
+    void set(StreamId stream, SPConstInterface output);
+
+    // Get the output for a single stream, null if not set
+    SPConstInterface const& get(StreamId stream) const;
+
+    //! Number of streams
+    size_type num_streams() const { return streams_.size(); }
+
+    //! Category of data to write
+    Category category() const final { return cat_; }
+
+    //! Key for the entry inside the category.
+    std::string label() const final { return label_; }
+
+    // Write output to the given JSON object
+    void output(JsonPimpl*) const final;
+
+  private:
+    Category cat_;
+    std::string label_;
+    std::vector<SPConstInterface> streams_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,105 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/EventTimer.cc
+//---------------------------------------------------------------------------//
+#include "EventTimer.hh"
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//! Device events marking the start and end of the timed operations
+struct EventTimer::Impl
+{
+#if CELER_USE_DEVICE
+    CELER_DEVICE_PREFIX(Event_t) start{};
+    CELER_DEVICE_PREFIX(Event_t) stop{};
+#endif
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create device events.
+ */
+EventTimer::EventTimer() : impl_(std::make_unique<Impl>())
+{
+#if CELER_USE_DEVICE
+    CELER_DEVICE_CALL_PREFIX(EventCreate(&impl_->start));
+    CELER_DEVICE_CALL_PREFIX(EventCreate(&impl_->stop));
+#else
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Destroy device events.
+ */
+EventTimer::~EventTimer()
+{
+#if CELER_USE_DEVICE
+    if (impl_)
+    {
+        CELER_DEVICE_CALL_PREFIX(EventDestroy(impl_->start));
+        CELER_DEVICE_CALL_PREFIX(EventDestroy(impl_->stop));
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+//!@{
+//! Default move construct/assign
+EventTimer::EventTimer(EventTimer&&) noexcept = default;
+EventTimer& EventTimer::operator=(EventTimer&&) noexcept = default;
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the start event on the default stream.
+ */
+void EventTimer::start()
+{
+    CELER_EXPECT(impl_);
+#if CELER_USE_DEVICE
+    CELER_DEVICE_CALL_PREFIX(EventRecord(impl_->start));
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the stop event on the default stream.
+ */
+void EventTimer::stop()
+{
+    CELER_EXPECT(impl_);
+#if CELER_USE_DEVICE
+    CELER_DEVICE_CALL_PREFIX(EventRecord(impl_->stop));
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the elapsed time in seconds, waiting for the stop event if needed.
+ */
+double EventTimer::operator()() const
+{
+    CELER_EXPECT(impl_);
+#if CELER_USE_DEVICE
+    CELER_DEVICE_CALL_PREFIX(EventSynchronize(impl_->stop));
+    float msec{0};
+    CELER_DEVICE_CALL_PREFIX(
+        EventElapsedTime(&msec, impl_->start, impl_->stop));
+    return 1e-3 * static_cast<double>(msec);
+#else
+    return 0;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
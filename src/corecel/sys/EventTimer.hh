@@ -0,0 +1,64 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/EventTimer.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Time asynchronous device operations with a pair of events.
+ *
+ * The start and stop events are recorded on the default stream around the
+ * timed kernels without blocking the host. The elapsed time can be retrieved
+ * once the device has reached the stop event, which only requires waiting for
+ * that event rather than synchronizing the whole device.
+ *
+ * \code
+    EventTimer timer;
+    timer.start();
+    launch_kernel();
+    timer.stop();
+    // ... launch more kernels ...
+    double seconds = timer();
+   \endcode
+ */
+class EventTimer
+{
+  public:
+    // Create device events
+    EventTimer();
+
+    // Destroy device events
+    ~EventTimer();
+
+    //!@{
+    //! Move but don't copy
+    EventTimer(EventTimer&&) noexcept;
+    EventTimer& operator=(EventTimer&&) noexcept;
+    EventTimer(EventTimer const&) = delete;
+    EventTimer& operator=(EventTimer const&) = delete;
+    //!@}
+
+    // Record the start event
+    void start();
+
+    // Record the stop event
+    void stop();
+
+    // Get the elapsed time [s], waiting for the stop event if needed
+    double operator()() const;
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,128 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/BoundingBoxUtils.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Macros.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/NumericLimits.hh"
+
+#include "BoundingBox.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a point is inside or on the surface of a bounding box.
+ */
+inline CELER_FUNCTION bool
+is_inside(BoundingBox const& bbox, Real3 const& point)
+{
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        if (point[ax] < bbox.lower()[ax] || point[ax] > bbox.upper()[ax])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether all extents of a bounding box are finite.
+ */
+inline CELER_FUNCTION bool is_finite(BoundingBox const& bbox)
+{
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        if (std::isinf(bbox.lower()[ax]) || std::isinf(bbox.upper()[ax]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the distance along a ray to enter a bounding box.
+ *
+ * The result is zero if the point is inside the box and infinite if the ray
+ * misses it.
+ */
+inline CELER_FUNCTION real_type calc_dist_to_enter(BoundingBox const& bbox,
+                                                   Real3 const& pos,
+                                                   Real3 const& dir)
+{
+    constexpr real_type inf = numeric_limits<real_type>::infinity();
+
+    real_type enter = 0;
+    real_type exit = inf;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        if (dir[ax] == 0)
+        {
+            if (pos[ax] < bbox.lower()[ax] || pos[ax] > bbox.upper()[ax])
+            {
+                // Parallel to and outside this slab
+                return inf;
+            }
+            continue;
+        }
+        real_type inv_dir = 1 / dir[ax];
+        real_type lower = (bbox.lower()[ax] - pos[ax]) * inv_dir;
+        real_type upper = (bbox.upper()[ax] - pos[ax]) * inv_dir;
+        if (lower > upper)
+        {
+            trivial_swap(lower, upper);
+        }
+        enter = celeritas::max(enter, lower);
+        exit = celeritas::min(exit, upper);
+        if (enter > exit)
+        {
+            return inf;
+        }
+    }
+    return enter;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the center of a bounding box.
+ */
+inline CELER_FUNCTION Real3 calc_center(BoundingBox const& bbox)
+{
+    Real3 result;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        result[ax] = (bbox.lower()[ax] + bbox.upper()[ax]) / 2;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the smallest bounding box enclosing two bounding boxes.
+ */
+inline CELER_FUNCTION BoundingBox calc_union(BoundingBox const& a,
+                                             BoundingBox const& b)
+{
+    Real3 lower;
+    Real3 upper;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        lower[ax] = celeritas::min(a.lower()[ax], b.lower()[ax]);
+        upper[ax] = celeritas::max(a.upper()[ax], b.upper()[ax]);
+    }
+    return {lower, upper};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -14,6 +14,7 @@
 #include "corecel/data/CollectionBuilder.hh"
 #include "corecel/sys/ThreadId.hh"
 
+#include "BoundingBox.hh"
 #include "OrangeTypes.hh"
 #include "univ/detail/Types.hh"
 
@@ -44,6 +45,28 @@ struct OrangeParamsScalars
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Faces of a single surface type within a volume, stored for host tracking.
+ *
+ * The surface coefficients are stored as a "structure of arrays": coefficient
+ * \c j of face \c i in the batch is <code>data[j * faces.size() + i]</code>.
+ * The distances to all faces in the batch can then be calculated in a single
+ * loop over contiguous arrays.
+ */
+struct SurfaceBatchRecord
+{
+    SurfaceType type{SurfaceType::size_};
+    ItemRange<FaceId> faces;
+    ItemRange<real_type> data;
+
+    //! True if defined
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return type != SurfaceType::size_ && !faces.empty();
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Data for a single volume definition.
@@ -56,6 +79,7 @@ struct VolumeRecord
 {
     ItemRange<LocalSurfaceId> faces;
     ItemRange<logic_int> logic;
+    ItemRange<SurfaceBatchRecord> batches;  //!< Host only
 
     logic_int max_intersections{0};
     logic_int flags{0};
@@ -117,6 +141,23 @@ struct Connectivity
     ItemRange<LocalVolumeId> neighbors;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Node in a flattened bounding volume hierarchy.
+ *
+ * Nodes are stored in depth-first order, so the first child of an interior
+ * node immediately follows it. The "escape" index is the next node to visit
+ * once this node's subtree is finished or skipped, which allows the hierarchy
+ * to be traversed without a stack. Leaf nodes have a nonempty list of
+ * volumes. Node indices are local to the unit.
+ */
+struct BvhNode
+{
+    BoundingBox bbox;  //!< Bounds of all volumes in the subtree
+    ItemRange<LocalVolumeId> volumes;  //!< Volumes in a leaf node
+    size_type escape{};  //!< Next node after this subtree
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Scalar data for a single "unit" of volumes defined by surfaces.
@@ -132,8 +173,9 @@ struct SimpleUnitRecord
     // Volume data [index by LocalVolumeId]
     ItemMap<LocalVolumeId, VolumeRecordId> volumes;
 
-    // TODO: transforms
-    // TODO: acceleration structure (bvh/kdtree/grid)
+    // Bounding volume hierarchy of explicit volumes
+    ItemRange<BvhNode> bvh;
+
     LocalVolumeId background{};  //!< Default if not in any other volume
     bool simple_safety{};
 
@@ -216,9 +258,16 @@ struct OrangeParamsData
     Items<SurfaceType> surface_types;
     Items<Connectivity> connectivities;
     Items<VolumeRecord> volume_records;
+    Items<BvhNode> bvh_nodes;
+
+    // Faces grouped by type (only copied to host data)
+    Items<SurfaceBatchRecord> surface_batches;
+    Items<FaceId> batch_faces;
+    Items<real_type> batch_reals;
 
     Items<Daughter> daughters;
     Items<Translation> translations;
+    Items<Rotation> rotations;
 
     UnitIndexerData<W, M> unit_indexer_data;
 
@@ -253,8 +302,16 @@ struct OrangeParamsData
         surface_types = other.surface_types;
         connectivities = other.connectivities;
         volume_records = other.volume_records;
+        bvh_nodes = other.bvh_nodes;
+        if constexpr (M == MemSpace::host)
+        {
+            surface_batches = other.surface_batches;
+            batch_faces = other.batch_faces;
+            batch_reals = other.batch_reals;
+        }
         daughters = other.daughters;
         translations = other.translations;
+        rotations = other.rotations;
         unit_indexer_data = other.unit_indexer_data;
 
         CELER_ENSURE(static_cast<bool>(*this) == static_cast<bool>(other));
@@ -287,6 +344,7 @@ struct OrangeStateData
     StateItems<real_type> next_step;
     StateItems<detail::OnSurface> next_surface;
     StateItems<LevelId> next_surface_level;
+    StateItems<real_type> boundary_step;  //!< Cached exact distance, or 0
 
     // Dimensions {num_tracks, max_level}
     Items<Real3> pos;
@@ -321,6 +379,7 @@ struct OrangeStateData
             && next_step.size() == level.size()
             && next_surface.size() == level.size()
             && next_surface_level.size() == level.size()
+            && boundary_step.size() == level.size()
             && !pos.empty()
             && dir.size() == pos.size()
             && vol.size() == pos.size()
@@ -349,6 +408,7 @@ struct OrangeStateData
         next_step = other.next_step;
         next_surface = other.next_surface;
         next_surface_level = other.next_surface_level;
+        boundary_step = other.boundary_step;
         pos = other.pos;
         dir = other.dir;
         vol = other.vol;
@@ -386,6 +446,7 @@ inline void resize(OrangeStateData<Ownership::value, M>* data,
     resize(&data->next_step, num_tracks);
     resize(&data->next_surface, num_tracks);
     resize(&data->next_surface_level, num_tracks);
+    resize(&data->boundary_step, num_tracks);
 
     data->max_level = params.scalars.max_level;
     auto const size = data->max_level * num_tracks;
@@ -21,11 +21,13 @@
 #include "corecel/io/Logger.hh"
 #include "corecel/io/ScopedTimeLog.hh"
 #include "corecel/io/StringUtils.hh"
+#include "corecel/sys/Environment.hh"
 #include "orange/BoundingBox.hh"
 
 #include "OrangeData.hh"  // IWYU pragma: associated
 #include "OrangeTypes.hh"
 #include "construct/OrangeInput.hh"
+#include "detail/OrangeCache.hh"
 #include "detail/UnitInserter.hh"
 #include "univ/detail/LogicStack.hh"
 
@@ -41,16 +43,10 @@ namespace
 {
 //---------------------------------------------------------------------------//
 /*!
- * Load a geometry from the given filename.
+ * Get the path to the ORANGE JSON file for the given geometry filename.
  */
-OrangeInput input_from_json(std::string filename)
+std::string resolve_json_filename(std::string filename)
 {
-    CELER_VALIDATE(CELERITAS_USE_JSON,
-                   << "JSON is not enabled so geometry cannot be loaded");
-
-    CELER_LOG(info) << "Loading ORANGE geometry from JSON at " << filename;
-    ScopedTimeLog scoped_time;
-
     if (ends_with(filename, ".gdml"))
     {
         CELER_LOG(warning) << "Using ORANGE geometry with GDML suffix: trying "
@@ -62,6 +58,20 @@ OrangeInput input_from_json(std::string filename)
     {
         CELER_LOG(warning) << "Expected '.json' extension for JSON input";
     }
+    return filename;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load a geometry from the given filename.
+ */
+OrangeInput input_from_json(std::string const& filename)
+{
+    CELER_VALIDATE(CELERITAS_USE_JSON,
+                   << "JSON is not enabled so geometry cannot be loaded");
+
+    CELER_LOG(info) << "Loading ORANGE geometry from JSON at " << filename;
+    ScopedTimeLog scoped_time;
 
     OrangeInput result;
 
@@ -76,43 +86,16 @@ OrangeInput input_from_json(std::string filename)
     return result;
 }
 
-//---------------------------------------------------------------------------//
-}  // namespace
-
 //---------------------------------------------------------------------------//
 /*!
- * Construct from a JSON file (if JSON is enabled).
- *
- * The JSON format is defined by the SCALE ORANGE exporter (not currently
- * distributed).
+ * Flatten the input into host data and metadata.
  */
-OrangeParams::OrangeParams(std::string const& json_filename)
-    : OrangeParams(input_from_json(json_filename))
-{
-}
-
-//---------------------------------------------------------------------------//
-/*!
- * Construct in-memory from a Geant4 geometry (not implemented).
- *
- * Perhaps someday we'll implement in-memory translation...
- */
-OrangeParams::OrangeParams(G4VPhysicalVolume const*)
-{
-    CELER_NOT_IMPLEMENTED("Geant4->VecGeom geometry translation");
-}
-
-//---------------------------------------------------------------------------//
-/*!
- * Advanced usage: construct from explicit host data.
- *
- * Volume and surface labels must be unique for the time being.
- */
-OrangeParams::OrangeParams(OrangeInput input)
+detail::OrangeCacheData build_data(OrangeInput const& input)
 {
     CELER_VALIDATE(input, << "input geometry is incomplete");
 
-    HostVal<OrangeParamsData> host_data;
+    detail::OrangeCacheData result;
+    HostVal<OrangeParamsData>& host_data = result.data;
 
     host_data.scalars.max_level = input.max_level;
 
@@ -154,9 +137,6 @@ OrangeParams::OrangeParams(OrangeInput input)
                       "stack is limited to a depth of "
                    << detail::LogicStack::max_stack_depth());
 
-    std::vector<Label> surface_labels;
-    std::vector<Label> volume_labels;
-
     for (UnitInput const& u : input.units)
     {
         // Capture metadata
@@ -168,7 +148,7 @@ OrangeParams::OrangeParams(OrangeInput input)
             {
                 surface_label.ext = u.label.name;
             }
-            surface_labels.push_back(std::move(surface_label));
+            result.surface_labels.push_back(std::move(surface_label));
         }
 
         for (auto const& v : u.volumes)
@@ -178,21 +158,121 @@ OrangeParams::OrangeParams(OrangeInput input)
             {
                 volume_label.ext = u.label.name;
             }
-            volume_labels.push_back(std::move(volume_label));
+            result.volume_labels.push_back(std::move(volume_label));
+        }
+    }
+
+    result.supports_safety
+        = host_data.simple_unit[SimpleUnitId{0}].simple_safety;
+    result.bbox = input.units.front().bbox;
+
+    CELER_ENSURE(host_data);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load flattened geometry data, using a binary cache if requested.
+ *
+ * If the \c CELER_ORANGE_CACHE environment variable is set, it is the path to
+ * a binary cache file. The cache is loaded if it was written from a JSON file
+ * with the same content by the same version of Celeritas; otherwise the
+ * geometry is built from JSON and the cache is (re)written. Problems with the
+ * cache file are not fatal.
+ */
+detail::OrangeCacheData load_data(std::string const& geo_filename)
+{
+    std::string const filename = resolve_json_filename(geo_filename);
+    std::string const& cache_filename = celeritas::getenv("CELER_ORANGE_CACHE");
+    if (cache_filename.empty())
+    {
+        return build_data(input_from_json(filename));
+    }
+
+    std::uint64_t const source_hash = detail::hash_file_contents(filename);
+    detail::OrangeCacheData result;
+    try
+    {
+        if (detail::read_orange_cache(cache_filename, source_hash, &result))
+        {
+            CELER_LOG(info) << "Loaded ORANGE geometry from binary cache at "
+                            << cache_filename;
+            return result;
         }
+    }
+    catch (RuntimeError const& e)
+    {
+        CELER_LOG(warning) << "Ignoring ORANGE cache: " << e.what();
+    }
 
-        bbox_ = u.bbox;
+    result = build_data(input_from_json(filename));
+    try
+    {
+        detail::write_orange_cache(cache_filename, source_hash, result);
+        CELER_LOG(info) << "Wrote ORANGE binary cache to " << cache_filename;
     }
+    catch (RuntimeError const& e)
+    {
+        CELER_LOG(warning) << "Failed to write ORANGE cache: " << e.what();
+    }
+    return result;
+}
 
-    surf_labels_ = LabelIdMultiMap<SurfaceId>{std::move(surface_labels)};
-    vol_labels_ = LabelIdMultiMap<VolumeId>{std::move(volume_labels)};
+//---------------------------------------------------------------------------//
+}  // namespace
 
-    supports_safety_ = host_data.simple_unit[SimpleUnitId{0}].simple_safety;
-    bbox_ = input.units.front().bbox;
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a JSON file (if JSON is enabled).
+ *
+ * The JSON format is defined by the SCALE ORANGE exporter (not currently
+ * distributed). To skip parsing and construction on subsequent runs, set the
+ * \c CELER_ORANGE_CACHE environment variable to the path of a binary cache
+ * file.
+ */
+OrangeParams::OrangeParams(std::string const& json_filename)
+    : OrangeParams(load_data(json_filename))
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct in-memory from a Geant4 geometry (not implemented).
+ *
+ * ORANGE does not depend on Geant4: use \c GeantOrangeConverter to translate
+ * the world volume into an \c OrangeInput instead.
+ */
+OrangeParams::OrangeParams(G4VPhysicalVolume const*)
+{
+    CELER_NOT_IMPLEMENTED(
+        "direct Geant4->ORANGE construction (use GeantOrangeConverter)");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Advanced usage: construct from explicit host data.
+ *
+ * Volume and surface labels must be unique for the time being.
+ */
+OrangeParams::OrangeParams(OrangeInput input)
+    : OrangeParams(build_data(input))
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from flattened host data.
+ */
+OrangeParams::OrangeParams(detail::OrangeCacheData&& data)
+    : surf_labels_(std::move(data.surface_labels))
+    , vol_labels_(std::move(data.volume_labels))
+    , bbox_(data.bbox)
+    , supports_safety_(data.supports_safety)
+{
+    CELER_EXPECT(data.data);
 
     // Construct device values and device/host references
-    CELER_ASSERT(host_data);
-    data_ = CollectionMirror<OrangeParamsData>{std::move(host_data)};
+    data_ = CollectionMirror<OrangeParamsData>{std::move(data.data)};
 
     CELER_ENSURE(data_);
     CELER_ENSURE(vol_labels_.size() > 0);
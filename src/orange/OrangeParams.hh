@@ -26,6 +26,10 @@ class G4VPhysicalVolume;
 namespace celeritas
 {
 struct OrangeInput;
+namespace detail
+{
+struct OrangeCacheData;
+}
 
 //---------------------------------------------------------------------------//
 /*!
@@ -48,7 +52,7 @@ class OrangeParams
     // Construct from a JSON file (if JSON is enabled)
     explicit OrangeParams(std::string const& json_filename);
 
-    // Construct in-memory from Geant4 (not implemented)
+    // Construct from Geant4 (not implemented; see GeantOrangeConverter)
     explicit OrangeParams(G4VPhysicalVolume const*);
 
     // ADVANCED usage: construct from explicit host data
@@ -100,6 +104,9 @@ class OrangeParams
     DeviceRef const& device_ref() const { return data_.device(); }
 
   private:
+    // Construct from flattened host data
+    explicit OrangeParams(detail::OrangeCacheData&& data);
+
     // Host metadata/access
     LabelIdMultiMap<SurfaceId> surf_labels_;
     LabelIdMultiMap<VolumeId> vol_labels_;
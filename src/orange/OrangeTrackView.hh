@@ -10,11 +10,12 @@
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/Array.hh"
+#include "corecel/math/Algorithms.hh"
 #include "corecel/sys/ThreadId.hh"
 
 #include "OrangeData.hh"
 #include "OrangeTypes.hh"
-#include "Translator.hh"
+#include "Transformer.hh"
 #include "detail/LevelStateAccessor.hh"
 #include "detail/UnitIndexer.hh"
 #include "univ/SimpleUnitTracker.hh"
@@ -46,6 +47,13 @@ namespace celeritas
  *
  * \c move_internal with a position \em should depend on the safety distance
  * but that's not yet implemented.
+ *
+ * The exact distance to the next boundary is cached in the state when it
+ * can be found as cheaply as a truncated distance. Unlike the next step, this
+ * persists across track views (i.e., across steps): it is decremented by \c
+ * move_internal and invalidated by any other change to the position or
+ * direction. Consecutive physics-limited steps in a large volume thus skip
+ * the intersection calculation until the boundary is within reach.
  */
 class OrangeTrackView
 {
@@ -143,6 +151,9 @@ class OrangeTrackView
     // The level of the next surface to be encounted
     CELER_FORCEINLINE_FUNCTION LevelId& next_surface_level();
 
+    // The cached distance to the next boundary
+    CELER_FORCEINLINE_FUNCTION real_type& boundary_step();
+
     //// CONST STATE ASSESSORS ////
 
     // The current level
@@ -160,6 +171,9 @@ class OrangeTrackView
     // The level of the next surface to be encounted
     CELER_FORCEINLINE_FUNCTION LevelId const& next_surface_level() const;
 
+    // The cached distance to the next boundary
+    CELER_FORCEINLINE_FUNCTION real_type const& boundary_step() const;
+
     //// HELPER FUNCTIONS ////
 
     // Iterate over layers to find the next step
@@ -168,6 +182,16 @@ class OrangeTrackView
     // Create a local tracker
     inline CELER_FUNCTION SimpleUnitTracker make_tracker(UniverseId) const;
 
+    // Create a transformer into a daughter universe
+    inline CELER_FUNCTION TransformerDown make_transformer(DaughterId) const;
+
+    // Create a transformer into the daughter of a level's volume
+    inline CELER_FUNCTION TransformerDown
+    make_transformer(LevelStateAccessor const& lsa) const;
+
+    // Set the direction at every level, rotating into each daughter frame
+    inline CELER_FUNCTION void assign_dir(Real3 const& dir);
+
     // Create local sense reference
     inline CELER_FUNCTION Span<Sense> make_temp_sense() const;
 
@@ -186,6 +210,9 @@ class OrangeTrackView
     // Whether the next distance-to-boundary has been found
     CELER_FORCEINLINE_FUNCTION bool has_next_step() const;
 
+    // Whether an exact intersection search is as cheap as a bounded one
+    inline CELER_FUNCTION bool exact_intersect_is_cheap() const;
+
     // Invalidate the next distance-to-boundary
     CELER_FORCEINLINE_FUNCTION void clear_next_step();
 };
@@ -258,12 +285,11 @@ OrangeTrackView::operator=(Initializer_t const& init)
 
         if (daughter_id)
         {
-            auto const& daughter = params_.daughters[daughter_id];
-            auto const& trans = params_.translations[daughter.translation_id];
-            TranslatorDown td(trans);
+            auto td = this->make_transformer(daughter_id);
             local.pos = td(local.pos);
+            local.dir = td.rotate(local.dir);
 
-            uid = daughter.universe_id;
+            uid = params_.daughters[daughter_id].universe_id;
             ++level;
         }
 
@@ -293,12 +319,12 @@ OrangeTrackView& OrangeTrackView::operator=(DetailedInitializer const& init)
         // Copy all data accessed via LSA
         auto lsa = this->make_lsa(LevelId{i});
         lsa = init.other.make_lsa(LevelId{i});
-        lsa.dir() = init.dir;
     }
 
     // Copy init track's position but update the direction
     this->level() = states_.level[init.other.track_slot_];
     this->surface_level() = states_.surface_level[init.other.track_slot_];
+    this->assign_dir(init.dir);
 
     // Clear step and surface info
     this->clear_next_step();
@@ -410,6 +436,7 @@ CELER_FUNCTION Propagation OrangeTrackView::find_next_step()
         auto tracker = this->make_tracker(UniverseId{0});
         auto isect = tracker.intersect(this->make_local_state(LevelId{0}));
         this->find_next_step_impl(isect);
+        this->boundary_step() = this->next_step();
     }
 
     Propagation result;
@@ -424,6 +451,10 @@ CELER_FUNCTION Propagation OrangeTrackView::find_next_step()
  *
  * This may reduce the number of surfaces needed to check, sort, or write to
  * temporary memory, thereby speeding up transport.
+ *
+ * If every level's volume is bounded only by its faces, the exact distance is
+ * calculated and cached instead, since it costs no more. While that cached
+ * distance is beyond the maximum step, no intersection is calculated at all.
  */
 CELER_FUNCTION Propagation OrangeTrackView::find_next_step(real_type max_step)
 {
@@ -443,16 +474,35 @@ CELER_FUNCTION Propagation OrangeTrackView::find_next_step(real_type max_step)
     }
     else if (!this->next_surface() && this->next_step() < max_step)
     {
-        // Reset a previously found truncated distance
-        this->clear_next_step();
+        // Reset a previously found truncated distance but keep the cached
+        // boundary distance
+        this->next_step() = 0;
     }
 
     if (!this->has_next_step())
     {
-        auto tracker = this->make_tracker(UniverseId{0});
-        auto isect
-            = tracker.intersect(this->make_local_state(LevelId{0}), max_step);
-        this->find_next_step_impl(isect);
+        if (!(this->boundary_step() > max_step))
+        {
+            // Boundary is unknown or may be within the given step
+            auto tracker = this->make_tracker(UniverseId{0});
+            auto local = this->make_local_state(LevelId{0});
+            if (this->exact_intersect_is_cheap())
+            {
+                this->find_next_step_impl(tracker.intersect(local));
+                this->boundary_step() = this->next_step();
+            }
+            else
+            {
+                this->find_next_step_impl(tracker.intersect(local, max_step));
+            }
+        }
+        if (this->boundary_step() > max_step)
+        {
+            // Exact boundary is beyond the given step: truncate
+            this->next_step() = max_step;
+            this->next_surface() = {};
+            this->next_surface_level() = {};
+        }
     }
 
     Propagation result;
@@ -513,6 +563,8 @@ CELER_FUNCTION void OrangeTrackView::move_internal(real_type dist)
         lsa.surf() = LocalSurfaceId{};
     }
     this->next_step() -= dist;
+    this->boundary_step() = celeritas::max(this->boundary_step() - dist,
+                                           real_type{0});
 
     this->surface_level() = LevelId{};
 }
@@ -536,14 +588,7 @@ CELER_FUNCTION void OrangeTrackView::move_internal(Real3 const& pos)
 
         if (i < this->level())
         {
-            auto tracker = this->make_tracker(lsa.universe());
-            auto daughter_id = tracker.daughter(lsa.vol());
-            CELER_ASSERT(daughter_id);
-            auto const& daughter = params_.daughters[daughter_id];
-            auto const& trans = params_.translations[daughter.translation_id];
-
-            TranslatorDown td(trans);
-            local_pos = td(pos);
+            local_pos = this->make_transformer(lsa)(local_pos);
         }
     }
 
@@ -618,19 +663,18 @@ CELER_FUNCTION void OrangeTrackView::cross_boundary()
 
     while (daughter_id)
     {
-        auto daughter = params_.daughters[daughter_id];
-        // Get the translator at the parent level, in order to translate into
+        // Get the transformer at the parent level, in order to transform into
         // daughter
-        TranslatorDown translator(
-            params_.translations[daughter.translation_id]);
+        auto transformer = this->make_transformer(daughter_id);
 
         // Make the current level the daughter level
         ++level;
-        universe_id = daughter.universe_id;
+        universe_id = params_.daughters[daughter_id].universe_id;
         auto tracker = this->make_tracker(universe_id);
 
         // Create local state on the daughter level
-        local.pos = translator(local.pos);
+        local.pos = transformer(local.pos);
+        local.dir = transformer.rotate(local.dir);
         local.volume = {};
         local.surface = {};
         local.temp_sense = this->make_temp_sense();
@@ -667,30 +711,35 @@ CELER_FUNCTION void OrangeTrackView::set_dir(Real3 const& newdir)
 {
     CELER_EXPECT(is_soft_unit_vector(newdir));
 
-    auto lsa = this->make_lsa();
-
     if (this->is_on_boundary())
     {
         // Changing direction on a boundary is dangerous, as it could mean we
         // don't leave the volume after all. Evaluate whether the direction
         // dotted with the surface normal changes (i.e. heading from inside to
-        // outside or vice versa).
-        auto tracker = this->make_tracker(UniverseId{0});
-        detail::UnitIndexer ui(params_.unit_indexer_data);
-        const Real3 normal = tracker.normal(
-            this->pos(), ui.local_surface(this->surface_id()).surface);
+        // outside or vice versa) in the frame of the surface's level.
+        auto surf_lsa = this->make_lsa(this->surface_level());
+        Real3 local_dir = newdir;
+        for (auto i : range(this->surface_level().get()))
+        {
+            local_dir
+                = this->make_transformer(this->make_lsa(LevelId{i}))
+                      .rotate(local_dir);
+        }
+        auto tracker = this->make_tracker(surf_lsa.universe());
+        const Real3 normal = tracker.normal(surf_lsa.pos(), surf_lsa.surf());
 
-        if ((dot_product(normal, newdir) >= 0)
-            != (dot_product(normal, this->dir()) >= 0))
+        if ((dot_product(normal, local_dir) >= 0)
+            != (dot_product(normal, surf_lsa.dir()) >= 0))
         {
             // The boundary crossing direction has changed! Reverse our plans
             // to change the logical state and move to a new volume.
+            auto lsa = this->make_lsa();
             lsa.boundary() = flip_boundary(lsa.boundary());
         }
     }
 
     // Complete direction setting
-    lsa.dir() = newdir;
+    this->assign_dir(newdir);
 
     this->clear_next_step();
 }
@@ -738,6 +787,15 @@ CELER_FUNCTION LevelId& OrangeTrackView::next_surface_level()
     return states_.next_surface_level[track_slot_];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * The cached exact distance to the next boundary, or zero if unknown.
+ */
+CELER_FUNCTION real_type& OrangeTrackView::boundary_step()
+{
+    return states_.boundary_step[track_slot_];
+}
+
 //---------------------------------------------------------------------------//
 // CONST STATE ACCESSORS
 //---------------------------------------------------------------------------//
@@ -781,6 +839,15 @@ CELER_FUNCTION LevelId const& OrangeTrackView::next_surface_level() const
     return states_.next_surface_level[track_slot_];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * The cached exact distance to the next boundary, or zero if unknown.
+ */
+CELER_FUNCTION real_type const& OrangeTrackView::boundary_step() const
+{
+    return states_.boundary_step[track_slot_];
+}
+
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -868,6 +935,51 @@ CELER_FUNCTION SimpleUnitTracker OrangeTrackView::make_tracker(UniverseId id) co
     return TrackerT{params_, IdT{id.unchecked_get()}};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Create a transformer from a parent universe into a daughter.
+ */
+CELER_FUNCTION TransformerDown
+OrangeTrackView::make_transformer(DaughterId id) const
+{
+    CELER_EXPECT(id < params_.daughters.size());
+    Daughter const& daughter = params_.daughters[id];
+    return TransformerDown{
+        params_.translations[daughter.translation_id],
+        daughter.rotation_id ? &params_.rotations[daughter.rotation_id]
+                             : nullptr};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create a transformer into the daughter universe filling a level's volume.
+ */
+CELER_FUNCTION TransformerDown
+OrangeTrackView::make_transformer(LevelStateAccessor const& lsa) const
+{
+    auto daughter_id = this->make_tracker(lsa.universe()).daughter(lsa.vol());
+    CELER_ASSERT(daughter_id);
+    return this->make_transformer(daughter_id);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the direction at every level, rotating into each daughter frame.
+ */
+CELER_FUNCTION void OrangeTrackView::assign_dir(Real3 const& dir)
+{
+    Real3 local_dir = dir;
+    for (auto i : range(this->level() + 1))
+    {
+        auto lsa = this->make_lsa(LevelId{i});
+        lsa.dir() = local_dir;
+        if (i < this->level())
+        {
+            local_dir = this->make_transformer(lsa).rotate(local_dir);
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get a reference to the current volume, or to world volume if outside.
@@ -919,6 +1031,28 @@ OrangeTrackView::make_local_state(LevelId level) const
     return local;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether an exact intersection search is as cheap as a bounded one.
+ *
+ * This is true if the current volume at every level is bounded only by its
+ * faces, so that the nearest boundary is found by a linear search over all of
+ * them regardless of the maximum distance.
+ */
+CELER_FUNCTION bool OrangeTrackView::exact_intersect_is_cheap() const
+{
+    for (auto levelid : range(LevelId{0}, this->level() + 1))
+    {
+        auto lsa = this->make_lsa(levelid);
+        if (!this->make_tracker(lsa.universe())
+                 .exact_intersect_is_cheap(lsa.vol()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether any next step has been calculated.
@@ -930,7 +1064,7 @@ CELER_FUNCTION bool OrangeTrackView::has_next_step() const
 
 //---------------------------------------------------------------------------//
 /*!
- * Reset the next distance-to-boundary.
+ * Reset the next distance-to-boundary and the cached boundary distance.
  *
  * The next surface ID should only ever be used when next_step is zero, so it
  * is OK to wrap it with the CELERITAS_DEBUG conditional.
@@ -940,6 +1074,7 @@ CELER_FUNCTION void OrangeTrackView::clear_next_step()
     states_.next_step[track_slot_] = 0;
     states_.next_surface[track_slot_] = {};
     states_.next_surface_level[track_slot_] = {};
+    states_.boundary_step[track_slot_] = 0;
 }
 
 //---------------------------------------------------------------------------//
@@ -26,19 +26,15 @@ char const* to_cstring(SurfaceType value)
         "cyc",
         "czc",
         "sc",
-#if 0
         "cx",
         "cy",
         "cz",
         "p",
-#endif
         "s",
-#if 0
         "kx",
         "ky",
         "kz",
         "sq",
-#endif
         "gq",
     };
     return to_cstring_impl(value);
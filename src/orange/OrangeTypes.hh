@@ -54,6 +54,12 @@ using Translation = Real3;
 //! Identifier for a translation of a single embedded universe
 using TranslationId = OpaqueId<Translation>;
 
+//! Rotation matrix (row-major) of a single embedded universe
+using Rotation = Array<Real3, 3>;
+
+//! Identifier for a rotation of a single embedded universe
+using RotationId = OpaqueId<Rotation>;
+
 //! Identifier for a relocatable set of volumes
 using UniverseId = OpaqueId<struct Universe>;
 
@@ -95,19 +101,15 @@ enum class SurfaceType : unsigned char
     cyc,  //!< Cylinder centered on Y axis
     czc,  //!< Cylinder centered on Z axis
     sc,  //!< Sphere centered at the origin
-#if 0
     cx,  //!< Cylinder parallel to X axis
     cy,  //!< Cylinder parallel to Y axis
     cz,  //!< Cylinder parallel to Z axis
-    p,   //!< General plane
-#endif
+    p,  //!< General plane
     s,  //!< Sphere
-#if 0
     kx,  //!< Cone parallel to X axis
     ky,  //!< Cone parallel to Y axis
     kz,  //!< Cone parallel to Z axis
     sq,  //!< Simple quadric
-#endif
     gq,  //!< General quadric
     size_  //!< Sentinel value for number of surface types
 };
@@ -213,6 +215,7 @@ struct Daughter
 {
     UniverseId universe_id;
     TranslationId translation_id;
+    RotationId rotation_id;  //!< Null if not rotated
 };
 
 //---------------------------------------------------------------------------//
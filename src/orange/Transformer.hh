@@ -0,0 +1,160 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/Transformer.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/cont/Range.hh"
+#include "orange/OrangeTypes.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Transform points and directions from a parent's reference frame into the
+ * daughter.
+ *
+ * The daughter universe is placed in the parent by rotating it and then
+ * translating it: \f$ x_p = R x_d + t \f$. A null rotation pointer is the
+ * identity, in which case the point is only translated.
+ */
+class TransformerDown
+{
+  public:
+    // Construct with the daughter placement
+    inline CELER_FUNCTION TransformerDown(Translation const& translation,
+                                          Rotation const* rotation);
+
+    // Transform a single point
+    CELER_FORCEINLINE_FUNCTION Real3 operator()(Real3 const& parent) const;
+
+    // Rotate a direction
+    CELER_FORCEINLINE_FUNCTION Real3 rotate(Real3 const& parent) const;
+
+  private:
+    Translation const& translation_;
+    Rotation const* rotation_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transform points and directions from a daughter's reference frame "up" into
+ * the parent.
+ *
+ * The construction arguments are the same as for \c TransformerDown .
+ */
+class TransformerUp
+{
+  public:
+    // Construct with the daughter placement
+    inline CELER_FUNCTION TransformerUp(Translation const& translation,
+                                        Rotation const* rotation);
+
+    // Transform a single point
+    CELER_FORCEINLINE_FUNCTION Real3 operator()(Real3 const& daughter) const;
+
+    // Rotate a direction
+    CELER_FORCEINLINE_FUNCTION Real3 rotate(Real3 const& daughter) const;
+
+  private:
+    Translation const& translation_;
+    Rotation const* rotation_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with translation and optional rotation.
+ */
+CELER_FUNCTION TransformerDown::TransformerDown(Translation const& translation,
+                                                Rotation const* rotation)
+    : translation_(translation), rotation_(rotation)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transform a single point.
+ */
+CELER_FUNCTION Real3 TransformerDown::operator()(Real3 const& parent) const
+{
+    Real3 local;
+    for (int i : range(3))
+    {
+        local[i] = parent[i] - translation_[i];
+    }
+    return this->rotate(local);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Rotate a direction (multiply by the transpose of the rotation).
+ */
+CELER_FUNCTION Real3 TransformerDown::rotate(Real3 const& parent) const
+{
+    if (!rotation_)
+    {
+        return parent;
+    }
+
+    Rotation const& r = *rotation_;
+    Real3 daughter;
+    for (int i : range(3))
+    {
+        daughter[i] = r[0][i] * parent[0] + r[1][i] * parent[1]
+                      + r[2][i] * parent[2];
+    }
+    return daughter;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with translation and optional rotation.
+ */
+CELER_FUNCTION TransformerUp::TransformerUp(Translation const& translation,
+                                            Rotation const* rotation)
+    : translation_(translation), rotation_(rotation)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transform a single point.
+ */
+CELER_FUNCTION Real3 TransformerUp::operator()(Real3 const& daughter) const
+{
+    Real3 parent = this->rotate(daughter);
+    for (int i : range(3))
+    {
+        parent[i] += translation_[i];
+    }
+    return parent;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Rotate a direction.
+ */
+CELER_FUNCTION Real3 TransformerUp::rotate(Real3 const& daughter) const
+{
+    if (!rotation_)
+    {
+        return daughter;
+    }
+
+    Rotation const& r = *rotation_;
+    Real3 parent;
+    for (int i : range(3))
+    {
+        parent[i] = r[i][0] * daughter[0] + r[i][1] * daughter[1]
+                    + r[i][2] * daughter[2];
+    }
+    return parent;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -14,7 +14,6 @@
 #include "orange/BoundingBox.hh"
 #include "orange/OrangeData.hh"
 #include "orange/OrangeTypes.hh"
-#include "orange/Translator.hh"
 
 namespace celeritas
 {
@@ -82,6 +81,8 @@ struct UnitInput
     {
         UniverseId universe_id;
         Translation translation;
+        //! Rotation applied before translating (identity by default)
+        Rotation rotation{{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}};
     };
     using MapVolumeDaughter = std::unordered_map<LocalVolumeId, Daughter>;
 
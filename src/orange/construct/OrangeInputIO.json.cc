@@ -39,6 +39,25 @@ make_translation(celeritas::Span<celeritas::real_type const> const& trans)
     CELER_EXPECT(trans.size() == 3);
     return celeritas::Translation{trans[0], trans[1], trans[2]};
 }
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create a Rotation object from a Span into a vector of row-major matrix data.
+ */
+celeritas::Rotation
+make_rotation(celeritas::Span<celeritas::real_type const> const& rot)
+{
+    CELER_EXPECT(rot.size() == 9);
+    celeritas::Rotation result;
+    for (auto i : celeritas::range(3))
+    {
+        for (auto j : celeritas::range(3))
+        {
+            result[i][j] = rot[3 * i + j];
+        }
+    }
+    return result;
+}
 }  // namespace
 
 namespace celeritas
@@ -207,13 +226,29 @@ void from_json(nlohmann::json const& j, UnitInput& value)
                        << "field 'translations' is not 3x length of "
                           "'parent_cells'");
 
+        // Rotation matrices are optional
+        std::vector<real_type> rotations;
+        if (j.contains("rotations"))
+        {
+            j.at("rotations").get_to(rotations);
+            CELER_VALIDATE(9 * parent_cells.size() == rotations.size(),
+                           << "field 'rotations' is not 9x length of "
+                              "'parent_cells'");
+        }
+
         UnitInput::MapVolumeDaughter daughter_map;
         for (auto i : range(parent_cells.size()))
         {
-            daughter_map[LocalVolumeId{parent_cells[i]}]
-                = {UniverseId{daughters[i]},
-                   make_translation(
-                       Span<real_type const>(translations.data() + 3 * i, 3))};
+            UnitInput::Daughter daughter;
+            daughter.universe_id = UniverseId{daughters[i]};
+            daughter.translation = make_translation(
+                Span<real_type const>(translations.data() + 3 * i, 3));
+            if (!rotations.empty())
+            {
+                daughter.rotation = make_rotation(
+                    Span<real_type const>(rotations.data() + 9 * i, 9));
+            }
+            daughter_map[LocalVolumeId{parent_cells[i]}] = daughter;
         }
 
         value.daughter_map = std::move(daughter_map);
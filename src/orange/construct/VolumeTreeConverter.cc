@@ -0,0 +1,667 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/construct/VolumeTreeConverter.cc
+//---------------------------------------------------------------------------//
+#include "VolumeTreeConverter.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "orange/BoundingBox.hh"
+#include "orange/Types.hh"
+#include "orange/surf/ConeAligned.hh"
+#include "orange/surf/CylAligned.hh"
+#include "orange/surf/CylCentered.hh"
+#include "orange/surf/GeneralQuadric.hh"
+#include "orange/surf/Plane.hh"
+#include "orange/surf/PlaneAligned.hh"
+#include "orange/surf/Sphere.hh"
+#include "orange/surf/SphereCentered.hh"
+
+#include "SurfaceInputBuilder.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// TYPES
+//---------------------------------------------------------------------------//
+//! Logic expression using unit surface IDs rather than face indices
+using VecLogic = std::vector<logic_int>;
+
+//---------------------------------------------------------------------------//
+// CONSTANTS
+//---------------------------------------------------------------------------//
+//! Tolerance for snapping transformed surfaces to the coordinate axes
+constexpr real_type axis_tol = 1e-10;
+
+//! Masking priority for explicitly defined volumes
+constexpr int zorder_media = 2;
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Find the coordinate axis parallel to a unit vector, if any.
+ */
+Axis find_aligned_axis(Real3 const& v)
+{
+    for (auto i : range(3))
+    {
+        if (std::fabs(v[i]) > 1 - axis_tol)
+        {
+            return static_cast<Axis>(i);
+        }
+    }
+    return Axis::size_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a surface ID to a logic token.
+ */
+logic_int to_token(LocalSurfaceId id)
+{
+    CELER_VALIDATE(id.unchecked_get() < logic::lbegin,
+                   << "too many surfaces in unit (" << id.unchecked_get()
+                   << ") for logic representation");
+    return static_cast<logic_int>(id.unchecked_get());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Insert an axis-aligned surface given a runtime axis.
+ */
+template<template<Axis> class S, class... Args>
+LocalSurfaceId insert_aligned(SurfaceInputBuilder& insert_surface,
+                              Axis ax,
+                              Label const& label,
+                              Args const&... args)
+{
+    switch (ax)
+    {
+        case Axis::x:
+            return insert_surface(S<Axis::x>{args...}, label);
+        case Axis::y:
+            return insert_surface(S<Axis::y>{args...}, label);
+        case Axis::z:
+            return insert_surface(S<Axis::z>{args...}, label);
+        default:
+            CELER_ASSERT_UNREACHABLE();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a quadric of revolution about an arbitrary axis.
+ *
+ * The surface is \f$ (x - p)^T M (x - p) - r^2 = 0 \f$ with
+ * \f$ M = I - k a a^T \f$: \em k is 1 for a cylinder and \f$ 1 + t^2 \f$ for a
+ * cone with half-angle tangent \em t.
+ */
+GeneralQuadric make_quadric(Real3 const& axis,
+                            real_type k,
+                            Real3 const& point,
+                            real_type radius_sq)
+{
+    Array<Real3, 3> m;
+    for (auto i : range(3))
+    {
+        for (auto j : range(3))
+        {
+            m[i][j] = (i == j ? 1 : 0) - k * axis[i] * axis[j];
+        }
+    }
+    Real3 mp;
+    for (auto i : range(3))
+    {
+        mp[i] = dot_product(m[i], point);
+    }
+
+    return GeneralQuadric{{m[0][0], m[1][1], m[2][2]},
+                          {2 * m[0][1], 2 * m[1][2], 2 * m[0][2]},
+                          {-2 * mp[0], -2 * mp[1], -2 * mp[2]},
+                          dot_product(point, mp) - radius_sq};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Append a sub-expression, optionally negated, and intersect with the
+ * existing expression.
+ */
+void append_and(VecLogic* logic, VecLogic const& expr, bool negate)
+{
+    bool const was_empty = logic->empty();
+    logic->insert(logic->end(), expr.begin(), expr.end());
+    if (negate)
+    {
+        if (expr.size() == 2 && expr.back() == logic::lnot)
+        {
+            // Remove double negation of a single surface
+            logic->pop_back();
+        }
+        else
+        {
+            logic->push_back(logic::lnot);
+        }
+    }
+    if (!was_empty)
+    {
+        logic->push_back(logic::land);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Replace surface IDs in the volume logic with indices into its faces.
+ */
+void finalize_faces(VolumeInput* vol)
+{
+    CELER_EXPECT(vol->faces.empty());
+    for (logic_int token : vol->logic)
+    {
+        if (!logic::is_operator_token(token))
+        {
+            vol->faces.push_back(LocalSurfaceId{token});
+        }
+    }
+    std::sort(vol->faces.begin(), vol->faces.end());
+    vol->faces.erase(std::unique(vol->faces.begin(), vol->faces.end()),
+                     vol->faces.end());
+
+    for (logic_int& token : vol->logic)
+    {
+        if (!logic::is_operator_token(token))
+        {
+            auto iter = std::lower_bound(
+                vol->faces.begin(), vol->faces.end(), LocalSurfaceId{token});
+            CELER_ASSERT(iter != vol->faces.end());
+            token = iter - vol->faces.begin();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the bounding box of a solid in its local frame.
+ */
+BoundingBox calc_local_bbox(SolidInput const& solid)
+{
+    auto const& p = solid.params;
+    Real3 upper;
+    switch (solid.type)
+    {
+        case SolidInput::Type::box:
+            upper = {p[0], p[1], p[2]};
+            break;
+        case SolidInput::Type::tube:
+            upper = {p[1], p[1], p[2]};
+            break;
+        case SolidInput::Type::cone: {
+            real_type rmax = std::max(p[1], p[3]);
+            upper = {rmax, rmax, p[4]};
+            break;
+        }
+        case SolidInput::Type::sphere:
+            upper = {p[1], p[1], p[1]};
+            break;
+        default:
+            CELER_ASSERT_UNREACHABLE();
+    }
+    return {{-upper[0], -upper[1], -upper[2]}, upper};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Insert the surfaces of a placed solid and construct its "inside" logic.
+ */
+class SolidInserter
+{
+  public:
+    // Construct with surface builder and placement
+    SolidInserter(SurfaceInputBuilder* insert_surface,
+                  std::string const& name,
+                  Translation const& translation,
+                  Rotation const& rotation);
+
+    // Insert surfaces and return the logic for the interior
+    VecLogic operator()(SolidInput const& solid);
+
+  private:
+    SurfaceInputBuilder& insert_surface_;
+    std::string const& name_;
+    Translation const& translation_;
+    Rotation const& rotation_;
+
+    //// HELPER FUNCTIONS ////
+
+    Real3 transform_dir(size_type local_axis) const;
+    Label make_label(char const* suffix) const;
+
+    VecLogic plane(size_type ax, real_type pos, char const* suffix);
+    VecLogic cyl(real_type radius, char const* suffix);
+    VecLogic cone(real_type vertex_z, real_type tangent, char const* suffix);
+    VecLogic sphere(real_type radius, char const* suffix);
+    VecLogic
+    revolution(real_type r1, real_type r2, real_type hz, char const* suffix);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with surface builder and placement.
+ */
+SolidInserter::SolidInserter(SurfaceInputBuilder* insert_surface,
+                             std::string const& name,
+                             Translation const& translation,
+                             Rotation const& rotation)
+    : insert_surface_(*insert_surface)
+    , name_(name)
+    , translation_(translation)
+    , rotation_(rotation)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Insert surfaces and return the logic for the interior.
+ */
+VecLogic SolidInserter::operator()(SolidInput const& solid)
+{
+    static size_type const expected_size[] = {3, 3, 5, 2};
+    CELER_VALIDATE(solid, << "solid for '" << name_ << "' is undefined");
+    CELER_VALIDATE(solid.params.size()
+                       == expected_size[static_cast<int>(solid.type)],
+                   << "incorrect number of parameters ("
+                   << solid.params.size() << ") for solid of '" << name_
+                   << "'");
+    for (real_type v : solid.params)
+    {
+        CELER_VALIDATE(v >= 0,
+                       << "invalid solid parameter " << v << " for '" << name_
+                       << "'");
+    }
+
+    auto const& p = solid.params;
+    VecLogic result;
+    switch (solid.type)
+    {
+        case SolidInput::Type::box: {
+            static char const* const names[] = {"x", "y", "z"};
+            for (auto ax : range(size_type(3)))
+            {
+                CELER_VALIDATE(p[ax] > 0,
+                               << "degenerate box for '" << name_ << "'");
+                std::string suffix = names[ax];
+                append_and(&result,
+                           this->plane(ax, -p[ax], ("m" + suffix).c_str()),
+                           false);
+                append_and(&result,
+                           this->plane(ax, p[ax], ("p" + suffix).c_str()),
+                           true);
+            }
+            break;
+        }
+        case SolidInput::Type::tube:
+            CELER_VALIDATE(p[1] > p[0] && p[2] > 0,
+                           << "degenerate tube for '" << name_ << "'");
+            append_and(&result, this->plane(2, -p[2], "mz"), false);
+            append_and(&result, this->plane(2, p[2], "pz"), true);
+            append_and(&result, this->cyl(p[1], "rmax"), true);
+            if (p[0] > 0)
+            {
+                append_and(&result, this->cyl(p[0], "rmin"), false);
+            }
+            break;
+        case SolidInput::Type::cone:
+            CELER_VALIDATE(p[1] >= p[0] && p[3] >= p[2]
+                               && (p[1] > 0 || p[3] > 0) && p[4] > 0,
+                           << "degenerate cone for '" << name_ << "'");
+            append_and(&result, this->plane(2, -p[4], "mz"), false);
+            append_and(&result, this->plane(2, p[4], "pz"), true);
+            append_and(
+                &result, this->revolution(p[1], p[3], p[4], "rmax"), true);
+            if (p[0] > 0 || p[2] > 0)
+            {
+                append_and(
+                    &result, this->revolution(p[0], p[2], p[4], "rmin"), false);
+            }
+            break;
+        case SolidInput::Type::sphere:
+            CELER_VALIDATE(p[1] > p[0],
+                           << "degenerate sphere for '" << name_ << "'");
+            append_and(&result, this->sphere(p[1], "rmax"), true);
+            if (p[0] > 0)
+            {
+                append_and(&result, this->sphere(p[0], "rmin"), false);
+            }
+            break;
+        default:
+            CELER_ASSERT_UNREACHABLE();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the direction of a local coordinate axis in the parent frame.
+ */
+Real3 SolidInserter::transform_dir(size_type local_axis) const
+{
+    return {rotation_[0][local_axis],
+            rotation_[1][local_axis],
+            rotation_[2][local_axis]};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a surface label from the placement name.
+ */
+Label SolidInserter::make_label(char const* suffix) const
+{
+    return Label{name_ + '.' + suffix};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Insert a plane normal to a local axis; return the "positive side" logic.
+ */
+VecLogic SolidInserter::plane(size_type ax, real_type pos, char const* suffix)
+{
+    Real3 normal = this->transform_dir(ax);
+    Real3 point;
+    for (auto i : range(3))
+    {
+        point[i] = translation_[i] + pos * normal[i];
+    }
+
+    Axis aligned = find_aligned_axis(normal);
+    if (aligned == Axis::size_)
+    {
+        auto id = insert_surface_(Plane{normal, point}, make_label(suffix));
+        return {to_token(id)};
+    }
+
+    int const ax_idx = static_cast<int>(aligned);
+    auto id = insert_aligned<PlaneAligned>(
+        insert_surface_, aligned, make_label(suffix), point[ax_idx]);
+    if (normal[ax_idx] < 0)
+    {
+        // Plane is flipped relative to the local axis
+        return {to_token(id), logic::lnot};
+    }
+    return {to_token(id)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Insert a cylinder along the local z axis; return the "outside" logic.
+ */
+VecLogic SolidInserter::cyl(real_type radius, char const* suffix)
+{
+    Real3 axis = this->transform_dir(2);
+    Axis aligned = find_aligned_axis(axis);
+    LocalSurfaceId id;
+    if (aligned == Axis::size_)
+    {
+        id = insert_surface_(
+            make_quadric(axis, 1, translation_, ipow<2>(radius)),
+            make_label(suffix));
+    }
+    else
+    {
+        bool centered = true;
+        for (auto i : range(3))
+        {
+            if (i != static_cast<int>(aligned)
+                && std::fabs(translation_[i]) > axis_tol)
+            {
+                centered = false;
+            }
+        }
+        id = centered ? insert_aligned<CylCentered>(
+                 insert_surface_, aligned, make_label(suffix), radius)
+                      : insert_aligned<CylAligned>(insert_surface_,
+                                                   aligned,
+                                                   make_label(suffix),
+                                                   translation_,
+                                                   radius);
+    }
+    return {to_token(id)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Insert a double cone along the local z axis; return the "outside" logic.
+ */
+VecLogic
+SolidInserter::cone(real_type vertex_z, real_type tangent, char const* suffix)
+{
+    Real3 axis = this->transform_dir(2);
+    Real3 vertex;
+    for (auto i : range(3))
+    {
+        vertex[i] = translation_[i] + vertex_z * axis[i];
+    }
+
+    Axis aligned = find_aligned_axis(axis);
+    LocalSurfaceId id;
+    if (aligned == Axis::size_)
+    {
+        id = insert_surface_(
+            make_quadric(axis, 1 + ipow<2>(tangent), vertex, 0),
+            make_label(suffix));
+    }
+    else
+    {
+        id = insert_aligned<ConeAligned>(insert_surface_,
+                                         aligned,
+                                         make_label(suffix),
+                                         vertex,
+                                         std::fabs(tangent));
+    }
+    return {to_token(id)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Insert a sphere at the local origin; return the "outside" logic.
+ */
+VecLogic SolidInserter::sphere(real_type radius, char const* suffix)
+{
+    LocalSurfaceId id;
+    if (std::all_of(translation_.begin(),
+                    translation_.end(),
+                    [](real_type v) { return std::fabs(v) <= axis_tol; }))
+    {
+        id = insert_surface_(SphereCentered{radius}, make_label(suffix));
+    }
+    else
+    {
+        id = insert_surface_(Sphere{translation_, radius}, make_label(suffix));
+    }
+    return {to_token(id)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Insert a surface of revolution whose radius varies linearly along z.
+ *
+ * The radius is \c r1 at \f$ -h_z \f$ and \c r2 at \f$ +h_z \f$. The "outside"
+ * logic is returned.
+ */
+VecLogic SolidInserter::revolution(real_type r1,
+                                   real_type r2,
+                                   real_type hz,
+                                   char const* suffix)
+{
+    if (r1 == r2)
+    {
+        return this->cyl(r1, suffix);
+    }
+    real_type tangent = (r2 - r1) / (2 * hz);
+    return this->cone(-hz - r1 / tangent, tangent, suffix);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert the tree.
+ */
+OrangeInput VolumeTreeConverter::operator()(VolumeTreeInput const& input)
+{
+    CELER_VALIDATE(input, << "world volume is not in the volume tree");
+
+    input_ = &input;
+    universe_ids_.assign(input.logicals.size(), {});
+    levels_.assign(input.logicals.size(), 0);
+    result_ = {};
+
+    UniverseId world_id = this->build_unit(input.world);
+    CELER_ASSERT(world_id == UniverseId{0});
+    result_.max_level = levels_[input.world];
+
+    input_ = nullptr;
+    OrangeInput result = std::move(result_);
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the unit for a logical volume and its (non-leaf) descendants.
+ */
+UniverseId VolumeTreeConverter::build_unit(size_type logical)
+{
+    CELER_EXPECT(logical < input_->logicals.size());
+
+    if (universe_ids_[logical])
+    {
+        // Unit has already been built
+        CELER_VALIDATE(levels_[logical] > 0,
+                       << "logical volume '"
+                       << input_->logicals[logical].label
+                       << "' is recursively placed inside itself");
+        return universe_ids_[logical];
+    }
+
+    LogicalVolumeInput const& lv = input_->logicals[logical];
+    CELER_VALIDATE(lv, << "logical volume '" << lv.label << "' is invalid");
+    bool const is_world = (logical == input_->world);
+
+    UniverseId const uid{static_cast<size_type>(result_.units.size())};
+    universe_ids_[logical] = uid;
+    result_.units.emplace_back();
+
+    UnitInput unit;
+    unit.label = lv.label;
+    unit.bbox = calc_local_bbox(lv.solid);
+    SurfaceInputBuilder insert_surface(&unit.surfaces);
+
+    // Logic for the material of this logical volume
+    VecLogic material;
+
+    // Create exterior: "nowhere" for daughter units
+    {
+        VolumeInput exterior;
+        exterior.label = Label{"[EXTERIOR]"};
+        exterior.zorder = zorder_media;
+        if (is_world)
+        {
+            static Rotation const identity{{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}};
+            static Translation const origin{0, 0, 0};
+            SolidInserter insert_solid(
+                &insert_surface, lv.label.name, origin, identity);
+            material = insert_solid(lv.solid);
+            exterior.logic = material;
+            exterior.logic.push_back(logic::lnot);
+            exterior.flags = VolumeRecord::internal_surfaces;
+        }
+        else
+        {
+            exterior.logic = {logic::ltrue, logic::lnot};
+            exterior.flags = VolumeRecord::implicit_vol;
+        }
+        unit.volumes.push_back(std::move(exterior));
+    }
+
+    // Reserve a slot for the material
+    unit.volumes.emplace_back();
+
+    // Create daughters
+    size_type level = 1;
+    for (PlacementInput const& pl : lv.daughters)
+    {
+        CELER_VALIDATE(pl.logical < input_->logicals.size(),
+                       << "placement '" << pl.label
+                       << "' has an invalid logical volume index "
+                       << pl.logical);
+        LogicalVolumeInput const& daughter_lv = input_->logicals[pl.logical];
+
+        SolidInserter insert_solid(
+            &insert_surface, pl.label.name, pl.translation, pl.rotation);
+        VolumeInput vol;
+        vol.zorder = zorder_media;
+        vol.logic = insert_solid(daughter_lv.solid);
+        append_and(&material, vol.logic, true);
+
+        if (daughter_lv.daughters.empty())
+        {
+            // Leaf volume: insert directly
+            vol.label = daughter_lv.label;
+        }
+        else
+        {
+            // Embed the daughter's unit
+            vol.label = pl.label;
+            UnitInput::Daughter daughter;
+            daughter.universe_id = this->build_unit(pl.logical);
+            daughter.translation = pl.translation;
+            daughter.rotation = pl.rotation;
+            unit.daughter_map.emplace(LocalVolumeId(unit.volumes.size()),
+                                      std::move(daughter));
+            level = std::max(level, levels_[pl.logical] + 1);
+        }
+        unit.volumes.push_back(std::move(vol));
+    }
+
+    // Create the material volume
+    {
+        VolumeInput& vol = unit.volumes[1];
+        vol.label = lv.label;
+        vol.zorder = zorder_media;
+        vol.logic = std::move(material);
+        if (vol.logic.empty())
+        {
+            // Non-world unit without daughters: everywhere
+            vol.logic = {logic::ltrue};
+        }
+        if (!lv.daughters.empty())
+        {
+            vol.flags = VolumeRecord::internal_surfaces;
+        }
+    }
+
+    for (VolumeInput& vol : unit.volumes)
+    {
+        finalize_faces(&vol);
+    }
+
+    levels_[logical] = level;
+    result_.units[uid.unchecked_get()] = std::move(unit);
+    return uid;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,57 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/construct/VolumeTreeConverter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "OrangeInput.hh"
+#include "VolumeTreeInput.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a hierarchy of placed solids into ORANGE units.
+ *
+ * Each logical volume that has daughters becomes a unit. Its daughters are
+ * volumes bounded by the surfaces of their solids, transformed into the
+ * unit's frame. A daughter without daughters of its own is inserted directly
+ * as a "leaf" volume; otherwise the volume embeds the daughter's unit as a
+ * (translated and rotated) universe. The remaining space in the unit is the
+ * material of the logical volume itself.
+ *
+ * Surfaces that are aligned with the coordinate axes after transformation are
+ * written as the corresponding specialized ORANGE surface; others become
+ * general planes and quadrics.
+ *
+ * \code
+   VolumeTreeConverter convert;
+   auto params = std::make_shared<OrangeParams>(convert(tree));
+   \endcode
+ */
+class VolumeTreeConverter
+{
+  public:
+    // Convert the tree
+    OrangeInput operator()(VolumeTreeInput const& input);
+
+  private:
+    //// DATA ////
+
+    VolumeTreeInput const* input_{nullptr};
+    std::vector<UniverseId> universe_ids_;
+    std::vector<size_type> levels_;
+    OrangeInput result_;
+
+    //// HELPER FUNCTIONS ////
+
+    UniverseId build_unit(size_type logical);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,99 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/construct/VolumeTreeInput.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Label.hh"
+#include "orange/OrangeTypes.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Shape of a solid in its local reference frame.
+ *
+ * The parameters follow the constructor arguments of the corresponding
+ * Geant4 solids, with lengths in native units:
+ * - \c box: half-widths \c {hx, hy, hz}
+ * - \c tube: \c {rmin, rmax, hz} for a full-azimuth tube along \em z
+ * - \c cone: \c {rmin1, rmax1, rmin2, rmax2, hz} with the first pair at
+ *   \f$ z = -h_z \f$ and the second at \f$ z = +h_z \f$
+ * - \c sphere: \c {rmin, rmax} for a full sphere or spherical shell
+ */
+struct SolidInput
+{
+    enum class Type
+    {
+        box,
+        tube,
+        cone,
+        sphere,
+        size_
+    };
+
+    Type type{Type::size_};
+    std::vector<real_type> params;
+
+    //! Whether the solid definition is valid
+    explicit operator bool() const { return type != Type::size_; }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Placement of a logical volume inside its parent.
+ *
+ * Points in the daughter are transformed into the parent by rotating and then
+ * translating: \f$ x_p = R x_d + t \f$ .
+ */
+struct PlacementInput
+{
+    //! Physical volume name
+    Label label;
+    //! Index of the placed logical volume
+    size_type logical{};
+    //! Translation of the daughter origin in the parent
+    Translation translation{0, 0, 0};
+    //! Rotation of the daughter in the parent
+    Rotation rotation{{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * A logical volume: a solid with an optional set of placed daughters.
+ *
+ * Daughters must be entirely inside the solid and must not overlap each other.
+ */
+struct LogicalVolumeInput
+{
+    Label label;
+    SolidInput solid;
+    std::vector<PlacementInput> daughters;
+
+    //! Whether the logical volume definition is valid
+    explicit operator bool() const { return static_cast<bool>(solid); }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Hierarchy of logical volumes in the style of Geant4 or GDML.
+ *
+ * The world volume is placed at the origin without rotation.
+ */
+struct VolumeTreeInput
+{
+    std::vector<LogicalVolumeInput> logicals;
+    size_type world{};
+
+    //! Whether the tree definition is valid
+    explicit operator bool() const { return world < logicals.size(); }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
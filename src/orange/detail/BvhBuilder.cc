@@ -0,0 +1,151 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/BvhBuilder.cc
+//---------------------------------------------------------------------------//
+#include "BvhBuilder.hh"
+
+#include <algorithm>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "orange/BoundingBoxUtils.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with storage for the nodes and volume IDs.
+ */
+BvhBuilder::BvhBuilder(Data* storage) : storage_(storage)
+{
+    CELER_EXPECT(storage_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build the hierarchy and return the range of its nodes.
+ */
+ItemRange<BvhNode> BvhBuilder::operator()(VecBBox const& bboxes)
+{
+    // Partition volumes by whether their bounding boxes are finite
+    std::vector<LocalVolumeId> finite;
+    std::vector<LocalVolumeId> infinite;
+    for (auto i : range(bboxes.size()))
+    {
+        BoundingBox const& bbox = bboxes[i];
+        if (!bbox)
+        {
+            continue;
+        }
+        (is_finite(bbox) ? finite : infinite).push_back(LocalVolumeId(i));
+    }
+
+    VecNode nodes;
+    if (!infinite.empty())
+    {
+        this->add_leaf(bboxes, make_span(infinite), &nodes);
+    }
+    if (!finite.empty())
+    {
+        this->add_tree(bboxes, make_span(finite), &nodes);
+    }
+
+    return make_builder(&storage_->bvh_nodes)
+        .insert_back(nodes.begin(), nodes.end());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add a leaf for the given volumes.
+ */
+void BvhBuilder::add_leaf(VecBBox const& bboxes,
+                          Span<LocalVolumeId> volumes,
+                          VecNode* nodes)
+{
+    CELER_EXPECT(!volumes.empty());
+
+    std::sort(volumes.begin(), volumes.end());
+
+    BvhNode node;
+    node.bbox = bboxes[volumes.front().unchecked_get()];
+    for (LocalVolumeId v : volumes)
+    {
+        node.bbox = calc_union(node.bbox, bboxes[v.unchecked_get()]);
+    }
+    node.volumes = make_builder(&storage_->local_volume_ids)
+                       .insert_back(volumes.begin(), volumes.end());
+    node.escape = nodes->size() + 1;
+    nodes->push_back(node);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Recursively add a subtree for the given volumes.
+ */
+void BvhBuilder::add_tree(VecBBox const& bboxes,
+                          Span<LocalVolumeId> volumes,
+                          VecNode* nodes)
+{
+    CELER_EXPECT(!volumes.empty());
+
+    if (volumes.size() <= max_leaf_size)
+    {
+        this->add_leaf(bboxes, volumes, nodes);
+        return;
+    }
+
+    auto get_center = [&bboxes](LocalVolumeId v) {
+        return calc_center(bboxes[v.unchecked_get()]);
+    };
+
+    // Bound the volumes and their centers
+    BoundingBox bbox = bboxes[volumes.front().unchecked_get()];
+    BoundingBox centers{get_center(volumes.front()),
+                        get_center(volumes.front())};
+    for (LocalVolumeId v : volumes)
+    {
+        bbox = calc_union(bbox, bboxes[v.unchecked_get()]);
+        Real3 c = get_center(v);
+        centers = calc_union(centers, BoundingBox{c, c});
+    }
+
+    // Split at the median along the axis with the largest spread
+    int axis = 0;
+    for (int ax = 1; ax < 3; ++ax)
+    {
+        if (centers.upper()[ax] - centers.lower()[ax]
+            > centers.upper()[axis] - centers.lower()[axis])
+        {
+            axis = ax;
+        }
+    }
+    auto mid = volumes.begin() + volumes.size() / 2;
+    std::nth_element(
+        volumes.begin(),
+        mid,
+        volumes.end(),
+        [&get_center, axis](LocalVolumeId a, LocalVolumeId b) {
+            real_type ca = get_center(a)[axis];
+            real_type cb = get_center(b)[axis];
+            return ca < cb || (ca == cb && a < b);
+        });
+
+    // Add the interior node, then its children, then set the escape index
+    size_type idx = nodes->size();
+    BvhNode node;
+    node.bbox = bbox;
+    nodes->push_back(node);
+    this->add_tree(bboxes, volumes.first(volumes.size() / 2), nodes);
+    this->add_tree(bboxes, volumes.subspan(volumes.size() / 2), nodes);
+    (*nodes)[idx].escape = nodes->size();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
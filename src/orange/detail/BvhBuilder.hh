@@ -0,0 +1,72 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/BvhBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "orange/BoundingBox.hh"
+#include "orange/OrangeData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a bounding volume hierarchy from volume bounding boxes.
+ *
+ * The input is a bounding box for each local volume in a unit. Volumes with
+ * unassigned bounding boxes (implicit or provably empty volumes) are
+ * excluded. Volumes whose bounding boxes have infinite extents are placed in
+ * a leaf at the start of the hierarchy that is tested before the tree of
+ * finite volumes.
+ *
+ * The tree is built top-down by splitting the volumes at the median center
+ * along the axis with the largest spread of centers, until at most
+ * \c max_leaf_size volumes remain.
+ */
+class BvhBuilder
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Data = HostVal<OrangeParamsData>;
+    using VecBBox = std::vector<BoundingBox>;
+    //!@}
+
+    //! Maximum number of volumes in a leaf
+    static constexpr size_type max_leaf_size = 4;
+
+  public:
+    // Construct with storage for the nodes and volume IDs
+    explicit BvhBuilder(Data* storage);
+
+    // Build the hierarchy and return the range of its nodes
+    ItemRange<BvhNode> operator()(VecBBox const& bboxes);
+
+  private:
+    using VecNode = std::vector<BvhNode>;
+
+    Data* storage_;
+
+    // Add a leaf for the given volumes
+    void add_leaf(VecBBox const& bboxes,
+                  Span<LocalVolumeId> volumes,
+                  VecNode* nodes);
+
+    // Recursively add a subtree for the given volumes
+    void add_tree(VecBBox const& bboxes,
+                  Span<LocalVolumeId> volumes,
+                  VecNode* nodes);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
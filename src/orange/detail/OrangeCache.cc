@@ -0,0 +1,484 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/OrangeCache.cc
+//---------------------------------------------------------------------------//
+#include "OrangeCache.hh"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "celeritas_version.h"
+#include "corecel/Assert.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/math/HashUtils.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// Increment when the file layout changes
+constexpr std::uint32_t cache_version = 4;
+
+// Increment when the construction of the params data (e.g., unit insertion
+// or BVH building) changes without changing the stored types
+constexpr std::uint32_t construction_version = 1;
+
+// Alignment of each collection's data in the file
+constexpr std::size_t cache_alignment = alignof(std::max_align_t);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fixed-size header at the start of the cache file.
+ */
+struct CacheHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t real_size;
+    std::uint64_t build_hash;
+    std::uint64_t layout_hash;
+    std::uint64_t source_hash;
+};
+
+constexpr char cache_magic[8] = {'O', 'R', 'A', 'N', 'G', 'E', 'B', 'C'};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to every collection in the params data.
+ *
+ * This defines the order of the collections in the cache file.
+ */
+template<class D, class F>
+void for_each_collection(D& d, F&& visit)
+{
+    visit(d.universe_type);
+    visit(d.universe_index);
+    visit(d.simple_unit);
+    visit(d.local_surface_ids);
+    visit(d.local_volume_ids);
+    visit(d.real_ids);
+    visit(d.logic_ints);
+    visit(d.reals);
+    visit(d.surface_types);
+    visit(d.connectivities);
+    visit(d.volume_records);
+    visit(d.bvh_nodes);
+    visit(d.surface_batches);
+    visit(d.batch_faces);
+    visit(d.batch_reals);
+    visit(d.daughters);
+    visit(d.translations);
+    visit(d.rotations);
+    visit(d.unit_indexer_data.surfaces);
+    visit(d.unit_indexer_data.volumes);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Hash the code version to detect changes in how the data are constructed.
+ *
+ * Development builds include the git commit in the version string, so a cache
+ * written by any other build of Celeritas is rebuilt.
+ */
+std::uint64_t calc_build_hash()
+{
+    std::uint64_t result;
+    auto hash = make_fast_hasher(&result);
+    hash(std::size_t{construction_version});
+    for (char c : std::string_view{celeritas_version})
+    {
+        hash(static_cast<Byte>(c));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Hash the sizes of the stored types to detect incompatible builds.
+ */
+std::uint64_t calc_layout_hash()
+{
+    std::uint64_t result;
+    auto hash = make_fast_hasher(&result);
+    hash(sizeof(OrangeParamsScalars));
+
+    HostVal<OrangeParamsData> const empty;
+    for_each_collection(empty, [&hash](auto const& items) {
+        using ItemsT = std::remove_reference_t<decltype(items)>;
+        using T = typename ItemsT::value_type;
+        hash(sizeof(T));
+        hash(alignof(T));
+    });
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read-only memory map of an entire file.
+ */
+class MappedFile
+{
+  public:
+    // Map the file, or construct in a null state if it can't be opened
+    explicit MappedFile(std::string const& filename);
+
+    // Unmap on destruction
+    ~MappedFile();
+
+    //!@{
+    //! Prevent copying and moving
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+    //!@}
+
+    //! Whether the file was mapped
+    explicit operator bool() const { return data_ != nullptr; }
+
+    //! Access the mapped bytes
+    Span<Byte const> data() const
+    {
+        return {static_cast<Byte const*>(data_), size_};
+    }
+
+  private:
+    void* data_{nullptr};
+    std::size_t size_{0};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Map the file, or construct in a null state if it can't be opened.
+ */
+MappedFile::MappedFile(std::string const& filename)
+{
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && info.st_size > 0)
+    {
+        void* data = ::mmap(nullptr,
+                            static_cast<std::size_t>(info.st_size),
+                            PROT_READ,
+                            MAP_PRIVATE,
+                            fd,
+                            0);
+        if (data != MAP_FAILED)
+        {
+            data_ = data;
+            size_ = static_cast<std::size_t>(info.st_size);
+        }
+    }
+    // The mapping remains valid after the file is closed
+    ::close(fd);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Unmap on destruction.
+ */
+MappedFile::~MappedFile()
+{
+    if (data_)
+    {
+        ::munmap(data_, size_);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write trivially copyable data to a binary stream.
+ */
+class CacheWriter
+{
+  public:
+    // Construct with the output stream
+    explicit CacheWriter(std::ostream* os) : os_(*os) {}
+
+    //! Write a trivially copyable value
+    template<class T>
+    void raw(T const& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "cached value must be trivially copyable");
+        this->write(&value, sizeof(T));
+    }
+
+    //! Write an aligned collection
+    template<class T, Ownership W, MemSpace M, class I>
+    void operator()(Collection<T, W, M, I> const& items)
+    {
+        this->raw(static_cast<std::uint64_t>(items.size()));
+        this->pad();
+        auto all = items[AllItems<T, M>{}];
+        this->write(all.data(), all.size() * sizeof(T));
+    }
+
+    //! Write a vector of labels
+    void operator()(std::vector<Label> const& labels)
+    {
+        this->raw(static_cast<std::uint64_t>(labels.size()));
+        for (Label const& label : labels)
+        {
+            this->write_string(label.name);
+            this->write_string(label.ext);
+        }
+    }
+
+  private:
+    std::ostream& os_;
+    std::size_t offset_{0};
+
+    void write(void const* data, std::size_t size)
+    {
+        os_.write(static_cast<char const*>(data), size);
+        offset_ += size;
+    }
+
+    void write_string(std::string const& s)
+    {
+        this->raw(static_cast<std::uint64_t>(s.size()));
+        this->write(s.data(), s.size());
+    }
+
+    void pad()
+    {
+        for (; offset_ % cache_alignment != 0; ++offset_)
+        {
+            os_.put('\0');
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read data from a memory-mapped binary cache.
+ *
+ * Collection data are copied directly out of the mapped memory; an exception
+ * is raised if the file is truncated.
+ */
+class CacheReader
+{
+  public:
+    // Construct with the mapped data
+    explicit CacheReader(Span<Byte const> data) : data_(data) {}
+
+    //! Read a trivially copyable value
+    template<class T>
+    T raw()
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "cached value must be trivially copyable");
+        T result;
+        std::memcpy(
+            static_cast<void*>(&result), this->take(sizeof(T)), sizeof(T));
+        return result;
+    }
+
+    //! Read an aligned collection
+    template<class T, class I>
+    void operator()(Collection<T, Ownership::value, MemSpace::host, I>& items)
+    {
+        static_assert(alignof(T) <= cache_alignment,
+                      "collection is overaligned for the cache");
+        auto size = this->raw<std::uint64_t>();
+        this->skip_padding();
+        CELER_VALIDATE(size <= (data_.size() - offset_) / sizeof(T),
+                       << "ORANGE cache file is truncated");
+        auto const* first
+            = reinterpret_cast<T const*>(this->take(size * sizeof(T)));
+        make_builder(&items).insert_back(first, first + size);
+    }
+
+    //! Read a vector of labels
+    void operator()(std::vector<Label>* labels)
+    {
+        auto size = this->raw<std::uint64_t>();
+        labels->resize(size);
+        for (Label& label : *labels)
+        {
+            label.name = this->read_string();
+            label.ext = this->read_string();
+        }
+    }
+
+    //! Whether all data has been read
+    bool finished() const { return offset_ == data_.size(); }
+
+  private:
+    Span<Byte const> data_;
+    std::size_t offset_{0};
+
+    Byte const* take(std::size_t size)
+    {
+        CELER_VALIDATE(size <= data_.size() - offset_,
+                       << "ORANGE cache file is truncated");
+        Byte const* result = data_.data() + offset_;
+        offset_ += size;
+        return result;
+    }
+
+    std::string read_string()
+    {
+        auto size = this->raw<std::uint64_t>();
+        auto const* first = reinterpret_cast<char const*>(this->take(size));
+        return {first, first + size};
+    }
+
+    void skip_padding()
+    {
+        std::size_t padding = (cache_alignment - offset_ % cache_alignment)
+                              % cache_alignment;
+        this->take(padding);
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a hash of the contents of a file.
+ */
+std::uint64_t hash_file_contents(std::string const& filename)
+{
+    MappedFile file(filename);
+    CELER_VALIDATE(file, << "failed to open '" << filename << "' for hashing");
+
+    std::uint64_t result;
+    auto hash = make_fast_hasher(&result);
+    for (Byte b : file.data())
+    {
+        hash(b);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write flattened ORANGE data to a binary cache file.
+ *
+ * The file is written to a temporary path and then renamed so that
+ * concurrent jobs never read a partially written cache.
+ */
+void write_orange_cache(std::string const& filename,
+                        std::uint64_t source_hash,
+                        OrangeCacheData const& data)
+{
+    CELER_EXPECT(data.data);
+
+    std::string const temp_filename
+        = filename + ".tmp" + std::to_string(::getpid());
+    {
+        std::ofstream os(temp_filename, std::ios::binary);
+        CELER_VALIDATE(os,
+                       << "failed to open ORANGE cache file at '"
+                       << temp_filename << "' for writing");
+
+        CacheHeader header;
+        std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+        header.version = cache_version;
+        header.real_size = sizeof(real_type);
+        header.build_hash = calc_build_hash();
+        header.layout_hash = calc_layout_hash();
+        header.source_hash = source_hash;
+
+        CacheWriter write(&os);
+        write.raw(header);
+        write.raw(data.data.scalars);
+        for_each_collection(data.data, write);
+        write(data.surface_labels);
+        write(data.volume_labels);
+        write.raw(data.bbox.lower());
+        write.raw(data.bbox.upper());
+        write.raw(static_cast<std::uint8_t>(data.supports_safety));
+
+        CELER_VALIDATE(os,
+                       << "failed to write ORANGE cache file at '"
+                       << temp_filename << "'");
+    }
+
+    bool moved = (std::rename(temp_filename.c_str(), filename.c_str()) == 0);
+    if (!moved)
+    {
+        std::remove(temp_filename.c_str());
+    }
+    CELER_VALIDATE(moved,
+                   << "failed to move ORANGE cache file to '" << filename
+                   << "'");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load flattened ORANGE data if the cache is present and up to date.
+ *
+ * The cache is stale if it was written from a different source file (as
+ * determined by its content hash), by a different version of Celeritas, or by
+ * an incompatible build. A missing or stale cache results in a \c false
+ * return value, and a corrupt cache raises an exception.
+ */
+bool read_orange_cache(std::string const& filename,
+                       std::uint64_t source_hash,
+                       OrangeCacheData* result)
+{
+    CELER_EXPECT(result);
+
+    MappedFile file(filename);
+    if (!file)
+    {
+        return false;
+    }
+
+    CacheReader read(file.data());
+    auto header = read.raw<CacheHeader>();
+    CELER_VALIDATE(
+        std::memcmp(header.magic, cache_magic, sizeof(cache_magic)) == 0,
+        << "'" << filename << "' is not an ORANGE cache file");
+    if (header.version != cache_version
+        || header.real_size != sizeof(real_type)
+        || header.build_hash != calc_build_hash()
+        || header.layout_hash != calc_layout_hash()
+        || header.source_hash != source_hash)
+    {
+        return false;
+    }
+
+    OrangeCacheData temp;
+    temp.data.scalars = read.raw<OrangeParamsScalars>();
+    for_each_collection(temp.data, read);
+    read(&temp.surface_labels);
+    read(&temp.volume_labels);
+    auto lower = read.raw<Real3>();
+    auto upper = read.raw<Real3>();
+    temp.bbox = {lower, upper};
+    temp.supports_safety = read.raw<std::uint8_t>();
+
+    CELER_VALIDATE(read.finished() && temp.data,
+                   << "ORANGE cache file at '" << filename
+                   << "' is inconsistent");
+    *result = std::move(temp);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
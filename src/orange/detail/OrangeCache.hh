@@ -0,0 +1,54 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/OrangeCache.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "corecel/cont/Label.hh"
+#include "orange/BoundingBox.hh"
+#include "orange/OrangeData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Flattened host data and metadata used to construct \c OrangeParams.
+ *
+ * This is the output of building the geometry from an \c OrangeInput and the
+ * content of a binary cache file.
+ */
+struct OrangeCacheData
+{
+    HostVal<OrangeParamsData> data;
+    std::vector<Label> surface_labels;
+    std::vector<Label> volume_labels;
+    BoundingBox bbox;
+    bool supports_safety{false};
+};
+
+//---------------------------------------------------------------------------//
+// Calculate a hash of the contents of a file
+std::uint64_t hash_file_contents(std::string const& filename);
+
+// Write flattened ORANGE data to a binary cache file
+void write_orange_cache(std::string const& filename,
+                        std::uint64_t source_hash,
+                        OrangeCacheData const& data);
+
+// Load flattened ORANGE data if the cache is present and up to date
+bool read_orange_cache(std::string const& filename,
+                       std::uint64_t source_hash,
+                       OrangeCacheData* data);
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -8,6 +8,7 @@
 #include "UnitInserter.hh"
 
 #include <algorithm>
+#include <cmath>
 #include <set>
 #include <vector>
 
@@ -20,11 +21,15 @@
 #include "corecel/data/CollectionBuilder.hh"
 #include "corecel/data/Ref.hh"
 #include "corecel/math/Algorithms.hh"
+#include "corecel/math/ArrayUtils.hh"
 #include "orange/construct/OrangeInput.hh"
 #include "orange/surf/SurfaceAction.hh"
 #include "orange/surf/Surfaces.hh"
 #include "orange/surf/detail/SurfaceAction.hh"
 
+#include "BvhBuilder.hh"
+#include "VolumeBboxCalculator.hh"
+
 namespace celeritas
 {
 namespace detail
@@ -34,6 +39,9 @@ namespace
 //---------------------------------------------------------------------------//
 constexpr int invalid_max_depth = -1;
 
+//! Minimum mean number of faces per surface type to intersect in batches
+constexpr std::size_t min_batch_faces = 4;
+
 //---------------------------------------------------------------------------//
 /*!
  * Calculate the maximum logic depth of a volume definition.
@@ -187,6 +195,9 @@ SimpleUnitId UnitInserter::operator()(UnitInput const& inp)
         make_builder(&orange_data_->volume_records)
             .insert_back(vol_records.begin(), vol_records.end()));
 
+    // Build the acceleration structure for initialization
+    unit.bvh = this->build_bvh(unit.surfaces, inp, vol_records);
+
     // Save connectivity
     {
         std::vector<Connectivity> conn(connectivity.size());
@@ -333,6 +344,12 @@ VolumeRecord UnitInserter::insert_volume(SurfacesRecord const& surf_record,
     {
         output.flags |= VolumeRecord::Flags::simple_safety;
     }
+    if (!(output.flags
+          & (VolumeRecord::internal_surfaces | VolumeRecord::implicit_vol)))
+    {
+        // Group faces by type for faster host intersection
+        output.batches = this->insert_batches(surf_record, v.faces);
+    }
 
     // Calculate the maximum stack depth of the volume definition
     int max_depth = calc_max_depth(input_logic);
@@ -349,6 +366,127 @@ VolumeRecord UnitInserter::insert_volume(SurfacesRecord const& surf_record,
     return output;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Group the faces of a volume by surface type.
+ *
+ * The surface coefficients of each group are copied into a structure of
+ * arrays so that the host can calculate intersections for many faces of the
+ * same type in a single loop. Volumes with only a few faces of each type are
+ * faster to intersect one face at a time, so they have no batches.
+ */
+ItemRange<SurfaceBatchRecord>
+UnitInserter::insert_batches(SurfacesRecord const& surf_record,
+                             std::vector<LocalSurfaceId> const& faces)
+{
+    using RealId = SurfacesRecord::RealId;
+
+    auto params_cref = make_const_ref(*orange_data_);
+    Surfaces surfaces{params_cref, surf_record};
+
+    // Group faces by type, preserving their order
+    std::vector<std::vector<FaceId>> type_faces(
+        static_cast<std::size_t>(SurfaceType::size_));
+    for (auto i : range(faces.size()))
+    {
+        auto st = surfaces.surface_type(faces[i]);
+        type_faces[static_cast<std::size_t>(st)].push_back(FaceId(i));
+    }
+    auto num_types = static_cast<std::size_t>(std::count_if(
+        type_faces.begin(), type_faces.end(), [](auto const& tf) {
+            return !tf.empty();
+        }));
+    if (faces.size() < min_batch_faces * num_types)
+    {
+        return {};
+    }
+
+    auto get_data_size = make_static_surface_action<SurfaceDataSize>();
+    auto batch_faces = make_builder(&orange_data_->batch_faces);
+    auto batch_reals = make_builder(&orange_data_->batch_reals);
+
+    std::vector<SurfaceBatchRecord> batches;
+    std::vector<real_type> data;
+    for (auto t : range(type_faces.size()))
+    {
+        std::vector<FaceId> const& batch_face_ids = type_faces[t];
+        if (batch_face_ids.empty())
+        {
+            continue;
+        }
+
+        SurfaceBatchRecord batch;
+        batch.type = static_cast<SurfaceType>(t);
+
+        // Transpose surface data into a structure of arrays
+        size_type const num_faces = batch_face_ids.size();
+        size_type const extent = get_data_size(batch.type);
+        data.assign(extent * num_faces, 0);
+        for (auto i : range(num_faces))
+        {
+            LocalSurfaceId sid = faces[batch_face_ids[i].unchecked_get()];
+            auto offset_id = surf_record.data_offsets[sid.unchecked_get()];
+            RealId start = orange_data_->real_ids[offset_id];
+            for (auto j : range(extent))
+            {
+                data[j * num_faces + i] = orange_data_->reals[start + j];
+            }
+        }
+
+        batch.faces = batch_faces.insert_back(batch_face_ids.begin(),
+                                              batch_face_ids.end());
+        batch.data = batch_reals.insert_back(data.begin(), data.end());
+        CELER_ASSERT(batch);
+        batches.push_back(batch);
+    }
+
+    return make_builder(&orange_data_->surface_batches)
+        .insert_back(batches.begin(), batches.end());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build a bounding volume hierarchy over the explicit volumes.
+ *
+ * Bounding boxes are taken from the input if present and otherwise
+ * calculated from the volume logic.
+ */
+ItemRange<BvhNode>
+UnitInserter::build_bvh(SurfacesRecord const& surf_record,
+                        UnitInput const& inp,
+                        std::vector<VolumeRecord> const& vol_records)
+{
+    CELER_EXPECT(vol_records.size() == inp.volumes.size());
+
+    auto params_cref = make_const_ref(*orange_data_);
+    Surfaces surfaces{params_cref, surf_record};
+    VolumeBboxCalculator calc_bbox{surfaces,
+                                   orange_data_->scalars.bump_rel,
+                                   orange_data_->scalars.bump_abs};
+
+    std::vector<BoundingBox> bboxes(inp.volumes.size());
+    for (auto i : range(inp.volumes.size()))
+    {
+        VolumeInput const& v = inp.volumes[i];
+        if (vol_records[i].flags & VolumeRecord::implicit_vol)
+        {
+            // Implicit volumes are never found by initialization
+            continue;
+        }
+        if (v.bbox)
+        {
+            bboxes[i] = v.bbox;
+        }
+        else
+        {
+            bboxes[i] = calc_bbox(make_span(v.faces),
+                                  params_cref.logic_ints[vol_records[i].logic]);
+        }
+    }
+
+    return BvhBuilder{orange_data_}(bboxes);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Process a single daughter universe.
@@ -360,6 +498,25 @@ void UnitInserter::process_daughter(VolumeRecord* vol_record,
     daughter.universe_id = daughter_input.universe_id;
     daughter.translation_id = make_builder(&orange_data_->translations)
                                   .push_back(daughter_input.translation);
+    if (daughter_input.rotation != UnitInput::Daughter{}.rotation)
+    {
+        // Only store non-identity rotations
+        Rotation const& r = daughter_input.rotation;
+        for (auto i : range(3))
+        {
+            for (auto j : range(3))
+            {
+                real_type expected = (i == j ? 1 : 0);
+                real_type actual = dot_product(r[i], r[j]);
+                CELER_VALIDATE(std::fabs(actual - expected) < 1e-6,
+                               << "rotation of daughter universe "
+                               << daughter.universe_id.get()
+                               << " is not orthonormal");
+            }
+        }
+        daughter.rotation_id = make_builder(&orange_data_->rotations)
+                                   .push_back(daughter_input.rotation);
+    }
 
     vol_record->daughter_id
         = make_builder(&orange_data_->daughters).push_back(daughter);
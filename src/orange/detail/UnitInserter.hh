@@ -49,6 +49,14 @@ class UnitInserter
     SurfacesRecord insert_surfaces(SurfaceInput const& s);
     VolumeRecord
     insert_volume(SurfacesRecord const& unit, VolumeInput const& v);
+    ItemRange<SurfaceBatchRecord>
+    insert_batches(SurfacesRecord const& surf_record,
+                   std::vector<LocalSurfaceId> const& faces);
+
+    ItemRange<BvhNode>
+    build_bvh(SurfacesRecord const& surf_record,
+              UnitInput const& inp,
+              std::vector<VolumeRecord> const& vol_records);
 
     void process_daughter(VolumeRecord* vol_record,
                           UnitInput::Daughter const& daughter_input);
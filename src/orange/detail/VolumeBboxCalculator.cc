@@ -0,0 +1,259 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/VolumeBboxCalculator.cc
+//---------------------------------------------------------------------------//
+#include "VolumeBboxCalculator.hh"
+
+#include <cmath>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/NumericLimits.hh"
+#include "orange/surf/SurfaceAction.hh"
+#include "orange/surf/Surfaces.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+constexpr real_type inf = numeric_limits<real_type>::infinity();
+
+//---------------------------------------------------------------------------//
+/*!
+ * Axis-aligned extents that, unlike BoundingBox, may be empty.
+ */
+struct Extents
+{
+    Real3 lower{-inf, -inf, -inf};
+    Real3 upper{inf, inf, inf};
+
+    //! Create extents with no volume
+    static Extents empty()
+    {
+        return {{inf, inf, inf}, {-inf, -inf, -inf}};
+    }
+
+    //! Whether no point is inside
+    bool is_empty() const
+    {
+        return !(lower[0] <= upper[0] && lower[1] <= upper[1]
+                 && lower[2] <= upper[2]);
+    }
+};
+
+//---------------------------------------------------------------------------//
+Extents calc_intersection(Extents const& a, Extents const& b)
+{
+    Extents result;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        result.lower[ax] = celeritas::max(a.lower[ax], b.lower[ax]);
+        result.upper[ax] = celeritas::min(a.upper[ax], b.upper[ax]);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+Extents calc_union(Extents const& a, Extents const& b)
+{
+    if (a.is_empty())
+    {
+        return b;
+    }
+    if (b.is_empty())
+    {
+        return a;
+    }
+    Extents result;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        result.lower[ax] = celeritas::min(a.lower[ax], b.lower[ax]);
+        result.upper[ax] = celeritas::max(a.upper[ax], b.upper[ax]);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Bounds of the regions where a logical expression is true and false.
+ */
+struct Zone
+{
+    Extents pos;  //!< Where the expression is true ("outside")
+    Extents neg;  //!< Where the expression is false ("inside")
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the bounds of the two half-spaces of a surface.
+ */
+struct SurfaceZoneGetter
+{
+    //! By default, neither side of a surface is bounded
+    template<class S>
+    Zone operator()(S const&) const
+    {
+        return {};
+    }
+
+    //! Planes bound one coordinate on each side
+    template<Axis T>
+    Zone operator()(PlaneAligned<T> const& s) const
+    {
+        Zone result;
+        auto ax = static_cast<int>(T);
+        result.pos.lower[ax] = s.position();
+        result.neg.upper[ax] = s.position();
+        return result;
+    }
+
+    //! The inside of a cylinder is bounded perpendicular to its axis
+    template<Axis T>
+    Zone operator()(CylCentered<T> const& s) const
+    {
+        Zone result;
+        real_type radius = std::sqrt(s.radius_sq());
+        for (int ax : {static_cast<int>(T) == 0 ? 1 : 0,
+                        static_cast<int>(T) == 2 ? 1 : 2})
+        {
+            result.neg.lower[ax] = -radius;
+            result.neg.upper[ax] = radius;
+        }
+        return result;
+    }
+
+    //! The inside of an off-axis cylinder is bounded around its axis
+    template<Axis T>
+    Zone operator()(CylAligned<T> const& s) const
+    {
+        Zone result;
+        real_type radius = std::sqrt(s.radius_sq());
+        int u = static_cast<int>(T) == 0 ? 1 : 0;
+        int v = static_cast<int>(T) == 2 ? 1 : 2;
+        result.neg.lower[u] = s.origin_u() - radius;
+        result.neg.upper[u] = s.origin_u() + radius;
+        result.neg.lower[v] = s.origin_v() - radius;
+        result.neg.upper[v] = s.origin_v() + radius;
+        return result;
+    }
+
+    //! The inside of a sphere is bounded
+    Zone operator()(SphereCentered const& s) const
+    {
+        return this->sphere_zone({0, 0, 0}, s.radius_sq());
+    }
+
+    //! The inside of a sphere is bounded
+    Zone operator()(Sphere const& s) const
+    {
+        return this->sphere_zone(s.origin(), s.radius_sq());
+    }
+
+    Zone sphere_zone(Real3 const& origin, real_type radius_sq) const
+    {
+        Zone result;
+        real_type radius = std::sqrt(radius_sq);
+        for (int ax = 0; ax < 3; ++ax)
+        {
+            result.neg.lower[ax] = origin[ax] - radius;
+            result.neg.upper[ax] = origin[ax] + radius;
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with unit surfaces and tolerances.
+ */
+VolumeBboxCalculator::VolumeBboxCalculator(Surfaces const& surfaces,
+                                           real_type bump_rel,
+                                           real_type bump_abs)
+    : surfaces_(surfaces), bump_rel_(bump_rel), bump_abs_(bump_abs)
+{
+    CELER_EXPECT(bump_rel_ >= 0 && bump_abs_ >= 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the bounding box of a volume.
+ */
+BoundingBox VolumeBboxCalculator::operator()(SpanConstSurface faces,
+                                             SpanConstLogic logic) const
+{
+    CELER_EXPECT(!logic.empty());
+
+    auto get_zone = make_surface_action(surfaces_, SurfaceZoneGetter{});
+
+    std::vector<Zone> stack;
+    for (logic_int lgc : logic)
+    {
+        if (!logic::is_operator_token(lgc))
+        {
+            CELER_ASSERT(lgc < faces.size());
+            stack.push_back(get_zone(faces[lgc]));
+            continue;
+        }
+        if (lgc == logic::ltrue)
+        {
+            stack.push_back({Extents{}, Extents::empty()});
+            continue;
+        }
+
+        CELER_ASSERT(!stack.empty());
+        Zone b = stack.back();
+        if (lgc == logic::lnot)
+        {
+            std::swap(b.pos, b.neg);
+            stack.back() = b;
+            continue;
+        }
+
+        stack.pop_back();
+        CELER_ASSERT(!stack.empty());
+        Zone& a = stack.back();
+        if (lgc == logic::land)
+        {
+            a = {calc_intersection(a.pos, b.pos), calc_union(a.neg, b.neg)};
+        }
+        else if (lgc == logic::lor)
+        {
+            a = {calc_union(a.pos, b.pos), calc_intersection(a.neg, b.neg)};
+        }
+        else
+        {
+            CELER_ASSERT_UNREACHABLE();
+        }
+    }
+    CELER_ASSERT(stack.size() == 1);
+
+    Extents const& ext = stack.front().pos;
+    if (ext.is_empty())
+    {
+        return {};
+    }
+
+    // Expand finite extents to account for roundoff
+    Real3 lower = ext.lower;
+    Real3 upper = ext.upper;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        lower[ax] -= celeritas::max(bump_abs_, bump_rel_ * std::fabs(lower[ax]));
+        upper[ax] += celeritas::max(bump_abs_, bump_rel_ * std::fabs(upper[ax]));
+    }
+    return {lower, upper};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,63 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/VolumeBboxCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/cont/Span.hh"
+#include "orange/BoundingBox.hh"
+#include "orange/OrangeTypes.hh"
+#include "orange/surf/Surfaces.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a conservative bounding box for a volume from its logic.
+ *
+ * Each surface in the RPN logic expression is replaced by a pair of boxes
+ * bounding the "outside" (true) and "inside" (false) half-spaces of the
+ * surface. Negation swaps the pair; conjunction intersects the "true" boxes
+ * and unites the "false" boxes; and disjunction does the opposite. Surfaces
+ * whose half-spaces cannot be bounded simply (e.g. general quadrics) have
+ * infinite extents on both sides, so the result is always a superset of the
+ * volume.
+ *
+ * The result is an unassigned bounding box if the volume is provably empty
+ * (e.g. the "nowhere" logic of background volumes). Finite extents are
+ * expanded slightly so that points on a volume's surface are inside its
+ * bounding box despite roundoff.
+ */
+class VolumeBboxCalculator
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SpanConstSurface = Span<LocalSurfaceId const>;
+    using SpanConstLogic = Span<logic_int const>;
+    //!@}
+
+  public:
+    // Construct with unit surfaces and tolerances
+    VolumeBboxCalculator(Surfaces const& surfaces,
+                         real_type bump_rel,
+                         real_type bump_abs);
+
+    // Calculate the bounding box of a volume
+    BoundingBox
+    operator()(SpanConstSurface faces, SpanConstLogic logic) const;
+
+  private:
+    Surfaces const& surfaces_;
+    real_type bump_rel_;
+    real_type bump_abs_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
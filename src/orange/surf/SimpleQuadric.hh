@@ -0,0 +1,196 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/surf/SimpleQuadric.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "orange/OrangeTypes.hh"
+
+#include "detail/QuadraticSolver.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * General quadric expression but with no off-axis terms.
+ *
+ * Stored:
+ * \f[
+   ax^2 + by^2 + cz^2 + dx + ey + fz + g = 0
+  \f]
+ *
+ * This can be used for axis-aligned ellipsoids, elliptical cylinders,
+ * hyperboloids and paraboloids.
+ */
+class SimpleQuadric
+{
+  public:
+    //@{
+    //! Type aliases
+    using Intersections = Array<real_type, 2>;
+    using Storage = Span<const real_type, 7>;
+    using SpanConstReal3 = Span<const real_type, 3>;
+    //@}
+
+    //// CLASS ATTRIBUTES ////
+
+    //! Surface type identifier
+    static CELER_CONSTEXPR_FUNCTION SurfaceType surface_type()
+    {
+        return SurfaceType::sq;
+    }
+
+    //! Safety is *not* the nearest intersection along the surface "normal"
+    static CELER_CONSTEXPR_FUNCTION bool simple_safety() { return false; }
+
+  public:
+    //// CONSTRUCTORS ////
+
+    // Construct with coefficients
+    inline CELER_FUNCTION SimpleQuadric(Real3 const& abc,
+                                        Real3 const& def,
+                                        real_type g);
+
+    // Construct from raw data
+    explicit inline CELER_FUNCTION SimpleQuadric(Storage);
+
+    //// ACCESSORS ////
+
+    //! Second-order terms
+    CELER_FUNCTION SpanConstReal3 second() const { return {&a_, 3}; }
+
+    //! First-order terms
+    CELER_FUNCTION SpanConstReal3 first() const { return {&d_, 3}; }
+
+    //! Zeroth-order term
+    CELER_FUNCTION real_type zeroth() const { return g_; }
+
+    //! Get a view to the data for type-deleted storage
+    CELER_FUNCTION Storage data() const { return {&a_, 7}; }
+
+    //// CALCULATION ////
+
+    // Determine the sense of the position relative to this surface
+    inline CELER_FUNCTION SignedSense calc_sense(Real3 const& pos) const;
+
+    // Calculate all possible straight-line intersections with this surface
+    inline CELER_FUNCTION Intersections calc_intersections(
+        Real3 const& pos, Real3 const& dir, SurfaceState on_surface) const;
+
+    // Calculate outward normal at a position
+    inline CELER_FUNCTION Real3 calc_normal(Real3 const& pos) const;
+
+  private:
+    // Second-order terms (a, b, c)
+    real_type a_, b_, c_;
+    // First-order terms (d, e, f)
+    real_type d_, e_, f_;
+    // Constant term
+    real_type g_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with all coefficients.
+ */
+CELER_FUNCTION SimpleQuadric::SimpleQuadric(Real3 const& abc,
+                                            Real3 const& def,
+                                            real_type g)
+    : a_(abc[0])
+    , b_(abc[1])
+    , c_(abc[2])
+    , d_(def[0])
+    , e_(def[1])
+    , f_(def[2])
+    , g_(g)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from raw data.
+ */
+CELER_FUNCTION SimpleQuadric::SimpleQuadric(Storage data)
+    : a_(data[0])
+    , b_(data[1])
+    , c_(data[2])
+    , d_(data[3])
+    , e_(data[4])
+    , f_(data[5])
+    , g_(data[6])
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Determine the sense of the position relative to this surface.
+ */
+CELER_FUNCTION SignedSense SimpleQuadric::calc_sense(Real3 const& pos) const
+{
+    const real_type x = pos[0];
+    const real_type y = pos[1];
+    const real_type z = pos[2];
+
+    real_type result = (a_ * x + d_) * x + (b_ * y + e_) * y
+                       + (c_ * z + f_) * z + g_;
+
+    return real_to_sense(result);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate all possible straight-line intersections with this surface.
+ */
+CELER_FUNCTION auto
+SimpleQuadric::calc_intersections(Real3 const& pos,
+                                  Real3 const& dir,
+                                  SurfaceState on_surface) const
+    -> Intersections
+{
+    const real_type x = pos[0];
+    const real_type y = pos[1];
+    const real_type z = pos[2];
+    const real_type u = dir[0];
+    const real_type v = dir[1];
+    const real_type w = dir[2];
+
+    // Quadratic values
+    real_type a = (a_ * u) * u + (b_ * v) * v + (c_ * w) * w;
+    real_type b = (2 * a_ * x + d_) * u + (2 * b_ * y + e_) * v
+                  + (2 * c_ * z + f_) * w;
+    real_type c = (a_ * x + d_) * x + (b_ * y + e_) * y + (c_ * z + f_) * z
+                  + g_;
+
+    return detail::QuadraticSolver::solve_general(a, b / 2, c, on_surface);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate outward normal at a position.
+ */
+CELER_FUNCTION Real3 SimpleQuadric::calc_normal(Real3 const& pos) const
+{
+    const real_type x = pos[0];
+    const real_type y = pos[1];
+    const real_type z = pos[2];
+
+    Real3 norm;
+    norm[0] = 2 * a_ * x + d_;
+    norm[1] = 2 * b_ * y + e_;
+    norm[2] = 2 * c_ * z + f_;
+
+    normalize_direction(&norm);
+    return norm;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
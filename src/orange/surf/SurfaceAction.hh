@@ -29,6 +29,20 @@ make_surface_action(Surfaces const& surfaces, F&& action)
     return detail::SurfaceAction<F>{surfaces, ::celeritas::forward<F>(action)};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Helper function for creating a SurfaceTypeAction instance.
+ *
+ * The function argument must have an \c operator() that takes a
+ * \c detail::SurfaceTypeTag of any surface class.
+ */
+template<class F>
+inline CELER_FUNCTION detail::SurfaceTypeAction<F>
+make_surface_type_action(F&& action)
+{
+    return detail::SurfaceTypeAction<F>{::celeritas::forward<F>(action)};
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Helper function for creating a StaticSurfaceAction instance.
@@ -13,9 +13,13 @@
 #include "corecel/cont/Span.hh"
 #include "corecel/cont/SpanIO.hh"
 
+#include "ConeAligned.hh"
+#include "CylAligned.hh"
 #include "CylCentered.hh"
 #include "GeneralQuadric.hh"
+#include "Plane.hh"
 #include "PlaneAligned.hh"
+#include "SimpleQuadric.hh"
 #include "Sphere.hh"
 #include "SphereCentered.hh"
 
@@ -26,6 +30,28 @@ namespace celeritas
     template std::ostream& operator<<(std::ostream&, const SHAPE<Axis::y>&); \
     template std::ostream& operator<<(std::ostream&, const SHAPE<Axis::z>&)
 
+//---------------------------------------------------------------------------//
+template<Axis T>
+std::ostream& operator<<(std::ostream& os, ConeAligned<T> const& s)
+{
+    os << "Cone " << to_char(T) << ": t=" << std::sqrt(s.tangent_sq())
+       << " at " << make_span(s.origin());
+    return os;
+}
+
+ORANGE_INSTANTIATE_SHAPE_STREAM(ConeAligned);
+//---------------------------------------------------------------------------//
+template<Axis T>
+std::ostream& operator<<(std::ostream& os, CylAligned<T> const& s)
+{
+    os << "Cyl " << to_char(T) << ": r=" << std::sqrt(s.radius_sq()) << " at "
+       << to_char(T == Axis::x ? Axis::y : Axis::x) << '=' << s.origin_u()
+       << ", " << to_char(T == Axis::z ? Axis::y : Axis::z) << '='
+       << s.origin_v();
+    return os;
+}
+
+ORANGE_INSTANTIATE_SHAPE_STREAM(CylAligned);
 //---------------------------------------------------------------------------//
 template<Axis T>
 std::ostream& operator<<(std::ostream& os, CylCentered<T> const& s)
@@ -44,6 +70,13 @@ std::ostream& operator<<(std::ostream& os, GeneralQuadric const& s)
     return os;
 }
 
+//---------------------------------------------------------------------------//
+std::ostream& operator<<(std::ostream& os, Plane const& s)
+{
+    os << "Plane: n=" << make_span(s.normal()) << ", d=" << s.displacement();
+    return os;
+}
+
 //---------------------------------------------------------------------------//
 template<Axis T>
 std::ostream& operator<<(std::ostream& os, PlaneAligned<T> const& s)
@@ -53,6 +86,13 @@ std::ostream& operator<<(std::ostream& os, PlaneAligned<T> const& s)
 }
 
 ORANGE_INSTANTIATE_SHAPE_STREAM(PlaneAligned);
+//---------------------------------------------------------------------------//
+std::ostream& operator<<(std::ostream& os, SimpleQuadric const& s)
+{
+    os << "SQuadric: " << s.second() << ' ' << s.first() << ' ' << s.zeroth();
+    return os;
+}
+
 //---------------------------------------------------------------------------//
 std::ostream& operator<<(std::ostream& os, Sphere const& s)
 {
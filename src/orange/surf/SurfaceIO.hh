@@ -18,14 +18,24 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 //!@{
 //! Print surfaces to a stream.
+template<Axis T>
+std::ostream& operator<<(std::ostream&, ConeAligned<T> const&);
+
+template<Axis T>
+std::ostream& operator<<(std::ostream&, CylAligned<T> const&);
+
 template<Axis T>
 std::ostream& operator<<(std::ostream&, CylCentered<T> const&);
 
 std::ostream& operator<<(std::ostream&, GeneralQuadric const&);
 
+std::ostream& operator<<(std::ostream&, Plane const&);
+
 template<Axis T>
 std::ostream& operator<<(std::ostream&, PlaneAligned<T> const&);
 
+std::ostream& operator<<(std::ostream&, SimpleQuadric const&);
+
 std::ostream& operator<<(std::ostream&, Sphere const&);
 
 std::ostream& operator<<(std::ostream&, SphereCentered const&);
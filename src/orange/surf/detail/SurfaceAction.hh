@@ -13,9 +13,13 @@
 #include "corecel/math/Algorithms.hh"
 #include "orange/OrangeTypes.hh"
 
+#include "../ConeAligned.hh"
+#include "../CylAligned.hh"
 #include "../CylCentered.hh"
 #include "../GeneralQuadric.hh"
+#include "../Plane.hh"
 #include "../PlaneAligned.hh"
+#include "../SimpleQuadric.hh"
 #include "../Sphere.hh"
 #include "../SphereCentered.hh"
 #include "../SurfaceTypeTraits.hh"
@@ -70,6 +74,41 @@ struct StaticSurfaceAction
     inline CELER_FUNCTION decltype(auto) operator()(SurfaceType type) const;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Empty argument used to pass a surface class to a type action.
+ */
+template<class S>
+struct SurfaceTypeTag
+{
+    using type = S;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Helper class for applying an action functor to a surface type.
+ *
+ * The function-like instance of \c F must accept a \c SurfaceTypeTag of any
+ * surface class. This is useful for operating on many surfaces of the same
+ * type with a single dispatch.
+ */
+template<class F>
+class SurfaceTypeAction
+{
+  public:
+    // Construct from action
+    explicit inline CELER_FUNCTION SurfaceTypeAction(F&& action);
+
+    // Apply to the given surface type
+    inline CELER_FUNCTION decltype(auto) operator()(SurfaceType type);
+
+    //! Access the resulting action
+    CELER_FUNCTION F const& action() const { return action_; }
+
+  private:
+    F action_;
+};
+
 //---------------------------------------------------------------------------//
 // PRIVATE MACRO DEFINITIONS
 //---------------------------------------------------------------------------//
@@ -101,15 +140,15 @@ struct StaticSurfaceAction
             ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cyc);      \
             ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, czc);      \
             ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, sc);       \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cx); */ \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cy); */ \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cz); */ \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, p);  */ \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cx);       \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cy);       \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cz);       \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, p);        \
             ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, s);        \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, kx); */ \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, ky); */ \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, kz); */ \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, sq); */ \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, kx);       \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, ky);       \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, kz);       \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, sq);       \
             ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, gq);       \
             case SurfaceType::size_:                        \
                 CELER_ASSERT_UNREACHABLE();                 \
@@ -146,6 +185,32 @@ CELER_FUNCTION auto SurfaceAction<F>::operator()(LocalSurfaceId id)
     CELER_ASSERT_UNREACHABLE();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with action to apply.
+ */
+template<class F>
+CELER_FUNCTION SurfaceTypeAction<F>::SurfaceTypeAction(F&& action)
+    : action_(::celeritas::forward<F>(action))
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply to the given surface type.
+ */
+template<class F>
+CELER_FUNCTION auto SurfaceTypeAction<F>::operator()(SurfaceType type)
+    -> decltype(auto)
+{
+#define ORANGE_STA_APPLY_IMPL(SURFACE) \
+    return action_(SurfaceTypeTag<SURFACE>{});
+
+    ORANGE_SURF_DISPATCH_IMPL(ORANGE_STA_APPLY_IMPL, type);
+#undef ORANGE_STA_APPLY_IMPL
+    CELER_ASSERT_UNREACHABLE();
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Apply to the surface specified by the given surface ID.
@@ -11,7 +11,9 @@
 
 #include "corecel/Assert.hh"
 #include "corecel/math/Algorithms.hh"
+#include "orange/BoundingBoxUtils.hh"
 #include "orange/OrangeData.hh"
+#include "orange/surf/SurfaceAction.hh"
 #include "orange/surf/Surfaces.hh"
 
 #include "detail/LogicEvaluator.hh"
@@ -70,6 +72,9 @@ class SimpleUnitTracker
     // DaughterId of universe embedded in a given volume
     inline CELER_FUNCTION DaughterId daughter(LocalVolumeId vol) const;
 
+    // Whether an unbounded intersection costs the same as a bounded one
+    inline CELER_FUNCTION bool exact_intersect_is_cheap(LocalVolumeId) const;
+
     //// OPERATIONS ////
 
     // Find the local volume from a position
@@ -116,8 +121,18 @@ class SimpleUnitTracker
     inline CELER_FUNCTION Intersection complex_intersect(LocalState const&,
                                                          VolumeView const&,
                                                          size_type) const;
+    template<class F>
+    inline CELER_FUNCTION Intersection batch_intersect(LocalState const&,
+                                                       VolumeView const&,
+                                                       F) const;
+    template<class F>
     inline CELER_FUNCTION Intersection background_intersect(LocalState const&,
-                                                            size_type) const;
+                                                            F) const;
+    template<class F>
+    inline CELER_FUNCTION Intersection enter_intersect(LocalState const&,
+                                                       LocalVolumeId,
+                                                       F const&,
+                                                       real_type) const;
 
     // Create a Surfaces object from the params
     inline CELER_FUNCTION Surfaces make_local_surfaces() const;
@@ -149,6 +164,11 @@ SimpleUnitTracker::SimpleUnitTracker(ParamsRef const& params, SimpleUnitId suid)
  *
  * To avoid edge cases and inconsistent logical/physical states, it is
  * prohibited to initialize from an arbitrary point directly onto a surface.
+ *
+ * Only the volumes in leaves of the bounding volume hierarchy whose bounding
+ * boxes contain the point are tested. The hierarchy is traversed without a
+ * stack by following each node's escape index when its bounding box is
+ * missed or its leaf volumes have been tested.
  */
 CELER_FUNCTION auto
 SimpleUnitTracker::initialize(LocalState const& state) const -> Initialization
@@ -159,31 +179,50 @@ SimpleUnitTracker::initialize(LocalState const& state) const -> Initialization
     detail::SenseCalculator calc_senses(
         this->make_local_surfaces(), state.pos, state.temp_sense);
 
-    // Loop over all volumes (TODO: use BVH)
-    for (LocalVolumeId volid : range(LocalVolumeId{this->num_volumes()}))
+    size_type node_idx = 0;
+    while (node_idx < unit_record_.bvh.size())
     {
-        VolumeView vol = this->make_local_volume(volid);
-
-        // Calculate the local senses, and see if we're inside.
-        auto logic_state = calc_senses(vol);
-
-        // Evalulate whether the senses are "inside" the volume
-        if (!detail::LogicEvaluator(vol.logic())(logic_state.senses))
+        BvhNode const& node = params_.bvh_nodes[unit_record_.bvh[node_idx]];
+        if (!is_inside(node.bbox, state.pos))
         {
-            // State is *not* inside this volume: try the next one
+            // Skip this subtree
+            node_idx = node.escape;
             continue;
         }
-        if (logic_state.face)
+        if (node.volumes.empty())
         {
-            // Initialized on a boundary in this volume but wasn't known
-            // to be crossing a surface. Fail safe by letting the multi-level
-            // tracking geometry (NOT YET IMPLEMENTED in GPU ORANGE) bump and
-            // try again.
-            break;
+            // Descend into the first child
+            ++node_idx;
+            continue;
         }
 
-        // Found and not unexpectedly on a surface!
-        return {volid, {}};
+        // Loop over candidate volumes in this leaf
+        for (LocalVolumeId volid : params_.local_volume_ids[node.volumes])
+        {
+            VolumeView vol = this->make_local_volume(volid);
+
+            // Calculate the local senses, and see if we're inside.
+            auto logic_state = calc_senses(vol);
+
+            // Evalulate whether the senses are "inside" the volume
+            if (!detail::LogicEvaluator(vol.logic())(logic_state.senses))
+            {
+                // State is *not* inside this volume: try the next one
+                continue;
+            }
+            if (logic_state.face)
+            {
+                // Initialized on a boundary in this volume but wasn't known
+                // to be crossing a surface. Fail safe by letting the
+                // multi-level tracking geometry (NOT YET IMPLEMENTED in GPU
+                // ORANGE) bump and try again.
+                return {unit_record_.background, {}};
+            }
+
+            // Found and not unexpectedly on a surface!
+            return {volid, {}};
+        }
+        node_idx = node.escape;
     }
 
     // Not found, or default to background volume
@@ -264,8 +303,9 @@ SimpleUnitTracker::intersect(LocalState const& state, real_type max_dist) const
  * Calculate nearest distance to a surface in any direction.
  *
  * The safety calculation uses a very limited method for calculating the safety
- * distance: it's the nearest distance to any surface, for a certain subset of
- * surfaces.  Other surface types will return a safety distance of zero.
+ * distance: it's the nearest distance to any surface, which is exact for a
+ * certain subset of surfaces.  Other surface types (general quadrics) use a
+ * conservative lower bound on the distance.
  * Complex surfaces might return the distance to internal surfaces that do not
  * represent the edge of a volume. Such distances are conservative but will
  * necessarily slow down the simulation.
@@ -276,12 +316,6 @@ CELER_FUNCTION real_type SimpleUnitTracker::safety(Real3 const& pos,
     CELER_EXPECT(volid);
 
     VolumeView vol = this->make_local_volume(volid);
-    if (!vol.simple_safety())
-    {
-        // Has a tricky surface: we can't use the simple algorithm to calculate
-        // the safety, so return a conservative estimate.
-        return 0;
-    }
 
     // Calculate minimim distance to all local faces
     real_type result = numeric_limits<real_type>::infinity();
@@ -335,6 +369,9 @@ CELER_FUNCTION auto SimpleUnitTracker::get_neighbors(LocalSurfaceId surf) const
  * Calculate distance-to-intercept for the next surface.
  *
  * The algorithm is:
+ * - If the volume is the "background" then search externally for the next
+ *   volume with \c background_intersect (equivalent of DistanceToIn for
+ *   Geant4).
  * - Use the current volume to find potential intersecting surfaces and maximum
  *   number of intersections.
  * - Loop over all surfaces and calculate the distance to intercept based on
@@ -348,9 +385,6 @@ CELER_FUNCTION auto SimpleUnitTracker::get_neighbors(LocalSurfaceId surf) const
  * - If the volume has no special cases, find the closest surface by calling \c
  *   simple_intersect.
  * - If the volume has internal surfaces call \c complex_intersect.
- * - If the volume is the "background" then search externally for the next
- *   volume with \c background_intersect (equivalent of DistanceToIn for
- *   Geant4)
  */
 template<class F>
 CELER_FUNCTION auto
@@ -363,6 +397,20 @@ SimpleUnitTracker::intersect_impl(LocalState const& state, F is_valid) const
     VolumeView vol = this->make_local_volume(state.volume);
     CELER_ASSERT(state.temp_next.size >= vol.max_intersections());
 
+    if (vol.implicit_vol())
+    {
+        // Search all the volumes "externally"
+        return this->background_intersect(state, is_valid);
+    }
+
+#if !CELER_DEVICE_COMPILE
+    if (!vol.batches().empty())
+    {
+        // Evaluate faces of the same surface type together
+        return this->batch_intersect(state, vol, is_valid);
+    }
+#endif
+
     // Find all valid (nearby or finite, depending on F) surface intersection
     // distances inside this volume. Fill the `isect` array if the tracking
     // algorithm requires sorting.
@@ -410,11 +458,6 @@ SimpleUnitTracker::intersect_impl(LocalState const& state, F is_valid) const
             // Internal surfaces: find closest surface that puts us outside
             return this->complex_intersect(state, vol, num_isect);
         }
-        else if (vol.implicit_vol())
-        {
-            // Search all the volumes "externally"
-            return this->background_intersect(state, num_isect);
-        }
     }
 
     CELER_ASSERT_UNREACHABLE();  // Unexpected set of flags
@@ -474,6 +517,69 @@ SimpleUnitTracker::simple_intersect(LocalState const& state,
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate distance to the next boundary using batches of faces.
+ *
+ * This is a host-only alternative to the face-by-face loop for volumes with
+ * many faces and a simple intersection. Each batch of same-type faces is
+ * dispatched once, and the closest distance for every face in the batch is
+ * written to the temporary distance array in a single loop. Ties are broken
+ * by the lowest face index to match the face-by-face search.
+ */
+template<class F>
+CELER_FUNCTION auto
+SimpleUnitTracker::batch_intersect(LocalState const& state,
+                                   VolumeView const& vol,
+                                   F is_valid) const -> Intersection
+{
+    CELER_EXPECT(vol.simple_intersection());
+
+    FaceId const on_face = state.surface ? vol.find_face(state.surface.id())
+                                         : FaceId{};
+    real_type* const distance = state.temp_next.distance;
+
+    FaceId min_face;
+    real_type min_dist = no_intersection();
+    for (SurfaceBatchRecord const& batch : vol.batches())
+    {
+        Span<FaceId const> faces = params_.batch_faces[batch.faces];
+        CELER_ASSERT(faces.size() <= state.temp_next.size);
+
+        auto calc_intersections = make_surface_type_action(
+            detail::CalcBatchIntersections<F const&>{
+                state.pos,
+                state.dir,
+                is_valid,
+                on_face,
+                faces,
+                params_.batch_reals[batch.data],
+                distance});
+        calc_intersections(batch.type);
+
+        for (auto i : range(faces.size()))
+        {
+            if (distance[i] < min_dist
+                || (distance[i] == min_dist && min_face && faces[i] < min_face))
+            {
+                min_dist = distance[i];
+                min_face = faces[i];
+            }
+        }
+    }
+
+    if (!min_face)
+    {
+        // No valid intersection
+        return {};
+    }
+
+    // Find the sense of the closest face using the face-by-face algorithm
+    state.temp_next.face[0] = min_face;
+    distance[0] = min_dist;
+    return this->simple_intersect(state, vol, 1);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Calculate boundary distance if internal surfaces are present.
@@ -540,42 +646,108 @@ SimpleUnitTracker::complex_intersect(LocalState const& state,
 /*!
  * Calculate distance from the background volume to enter any other volume.
  *
- * This is a slimmed-down version of the masked unit tracker's intersection
- * method. We loop over all surface intersections in ascending order, and test
- * all volumes that are connected to each surface. At the intersection point
- * being tested, we see whether each potential connected volume is "inside".
- * The first such volume gives our next surface.
+ * Rather than intersecting every surface in the unit, the bounding volume
+ * hierarchy is traversed along the ray: subtrees whose bounding boxes the ray
+ * misses, or enters beyond the closest intersection found so far, are
+ * skipped. The distance to enter each remaining candidate volume is
+ * calculated with \c enter_intersect and the closest is returned.
  *
- * It's not cheap, as there are many embedded loops:
- * - Intersection points
- * - Volumes connected to the surface being intersected
- * - Surfaces connected to the target volume (sense evaluation) plus number of
- *   elements in the logic array ("is_inside" evaluation)
- *
- * \pre The `state.temp_next.isect` array must be sorted by the caller by
- * ascending distance.
- * \pre The "faces" for the background volume are *all* the surfaces in the
- * volume (alternatively we could introduce a mapping between Face and
- * LocalSurfaceId).
+ * Volumes not in the hierarchy (implicit or provably empty volumes) are never
+ * entered from the background.
  */
+template<class F>
 CELER_FUNCTION auto
 SimpleUnitTracker::background_intersect(LocalState const& state,
-                                        size_type num_isect) const
-    -> Intersection
+                                        F is_valid) const -> Intersection
 {
     // Calculate bump distance
     const real_type bump_dist
         = detail::BumpCalculator{params_.scalars}(state.pos);
 
-    // Loop over distances and surface indices to cross by iterating over
-    // temp_next.isect[:num_isect].
+    Intersection result;
+    size_type node_idx = 0;
+    while (node_idx < unit_record_.bvh.size())
+    {
+        BvhNode const& node = params_.bvh_nodes[unit_record_.bvh[node_idx]];
+        real_type box_dist
+            = calc_dist_to_enter(node.bbox, state.pos, state.dir);
+        if (!(box_dist < result.distance) || !is_valid(box_dist))
+        {
+            // Ray misses the box or enters it beyond the closest volume
+            node_idx = node.escape;
+            continue;
+        }
+        if (node.volumes.empty())
+        {
+            // Descend into the first child
+            ++node_idx;
+            continue;
+        }
+
+        // Find the closest distance to enter a volume in this leaf
+        for (LocalVolumeId volid : params_.local_volume_ids[node.volumes])
+        {
+            CELER_ASSERT(volid != state.volume);
+            Intersection isect
+                = this->enter_intersect(state, volid, is_valid, bump_dist);
+            if (isect && isect.distance < result.distance)
+            {
+                result = isect;
+            }
+        }
+        node_idx = node.escape;
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate distance from the background to enter a single volume.
+ *
+ * We loop over the volume's surface intersections in ascending order and
+ * evaluate the volume's senses just past each crossing. The first crossing
+ * that puts us inside the volume is the entering surface.
+ */
+template<class F>
+CELER_FUNCTION auto
+SimpleUnitTracker::enter_intersect(LocalState const& state,
+                                   LocalVolumeId volid,
+                                   F const& is_valid,
+                                   real_type bump_dist) const -> Intersection
+{
+    VolumeView vol = this->make_local_volume(volid);
+
+    // Find all valid surface intersection distances for this volume
+    auto calc_intersections = make_surface_action(
+        this->make_local_surfaces(),
+        detail::CalcIntersections<F const&>{
+            state.pos,
+            state.dir,
+            is_valid,
+            state.surface ? vol.find_face(state.surface.id()) : FaceId{},
+            /* is_simple = */ false,
+            state.temp_next});
+    for (LocalSurfaceId surface : vol.faces())
+    {
+        calc_intersections(surface);
+    }
+    size_type num_isect = calc_intersections.action().isect_idx();
+    CELER_ASSERT(num_isect <= vol.max_intersections());
+
+    // Sort valid intersection distances in ascending order
+    celeritas::sort(state.temp_next.isect,
+                    state.temp_next.isect + num_isect,
+                    [&state](size_type a, size_type b) {
+                        return state.temp_next.distance[a]
+                               < state.temp_next.distance[b];
+                    });
+
+    detail::LogicEvaluator is_inside(vol.logic());
     for (size_type isect_idx = 0; isect_idx != num_isect; ++isect_idx)
     {
         // Index into the distance/face arrays
         const size_type isect = state.temp_next.isect[isect_idx];
-        // Inside the "background" volume, Face and Surface are the same
-        const LocalSurfaceId surface{
-            state.temp_next.face[isect].unchecked_get()};
 
         // Calculate position just past the surface in order to evaluate
         // senses, since we can't know the change in sense of the
@@ -584,33 +756,23 @@ SimpleUnitTracker::background_intersect(LocalState const& state,
         Real3 pos{state.pos};
         axpy(state.temp_next.distance[isect] + bump_dist, state.dir, &pos);
 
-        // Loop over volumes connected to this surface.
-        // TODO: intersection of this with BVH/acceleration grid
-        for (LocalVolumeId vid : this->get_neighbors(surface))
+        auto logic_state = detail::SenseCalculator{
+            this->make_local_surfaces(), pos, state.temp_sense}(vol);
+        if (is_inside(logic_state.senses))
         {
-            CELER_ASSERT(vid != state.volume);
-            VolumeView vol = this->make_local_volume(vid);
-            auto logic_state = detail::SenseCalculator{
-                this->make_local_surfaces(), pos, state.temp_sense}(vol);
-
-            if (detail::LogicEvaluator{vol.logic()}(logic_state.senses))
-            {
-                // We are in this new volume by crossing the tested surface.
-                // Get the sense corresponding to this "crossed" surface.
-                auto face = vol.find_face(surface);
-                CELER_ASSERT(face);
-
-                Intersection result;
-                result.distance = state.temp_next.distance[isect];
-                result.surface = detail::OnLocalSurface{
-                    surface,
-                    flip_sense(logic_state.senses[face.unchecked_get()])};
-                return result;
-            }
+            // We are in this new volume by crossing the tested surface.
+            // Get the sense corresponding to this "crossed" surface.
+            FaceId face = state.temp_next.face[isect];
+            Intersection result;
+            result.distance = state.temp_next.distance[isect];
+            result.surface = detail::OnLocalSurface{
+                vol.get_surface(face),
+                flip_sense(logic_state.senses[face.unchecked_get()])};
+            return result;
         }
     }
 
-    // No intersection in this unit
+    // Not entering this volume along the ray
     return {};
 }
 
@@ -643,5 +805,21 @@ SimpleUnitTracker::daughter(LocalVolumeId vol) const
     return params_.volume_records[unit_record_.volumes[vol]].daughter_id;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether an unbounded intersection costs the same as a bounded one.
+ *
+ * In a volume without internal surfaces or an implicit definition, the
+ * distance to every face is calculated regardless of the maximum distance,
+ * and only a linear search for the minimum follows. Searching to infinity
+ * then gives the exact boundary distance for free, which the caller can keep
+ * across multiple physics-limited steps.
+ */
+CELER_FORCEINLINE_FUNCTION bool
+SimpleUnitTracker::exact_intersect_is_cheap(LocalVolumeId vol) const
+{
+    return this->make_local_volume(vol).simple_intersection();
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -62,6 +62,9 @@ class VolumeView
     // Get logic definition
     CELER_FORCEINLINE_FUNCTION Span<logic_int const> logic() const;
 
+    // Get faces grouped by surface type (host only)
+    CELER_FORCEINLINE_FUNCTION Span<SurfaceBatchRecord const> batches() const;
+
     // Get the number of total intersections
     CELER_FORCEINLINE_FUNCTION logic_int max_intersections() const;
 
@@ -168,6 +171,18 @@ CELER_FUNCTION Span<logic_int const> VolumeView::logic() const
     return params_.logic_ints[def_.logic];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get faces grouped by surface type.
+ *
+ * This is empty unless the volume has many faces and a simple intersection.
+ * It's only used for tracking on the host.
+ */
+CELER_FUNCTION Span<SurfaceBatchRecord const> VolumeView::batches() const
+{
+    return params_.surface_batches[def_.batches];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the maximum number of surface intersections.
@@ -10,6 +10,20 @@
 #include "corecel/Assert.hh"
 #include "corecel/cont/Array.hh"
 #include "corecel/math/Algorithms.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "corecel/math/NumericLimits.hh"
+#include "corecel/cont/Span.hh"
+#include "orange/surf/ConeAligned.hh"
+#include "orange/surf/CylAligned.hh"
+#include "orange/surf/CylCentered.hh"
+#include "orange/surf/GeneralQuadric.hh"
+#include "orange/surf/Plane.hh"
+#include "orange/surf/PlaneAligned.hh"
+#include "orange/surf/SimpleQuadric.hh"
+#include "orange/surf/Sphere.hh"
+#include "orange/surf/SphereCentered.hh"
+#include "orange/surf/detail/QuadraticSolver.hh"
+#include "orange/surf/detail/SurfaceAction.hh"
 
 #include "Types.hh"
 
@@ -54,6 +68,110 @@ struct CalcNormal
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a lower bound on the distance to a surface.
+ *
+ * This is the fallback for surfaces without a specialized bound.
+ */
+template<class S>
+CELER_FUNCTION real_type calc_safety_bound(S const&, Real3 const&)
+{
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a lower bound on the distance to a general quadric.
+ *
+ * Writing the quadric as \f$ f(x) = x^T A x + b \cdot x + j \f$, its value
+ * at a distance \em r from the point \em p satisfies
+ * \f[
+   |f(p + s)| \ge |f(p)| - |\nabla f(p)| r - \|A\| r^2 ,
+ * \f]
+ * where the spectral norm of \em A is bounded by its Frobenius norm. The
+ * surface \f$ f = 0 \f$ therefore can't be closer than the positive root of
+ * the right-hand side. Near the surface this approaches the first-order
+ * distance \f$ |f| / |\nabla f| \f$.
+ */
+inline CELER_FUNCTION real_type calc_safety_bound(GeneralQuadric const& gq,
+                                                  Real3 const& pos)
+{
+    auto second = gq.second();
+    auto cross = gq.cross();
+    auto first = gq.first();
+    const real_type x = pos[0];
+    const real_type y = pos[1];
+    const real_type z = pos[2];
+
+    real_type val = (second[0] * x + cross[0] * y + cross[2] * z + first[0]) * x
+                    + (second[1] * y + cross[1] * z + first[1]) * y
+                    + (second[2] * z + first[2]) * z + gq.zeroth();
+    val = std::fabs(val);
+    if (val == 0)
+    {
+        return 0;
+    }
+
+    Real3 grad;
+    grad[0] = 2 * second[0] * x + cross[0] * y + cross[2] * z + first[0];
+    grad[1] = 2 * second[1] * y + cross[0] * x + cross[1] * z + first[1];
+    grad[2] = 2 * second[2] * z + cross[1] * y + cross[2] * x + first[2];
+    real_type grad_norm = norm(grad);
+
+    // Off-diagonal matrix elements are half the cross coefficients
+    real_type quad_norm = std::sqrt(
+        ipow<2>(second[0]) + ipow<2>(second[1]) + ipow<2>(second[2])
+        + (ipow<2>(cross[0]) + ipow<2>(cross[1]) + ipow<2>(cross[2])) / 2);
+
+    real_type denom
+        = grad_norm + std::sqrt(ipow<2>(grad_norm) + 4 * quad_norm * val);
+    if (denom == 0)
+    {
+        // Constant nonzero function: surface doesn't exist
+        return numeric_limits<real_type>::infinity();
+    }
+    return 2 * val / denom;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a lower bound on the distance to a simple quadric.
+ */
+inline CELER_FUNCTION real_type calc_safety_bound(SimpleQuadric const& sq,
+                                                  Real3 const& pos)
+{
+    auto second = sq.second();
+    auto first = sq.first();
+    return calc_safety_bound(GeneralQuadric{{second[0], second[1], second[2]},
+                                            {0, 0, 0},
+                                            {first[0], first[1], first[2]},
+                                            sq.zeroth()},
+                             pos);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a lower bound on the distance to an axis-aligned cone.
+ */
+template<Axis T>
+CELER_FUNCTION real_type calc_safety_bound(ConeAligned<T> const& k,
+                                           Real3 const& pos)
+{
+    // Expand (x - x_0)^2 with coefficient -t^2 along the axis and 1 otherwise
+    Real3 second{1, 1, 1};
+    second[static_cast<int>(T)] = -k.tangent_sq();
+    Real3 first;
+    real_type zeroth = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+        first[i] = -2 * second[i] * k.origin()[i];
+        zeroth += second[i] * ipow<2>(k.origin()[i]);
+    }
+    return calc_safety_bound(GeneralQuadric{second, {0, 0, 0}, first, zeroth},
+                             pos);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Calculate the smallest distance from a point to the surface.
@@ -61,6 +179,7 @@ struct CalcNormal
  * For certain surface types (spheres, cylinders, planes), defined such that
  * the normal is *outward* (positive when "outside", negative when "inside"),
  * the nearest distance to the surface can be calculated quite trivially.
+ * Other surfaces return a conservative lower bound.
  */
 struct CalcSafetyDistance
 {
@@ -74,7 +193,7 @@ struct CalcSafetyDistance
         {
             // Not a surface that satisfies our simplifying constraints: return
             // a conservative answer.
-            return 0;
+            return calc_safety_bound(surf, this->pos);
         }
 
         // Calculate outward normal
@@ -180,6 +299,363 @@ class CalcIntersections
     size_type isect_idx_{0};
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the closest valid intersection of each face in a batch.
+ *
+ * The batch contains faces of a single surface type whose coefficients are
+ * stored as a structure of arrays (see \c SurfaceBatchRecord ). The closest
+ * valid distance for each face (or \c no_intersection if none) is written to
+ * the corresponding element of the output.
+ *
+ * Planes, spheres, and cylinders are intersected with a loop over the
+ * coefficient arrays that performs the same floating point operations as the
+ * surface's \c calc_intersections , so the results are identical to the
+ * face-by-face search. The plane loops have no branches so that the compiler
+ * can vectorize them. The quadric loops skip the square root for faces that
+ * the track misses: this is faster than a branchless loop unless many faces
+ * are hit, since the square root can't be vectorized without
+ * \c -fno-math-errno .
+ *
+ * All faces are first intersected as though the track is off the surface;
+ * the face the track is on (if any) is then recalculated with the surface
+ * class itself. Other surface types gather their coefficients and construct
+ * the surface for each face.
+ */
+template<class IsValid>
+class CalcBatchIntersections
+{
+  public:
+    //! Construct from the particle point, direction, face ID, and batch data
+    CELER_FUNCTION CalcBatchIntersections(Real3 const& pos,
+                                          Real3 const& dir,
+                                          IsValid is_valid_isect,
+                                          FaceId on_face,
+                                          Span<FaceId const> faces,
+                                          Span<real_type const> data,
+                                          real_type* distance)
+        : pos_(pos)
+        , dir_(dir)
+        , is_valid_isect_(is_valid_isect)
+        , on_face_(on_face)
+        , faces_(faces)
+        , data_(data)
+        , distance_(distance)
+    {
+        CELER_EXPECT(!faces_.empty() && distance_);
+    }
+
+    //! Operate on all faces of a surface type
+    template<class S>
+    CELER_FUNCTION void operator()(SurfaceTypeTag<S> tag)
+    {
+        CELER_EXPECT(data_.size() == S::Storage::extent * faces_.size());
+
+        this->calc_off(tag);
+
+        for (size_type i = 0; i < faces_.size(); ++i)
+        {
+            if (faces_[i] == on_face_)
+            {
+                distance_[i] = this->calc_closest(this->make_surface<S>(i),
+                                                  SurfaceState::on);
+            }
+        }
+    }
+
+  private:
+    //// DATA ////
+
+    Real3 const& pos_;
+    Real3 const& dir_;
+    const IsValid is_valid_isect_;
+    const FaceId on_face_;
+    Span<FaceId const> faces_;
+    Span<real_type const> data_;
+    real_type* const distance_;
+
+    //// HELPER FUNCTIONS ////
+
+    //! Get the j'th coefficient of every face in the batch
+    CELER_FUNCTION real_type const* coeffs(size_type j) const
+    {
+        return data_.data() + j * faces_.size();
+    }
+
+    //! Return the distance if it's positive and valid (and not NaN)
+    CELER_FUNCTION real_type select(real_type dist) const
+    {
+        // Don't short-circuit so that the batch loops have no branches
+        bool const keep = (dist > 0) & is_valid_isect_(dist);
+        return keep ? dist : no_intersection();
+    }
+
+    //! Construct the surface for the i'th face
+    template<class S>
+    CELER_FUNCTION S make_surface(size_type i) const
+    {
+        constexpr size_type extent = S::Storage::extent;
+        Array<real_type, extent> coeffs;
+        for (size_type j = 0; j < extent; ++j)
+        {
+            coeffs[j] = this->coeffs(j)[i];
+        }
+        return S{typename S::Storage{coeffs.data(), extent}};
+    }
+
+    //! Calculate the closest valid distance to a single surface
+    template<class S>
+    CELER_FUNCTION real_type calc_closest(S const& surf,
+                                          SurfaceState on_surface) const
+    {
+        real_type result = no_intersection();
+        for (real_type dist : surf.calc_intersections(pos_, dir_, on_surface))
+        {
+            if (is_valid_isect_(dist) && dist < result)
+            {
+                result = dist;
+            }
+        }
+        return result;
+    }
+
+    //! Fill the output with no intersections
+    CELER_FUNCTION void fill_none()
+    {
+        for (size_type i = 0; i < faces_.size(); ++i)
+        {
+            distance_[i] = no_intersection();
+        }
+    }
+
+    // Intersect the smaller positive root of a normalized quadratic
+    inline CELER_FUNCTION real_type calc_quadratic(real_type hba,
+                                                   real_type c) const;
+
+    //!@{
+    //! Intersect all faces as though the track is off them
+    template<class S>
+    inline CELER_FUNCTION void calc_off(SurfaceTypeTag<S>);
+    template<Axis T>
+    inline CELER_FUNCTION void calc_off(SurfaceTypeTag<PlaneAligned<T>>);
+    inline CELER_FUNCTION void calc_off(SurfaceTypeTag<Plane>);
+    inline CELER_FUNCTION void calc_off(SurfaceTypeTag<SphereCentered>);
+    inline CELER_FUNCTION void calc_off(SurfaceTypeTag<Sphere>);
+    template<Axis T>
+    inline CELER_FUNCTION void calc_off(SurfaceTypeTag<CylCentered<T>>);
+    template<Axis T>
+    inline CELER_FUNCTION void calc_off(SurfaceTypeTag<CylAligned<T>>);
+    //!@}
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Intersect the smaller positive root of a normalized quadratic.
+ *
+ * This performs the same operations as \c QuadraticSolver for a track off the
+ * surface, given \em (b/2)/a and \em c/a .
+ */
+template<class IsValid>
+CELER_FUNCTION real_type
+CalcBatchIntersections<IsValid>::calc_quadratic(real_type hba,
+                                                real_type c) const
+{
+    real_type const b2_4 = hba * hba;
+    if (b2_4 < c)
+    {
+        // No real roots
+        return no_intersection();
+    }
+    real_type const t2 = std::sqrt(b2_4 - c);
+    return celeritas::min(this->select(-hba - t2), this->select(-hba + t2));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Intersect faces of an arbitrary surface type one at a time.
+ */
+template<class IsValid>
+template<class S>
+CELER_FUNCTION void
+CalcBatchIntersections<IsValid>::calc_off(SurfaceTypeTag<S>)
+{
+    for (size_type i = 0; i < faces_.size(); ++i)
+    {
+        distance_[i] = this->calc_closest(this->make_surface<S>(i),
+                                          SurfaceState::off);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Intersect axis-aligned planes.
+ */
+template<class IsValid>
+template<Axis T>
+CELER_FUNCTION void
+CalcBatchIntersections<IsValid>::calc_off(SurfaceTypeTag<PlaneAligned<T>>)
+{
+    real_type const pos = pos_[static_cast<int>(T)];
+    real_type const dir = dir_[static_cast<int>(T)];
+    if (dir == 0)
+    {
+        // Parallel to all planes
+        this->fill_none();
+        return;
+    }
+
+    size_type const num_faces = faces_.size();
+    real_type const* position = this->coeffs(0);
+    for (size_type i = 0; i < num_faces; ++i)
+    {
+        distance_[i] = this->select((position[i] - pos) / dir);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Intersect general planes.
+ */
+template<class IsValid>
+CELER_FUNCTION void
+CalcBatchIntersections<IsValid>::calc_off(SurfaceTypeTag<Plane>)
+{
+    real_type const px = pos_[0], py = pos_[1], pz = pos_[2];
+    real_type const dx = dir_[0], dy = dir_[1], dz = dir_[2];
+
+    size_type const num_faces = faces_.size();
+    real_type const* nx = this->coeffs(0);
+    real_type const* ny = this->coeffs(1);
+    real_type const* nz = this->coeffs(2);
+    real_type const* d = this->coeffs(3);
+    for (size_type i = 0; i < num_faces; ++i)
+    {
+        real_type const n_dir = nx[i] * dx + ny[i] * dy + nz[i] * dz;
+        real_type const n_pos = nx[i] * px + ny[i] * py + nz[i] * pz;
+        // Parallel planes give an infinite or NaN distance, which is rejected
+        distance_[i] = this->select((d[i] - n_pos) / n_dir);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Intersect origin-centered spheres.
+ */
+template<class IsValid>
+CELER_FUNCTION void
+CalcBatchIntersections<IsValid>::calc_off(SurfaceTypeTag<SphereCentered>)
+{
+    real_type const hb = dot_product(pos_, dir_);
+    real_type const pos_sq = dot_product(pos_, pos_);
+
+    size_type const num_faces = faces_.size();
+    real_type const* radius_sq = this->coeffs(0);
+    for (size_type i = 0; i < num_faces; ++i)
+    {
+        distance_[i] = this->calc_quadratic(hb, pos_sq - radius_sq[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Intersect general spheres.
+ */
+template<class IsValid>
+CELER_FUNCTION void
+CalcBatchIntersections<IsValid>::calc_off(SurfaceTypeTag<Sphere>)
+{
+    real_type const px = pos_[0], py = pos_[1], pz = pos_[2];
+    real_type const dx = dir_[0], dy = dir_[1], dz = dir_[2];
+
+    size_type const num_faces = faces_.size();
+    real_type const* ox = this->coeffs(0);
+    real_type const* oy = this->coeffs(1);
+    real_type const* oz = this->coeffs(2);
+    real_type const* radius_sq = this->coeffs(3);
+    for (size_type i = 0; i < num_faces; ++i)
+    {
+        real_type const x = px - ox[i];
+        real_type const y = py - oy[i];
+        real_type const z = pz - oz[i];
+        real_type const hb = x * dx + y * dy + z * dz;
+        distance_[i] = this->calc_quadratic(
+            hb, x * x + y * y + z * z - radius_sq[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Intersect axis-aligned cylinders centered on the origin.
+ */
+template<class IsValid>
+template<Axis T>
+CELER_FUNCTION void
+CalcBatchIntersections<IsValid>::calc_off(SurfaceTypeTag<CylCentered<T>>)
+{
+    constexpr int t = static_cast<int>(T);
+    constexpr int u = static_cast<int>(T == Axis::x ? Axis::y : Axis::x);
+    constexpr int v = static_cast<int>(T == Axis::z ? Axis::y : Axis::z);
+
+    real_type const a = 1 - ipow<2>(dir_[t]);
+    if (a < QuadraticSolver::min_a())
+    {
+        // Traveling along the cylinder axis
+        this->fill_none();
+        return;
+    }
+    real_type const a_inv = 1 / a;
+    real_type const hba = (dir_[u] * pos_[u] + dir_[v] * pos_[v]) * a_inv;
+    real_type const pos_sq = ipow<2>(pos_[u]) + ipow<2>(pos_[v]);
+
+    size_type const num_faces = faces_.size();
+    real_type const* radius_sq = this->coeffs(0);
+    for (size_type i = 0; i < num_faces; ++i)
+    {
+        distance_[i]
+            = this->calc_quadratic(hba, (pos_sq - radius_sq[i]) * a_inv);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Intersect axis-aligned cylinders.
+ */
+template<class IsValid>
+template<Axis T>
+CELER_FUNCTION void
+CalcBatchIntersections<IsValid>::calc_off(SurfaceTypeTag<CylAligned<T>>)
+{
+    constexpr int t = static_cast<int>(T);
+    constexpr int u = static_cast<int>(T == Axis::x ? Axis::y : Axis::x);
+    constexpr int v = static_cast<int>(T == Axis::z ? Axis::y : Axis::z);
+
+    real_type const a = 1 - ipow<2>(dir_[t]);
+    if (a < QuadraticSolver::min_a())
+    {
+        // Traveling along the cylinder axis
+        this->fill_none();
+        return;
+    }
+    real_type const a_inv = 1 / a;
+    real_type const pu = pos_[u], pv = pos_[v];
+    real_type const du = dir_[u], dv = dir_[v];
+
+    size_type const num_faces = faces_.size();
+    real_type const* origin_u = this->coeffs(0);
+    real_type const* origin_v = this->coeffs(1);
+    real_type const* radius_sq = this->coeffs(2);
+    for (size_type i = 0; i < num_faces; ++i)
+    {
+        real_type const tu = pu - origin_u[i];
+        real_type const tv = pv - origin_v[i];
+        distance_[i] = this->calc_quadratic(
+            (du * tu + dv * tv) * a_inv,
+            (tu * tu + tv * tv - radius_sq[i]) * a_inv);
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
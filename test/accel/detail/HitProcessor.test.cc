@@ -151,6 +151,7 @@ class HitProcessorTest : public ::celeritas::test::SimpleCmsTestBase
         selection_.points[StepPoint::pre].energy = true;
         selection_.points[StepPoint::pre].pos = true;
         selection_.points[StepPoint::post].time = true;
+        selection_.event_id = true;
     }
 
     static MapStrSD& detectors();
@@ -343,6 +344,42 @@ TEST_F(HitProcessorTest, no_touchable)
     }
 }
 
+//---------------------------------------------------------------------------//
+TEST_F(HitProcessorTest, buffer_events)
+{
+    HitProcessor process_hits{detector_volumes(), selection_, false};
+    auto dso_hits = this->make_dso();
+    dso_hits.event_id = {EventId{1}, EventId{0}, EventId{1}};
+    process_hits.buffer(std::move(dso_hits));
+    EXPECT_EQ(1, process_hits.num_buffered());
+    EXPECT_EQ(0, this->get_hits("em_calorimeter").energy_deposition.size());
+
+    // Only the hits from the completed event are sent
+    process_hits.flush(EventId{0});
+    EXPECT_EQ(1, process_hits.num_buffered());
+    {
+        static double const expected_energy_deposition[] = {0.2};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           this->get_hits("em_calorimeter").energy_deposition);
+        EXPECT_EQ(0, this->get_hits("si_tracker").energy_deposition.size());
+        EXPECT_EQ(0,
+                  this->get_hits("had_calorimeter").energy_deposition.size());
+    }
+
+    process_hits.flush(EventId{1});
+    EXPECT_EQ(0, process_hits.num_buffered());
+    {
+        static double const expected_energy_deposition[] = {0.1};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           this->get_hits("si_tracker").energy_deposition);
+    }
+    {
+        static double const expected_energy_deposition[] = {0.3};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           this->get_hits("had_calorimeter").energy_deposition);
+    }
+}
+
 //---------------------------------------------------------------------------//
 TEST_F(HitProcessorTest, touchable_midvol)
 {
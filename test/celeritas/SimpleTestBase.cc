@@ -95,7 +95,17 @@ auto SimpleTestBase::build_physics() -> SPConstPhysics
 {
     PhysicsParams::Input input;
     input.options.secondary_stack_factor = this->secondary_stack_factor();
+    input.particles = this->particle();
+    input.materials = this->material();
+    input.processes = this->build_processes();
+    input.action_registry = this->action_reg().get();
 
+    return std::make_shared<PhysicsParams>(std::move(input));
+}
+
+//---------------------------------------------------------------------------//
+auto SimpleTestBase::build_processes() -> VecProcess
+{
     ImportProcess compton_data;
     compton_data.particle_pdg = pdg::gamma().get();
     compton_data.secondary_pdg = pdg::electron().get();
@@ -145,13 +155,7 @@ auto SimpleTestBase::build_physics() -> SPConstPhysics
     auto process_data = std::make_shared<ImportedProcesses>(
         std::vector<ImportProcess>{std::move(compton_data)});
 
-    input.particles = this->particle();
-    input.materials = this->material();
-    input.processes
-        = {std::make_shared<ComptonProcess>(input.particles, process_data)};
-    input.action_registry = this->action_reg().get();
-
-    return std::make_shared<PhysicsParams>(std::move(input));
+    return {std::make_shared<ComptonProcess>(this->particle(), process_data)};
 }
 
 //---------------------------------------------------------------------------//
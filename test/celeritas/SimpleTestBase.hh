@@ -7,12 +7,17 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "corecel/Types.hh"
 
 #include "GlobalGeoTestBase.hh"
 
 namespace celeritas
 {
+class Process;
+
 namespace test
 {
 //---------------------------------------------------------------------------//
@@ -21,6 +26,10 @@ namespace test
  */
 class SimpleTestBase : virtual public GlobalGeoTestBase
 {
+  protected:
+    using SPConstProcess = std::shared_ptr<Process const>;
+    using VecProcess = std::vector<SPConstProcess>;
+
   protected:
     char const* geometry_basename() const override { return "two-boxes"; }
 
@@ -34,6 +43,9 @@ class SimpleTestBase : virtual public GlobalGeoTestBase
     SPConstSim build_sim() override;
     SPConstTrackInit build_init() override;
     SPConstAction build_along_step() override;
+
+    // Construct the physics processes (Compton scattering)
+    virtual VecProcess build_processes();
 };
 
 //---------------------------------------------------------------------------//
@@ -77,7 +77,8 @@ class CombinedBremTest : public InteractorHostTestBase
                                                      *this->material_params(),
                                                      this->imported_processes(),
                                                      read_element_data,
-                                                     true);
+                                                     true,
+                                                     false);
 
         // Set cutoffs
         CutoffParams::Input input;
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include <cmath>
 #include <fstream>
+#include <limits>
 #include <map>
 
 #include "corecel/cont/Range.hh"
@@ -510,8 +511,40 @@ TEST_F(LivermorePETest, macro_xs)
            6.653075041804e-11, 1.971081007251e-11, 5.85857761177e-12,
            1.743005702864e-12, 5.187166124179e-13, 1.543827005416e-13,
            4.594922185898e-14, 1.367605938008e-14};
-    EXPECT_VEC_SOFT_EQ(expected_macro_xs, macro_xs);
+    EXPECT_VEC_NEAR(
+        expected_macro_xs, macro_xs, CELERITAS_FLOAT_TABLES ? 1e-6 : 1e-12);
 }
+
+TEST_F(LivermorePETest, table_storage)
+{
+    // Tabulated values are stored to within the precision of the table type
+    LivermorePEReader read_element_data(
+        this->test_data_path("celeritas", "").c_str());
+    ImportLivermorePE const imported = read_element_data(AtomicNumber{19});
+    real_type const tol = std::numeric_limits<table_real_type>::epsilon();
+
+    auto const& xs = model_->host_ref().xs;
+    auto stored = [&xs](ItemRange<table_real_type> items) {
+        auto values = xs.reals[items];
+        return std::vector<real_type>(values.begin(), values.end());
+    };
+
+    LivermoreElement const& el = xs.elements[ElementId{0}];
+    EXPECT_VEC_NEAR(imported.xs_lo.x, stored(el.xs_lo.grid), tol);
+    EXPECT_VEC_NEAR(imported.xs_lo.y, stored(el.xs_lo.value), tol);
+    EXPECT_VEC_NEAR(imported.xs_hi.x, stored(el.xs_hi.grid), tol);
+    EXPECT_VEC_NEAR(imported.xs_hi.y, stored(el.xs_hi.value), tol);
+
+    auto shells = xs.shells[el.shells];
+    ASSERT_EQ(imported.shells.size(), shells.size());
+    for (auto i : range(shells.size()))
+    {
+        GenericGridData const& shell_xs = shells[i].xs;
+        EXPECT_VEC_NEAR(imported.shells[i].energy, stored(shell_xs.grid), tol);
+        EXPECT_VEC_NEAR(imported.shells[i].xs, stored(shell_xs.value), tol);
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 
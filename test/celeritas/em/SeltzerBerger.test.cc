@@ -5,10 +5,14 @@
 //---------------------------------------------------------------------------//
 //! \file celeritas/em/SeltzerBerger.test.cc
 //---------------------------------------------------------------------------//
+#include <limits>
+#include <vector>
+
 #include "corecel/cont/Range.hh"
 #include "corecel/math/Algorithms.hh"
 #include "corecel/math/ArrayUtils.hh"
 #include "celeritas/Quantities.hh"
+#include "celeritas/em/distribution/SBAliasEnergyDistribution.hh"
 #include "celeritas/em/distribution/SBEnergyDistribution.hh"
 #include "celeritas/em/interactor/SeltzerBergerInteractor.hh"
 #include "celeritas/em/interactor/detail/SBPositronXsCorrector.hh"
@@ -82,7 +86,8 @@ class SeltzerBergerTest : public InteractorHostTestBase
                                                    *this->particle_params(),
                                                    *this->material_params(),
                                                    this->imported_processes(),
-                                                   read_element_data);
+                                                   read_element_data,
+                                                   false);
         data_ = model_->host_ref();
 
         // Set cutoffs
@@ -151,6 +156,26 @@ TEST_F(SeltzerBergerTest, sb_tables)
     EXPECT_VEC_EQ(argmax, expected_argmax);
 }
 
+TEST_F(SeltzerBergerTest, sb_table_storage)
+{
+    // Tabulated values are stored to within the precision of the table type
+    SeltzerBergerReader read_element_data(
+        this->test_data_path("celeritas", "").c_str());
+    ImportSBTable const imported = read_element_data(AtomicNumber{29});
+    real_type const tol = std::numeric_limits<table_real_type>::epsilon();
+
+    auto const& xs = model_->host_ref().differential_xs;
+    auto stored = [&xs](ItemRange<table_real_type> items) {
+        auto values = xs.reals[items];
+        return std::vector<real_type>(values.begin(), values.end());
+    };
+
+    TwodGridData const& grid = xs.elements[ElementId{0}].grid;
+    EXPECT_VEC_NEAR(imported.x, stored(grid.x), tol);
+    EXPECT_VEC_NEAR(imported.y, stored(grid.y), tol);
+    EXPECT_VEC_NEAR(imported.value, stored(grid.values), tol);
+}
+
 TEST_F(SeltzerBergerTest, sb_positron_xs_scaling)
 {
     ParticleParams const& pp = *this->particle_params();
@@ -292,10 +317,116 @@ TEST_F(SeltzerBergerTest, sb_energy_dist)
         4.65478515625};
     // clang-format on
 
-    EXPECT_VEC_SOFT_EQ(expected_max_xs, max_xs);
-    EXPECT_VEC_SOFT_EQ(expected_xs_zero, xs_zero);
-    EXPECT_VEC_SOFT_EQ(expected_avg_exit_frac, avg_exit_frac);
-    EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
+    real_type const tol = CELERITAS_FLOAT_TABLES ? 1e-6 : 1e-12;
+    EXPECT_VEC_NEAR(expected_max_xs, max_xs, tol);
+    EXPECT_VEC_NEAR(expected_xs_zero, xs_zero, tol);
+    if (!CELERITAS_FLOAT_TABLES)
+    {
+        // Rounded tables change the sequence of accepted samples
+        EXPECT_VEC_SOFT_EQ(expected_avg_exit_frac, avg_exit_frac);
+        EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
+    }
+}
+
+TEST_F(SeltzerBergerTest, sb_alias_energy_dist)
+{
+    // Construct a model with alias tables
+    auto alias_model = std::make_shared<SeltzerBergerModel>(
+        ActionId{0},
+        *this->particle_params(),
+        *this->material_params(),
+        this->imported_processes(),
+        SeltzerBergerReader{this->test_data_path("celeritas", "").c_str()},
+        true);
+    auto const& alias_xs = alias_model->host_ref().differential_xs;
+    SBElementTableData const& table = alias_xs.elements[ElementId{0}];
+    ASSERT_TRUE(table.has_alias());
+    EXPECT_FALSE(model_->host_ref()
+                     .differential_xs.elements[ElementId{0}]
+                     .has_alias());
+    EXPECT_EQ(57 * 32, table.weight_sums.size());
+    EXPECT_EQ(57 * 31 * 30 / 2, table.alias_prob.size());
+
+    int const num_samples = 8192;
+    ParticleParams const& pp = *this->particle_params();
+    const units::MevMass positron_mass
+        = pp.get(pp.find(pdg::positron())).mass();
+    ElementView const el = this->material_params()->get(ElementId{0});
+
+    std::vector<double> avg_exit_frac;
+    std::vector<double> avg_engine_samples;
+
+    auto sample_many = [&](real_type inc_energy,
+                           Energy gamma_cutoff,
+                           auto& sample_energy) {
+        double total_exit_energy = 0;
+        RandomEngine& rng_engine = this->rng();
+        for (int i = 0; i < num_samples; ++i)
+        {
+            Energy exit_gamma = sample_energy(rng_engine);
+            EXPECT_GT(exit_gamma.value(), gamma_cutoff.value());
+            EXPECT_LT(exit_gamma.value(), inc_energy);
+            total_exit_energy += exit_gamma.value();
+        }
+        avg_exit_frac.push_back(total_exit_energy / (num_samples * inc_energy));
+        avg_engine_samples.push_back(double(rng_engine.count()) / num_samples);
+    };
+
+    for (real_type cutoff : {0.0009, 0.1})
+    {
+        const Energy gamma_cutoff{cutoff};
+        for (real_type inc_energy : {0.0045, 0.567, 7.89, 89.0, 901.})
+        {
+            if (inc_energy <= cutoff)
+            {
+                continue;
+            }
+            auto dens_corr
+                = this->density_correction(MaterialId{0}, Energy{inc_energy});
+
+            SBAliasEnergyDistribution<SBElectronXsCorrector> sample_electron(
+                alias_xs,
+                Energy{inc_energy},
+                ElementId{0},
+                dens_corr,
+                gamma_cutoff,
+                {});
+            sample_many(inc_energy, gamma_cutoff, sample_electron);
+
+            SBAliasEnergyDistribution<SBPositronXsCorrector> sample_positron(
+                alias_xs,
+                Energy{inc_energy},
+                ElementId{0},
+                dens_corr,
+                gamma_cutoff,
+                {positron_mass, el, gamma_cutoff, Energy{inc_energy}});
+            sample_many(inc_energy, gamma_cutoff, sample_positron);
+        }
+    }
+
+    // Electron values agree with rejection sampling (see sb_energy_dist) to
+    // within statistical error, using about one trial (three random reals)
+    // per sample
+    // clang-format off
+    const double expected_avg_exit_frac[] = {0.49654376378957,
+        0.27668088287324, 0.084352153134494, 0.070568473750333,
+        0.064225988583628, 0.062378607922395, 0.076074130236899,
+        0.077932820951734, 0.086702215633686, 0.087079130007045,
+        0.38864540045386, 0.346825029343, 0.14772630989862, 0.15010446978494,
+        0.10823958768462, 0.1105822991592, 0.089560215439198,
+        0.089291909550703};
+    const double expected_avg_engine_samples[] = {6.005859375, 23.109375,
+        6.183837890625, 6.377197265625, 6.1025390625, 6.112060546875,
+        6.087158203125, 6.078369140625, 6.052001953125, 6.0556640625,
+        6.2958984375, 7.204833984375, 6.191162109375, 6.21826171875,
+        6.101806640625, 6.110595703125, 6.065185546875, 6.059326171875};
+    // clang-format on
+    if (!CELERITAS_FLOAT_TABLES)
+    {
+        // Rounded tables change the sequence of accepted samples
+        EXPECT_VEC_SOFT_EQ(expected_avg_exit_frac, avg_exit_frac);
+        EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
+    }
 }
 
 TEST_F(SeltzerBergerTest, basic)
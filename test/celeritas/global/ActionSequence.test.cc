@@ -0,0 +1,243 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/ActionSequence.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/detail/ActionSequence.hh"
+
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "celeritas_config.h"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/io/MultiStreamOutput.hh"
+#include "celeritas/Units.hh"
+#include "celeritas/global/ActionProfiler.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/phys/CutoffParams.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/track/TrackInitParams.hh"
+
+#include "../SimpleTestBase.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class ActionSequenceTest : public SimpleTestBase
+{
+  protected:
+    using HostStepper = Stepper<MemSpace::host>;
+
+    SPConstCutoff build_cutoff() override
+    {
+        // Kill electrons (which have no physics) as they're produced
+        CutoffParams::Input input;
+        input.materials = this->material();
+        input.particles = this->particle();
+        input.cutoffs = {
+            {pdg::gamma(),
+             {{units::MevEnergy{0.01}, 0.1 * units::millimeter},
+              {units::MevEnergy{100}, 100 * units::centimeter}}},
+            {pdg::electron(),
+             {{units::MevEnergy{1000}, 1000 * units::centimeter},
+              {units::MevEnergy{1000}, 1000 * units::centimeter}}},
+        };
+        input.apply_post_interaction = true;
+        return std::make_shared<CutoffParams>(std::move(input));
+    }
+
+    SPConstTrackInit build_init() override
+    {
+        TrackInitParams::Input input;
+        input.capacity = 4096;
+        input.max_events = 4096;
+        input.track_order = this->track_order();
+        return std::make_shared<TrackInitParams>(input);
+    }
+
+    virtual TrackOrder track_order() const { return TrackOrder::unsorted; }
+
+    StepperInput make_stepper_input(size_type chunk_size)
+    {
+        StepperInput result;
+        result.params = this->core();
+        result.stream_id = StreamId{0};
+        result.num_track_slots = 64;
+        result.fused_chunk_size = chunk_size;
+        return result;
+    }
+
+    std::vector<Primary> make_primaries(size_type count) const
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        CELER_ASSERT(p.particle_id);
+        p.track_id = TrackId{0};
+        p.position = {0, 0, 0};
+        p.time = 0;
+
+        std::vector<Primary> result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{i};
+            result[i].energy = units::MevEnergy{10.0 / (1 + i % 4)};
+            result[i].direction = {i % 2 ? 1.0 : -1.0, 0, 0};
+        }
+        return result;
+    }
+
+    // Step both steppers and check that their states are identical
+    void compare_steps(HostStepper& expected, HostStepper& actual) const
+    {
+        auto primaries = this->make_primaries(48);
+        auto exp_counts = expected(make_span(primaries));
+        auto act_counts = actual(make_span(primaries));
+
+        for (size_type i = 0; i < 16 && exp_counts; ++i)
+        {
+            EXPECT_EQ(exp_counts.active, act_counts.active) << "step " << i;
+            EXPECT_EQ(exp_counts.alive, act_counts.alive) << "step " << i;
+            EXPECT_EQ(exp_counts.queued, act_counts.queued) << "step " << i;
+
+            auto const& exp_state = expected.core_data().states;
+            auto const& act_state = actual.core_data().states;
+            for (auto slot : range(TrackSlotId{exp_state.size()}))
+            {
+                EXPECT_EQ(exp_state.sim.status[slot],
+                          act_state.sim.status[slot]);
+                EXPECT_EQ(exp_state.particles.state[slot].energy,
+                          act_state.particles.state[slot].energy);
+                EXPECT_EQ(exp_state.sim.step_limit[slot].action,
+                          act_state.sim.step_limit[slot].action);
+            }
+
+            exp_counts = expected();
+            act_counts = actual();
+        }
+    }
+};
+
+class ActionSequenceSortTest : public ActionSequenceTest
+{
+    TrackOrder track_order() const override
+    {
+        return TrackOrder::sort_step_limit_action;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ActionSequenceTest, fused)
+{
+    HostStepper unfused(this->make_stepper_input(0));
+    EXPECT_FALSE(unfused.actions().fused());
+
+    // Use a chunk size that doesn't evenly divide the number of tracks
+    HostStepper fused(this->make_stepper_input(7));
+    EXPECT_TRUE(fused.actions().fused());
+
+    this->compare_steps(unfused, fused);
+
+    // Every action has been timed
+    for (double t : fused.actions().accum_time())
+    {
+        EXPECT_LE(0, t);
+    }
+}
+
+TEST_F(ActionSequenceSortTest, fused)
+{
+    // Post-step actions are restricted to their partition within each chunk
+    HostStepper unfused(this->make_stepper_input(0));
+    HostStepper fused(this->make_stepper_input(5));
+    this->compare_steps(unfused, fused);
+}
+
+TEST_F(ActionSequenceSortTest, profile)
+{
+    auto input = this->make_stepper_input(0);
+    input.profile = true;
+    HostStepper step(std::move(input));
+    auto const& profiler = step.actions().profiler();
+    ASSERT_TRUE(profiler);
+
+    auto primaries = this->make_primaries(48);
+    auto counts = step(make_span(primaries));
+    size_type num_steps = 1;
+    size_type num_active = counts.active;
+    while (counts && num_steps < 16)
+    {
+        counts = step();
+        ++num_steps;
+        num_active += counts.active;
+    }
+
+    auto const& actions = step.actions().actions();
+    auto const& results = profiler->results();
+    ASSERT_EQ(actions.size(), results.size());
+
+    size_type num_post_tracks = 0;
+    for (auto i : range(results.size()))
+    {
+        auto const& r = results[i];
+        EXPECT_EQ(num_steps, r.num_calls) << actions[i]->label();
+        EXPECT_EQ(ActionProfiler::bin_edges().size() + 1, r.time_hist.size());
+        EXPECT_EQ(r.num_calls,
+                  std::accumulate(
+                      r.time_hist.begin(), r.time_hist.end(), size_type{0}));
+        EXPECT_LE(0, r.time);
+        if (actions[i]->order() == ActionOrder::post)
+        {
+            // Post-step actions only see their own partition of tracks
+            EXPECT_GE(num_active, r.num_tracks) << actions[i]->label();
+            num_post_tracks += r.num_tracks;
+        }
+        else
+        {
+            // Other actions count the tracks active at the start of the step
+            EXPECT_EQ(num_active, r.num_tracks) << actions[i]->label();
+        }
+    }
+    EXPECT_LT(0, num_post_tracks);
+    EXPECT_GE(num_active, num_post_tracks);
+    EXPECT_GT(num_steps * 64, num_active);
+
+    if (CELERITAS_USE_JSON)
+    {
+        std::ostringstream os;
+        this->write_output(os);
+        EXPECT_NE(std::string::npos, os.str().find("\"action-profile\""));
+        EXPECT_NE(std::string::npos, os.str().find("\"time_hist\""));
+    }
+
+    // Another stepper on the same stream replaces the profile
+    auto const& profiles = *this->core()->action_profiles();
+    auto first_profile = profiles.get(StreamId{0});
+    ASSERT_TRUE(first_profile);
+    input = this->make_stepper_input(0);
+    input.profile = true;
+    HostStepper other(std::move(input));
+    EXPECT_TRUE(profiles.get(StreamId{0}));
+    EXPECT_NE(first_profile, profiles.get(StreamId{0}));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
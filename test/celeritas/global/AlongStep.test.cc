@@ -11,9 +11,11 @@
 #include "celeritas/ext/GeantPhysicsOptions.hh"
 #include "celeritas/field/UniformFieldData.hh"
 #include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/WoodcockParams.hh"
 
 #include "../MockTestBase.hh"
 #include "../SimpleTestBase.hh"
@@ -32,6 +34,30 @@ class KnAlongStepTest : public SimpleTestBase, public AlongStepTestBase
 {
 };
 
+class KnWoodcockAlongStepTest : public SimpleTestBase,
+                                public AlongStepTestBase
+{
+  public:
+    SPConstAction build_along_step() override
+    {
+        auto& action_reg = *this->action_reg();
+        auto woodcock = std::make_shared<WoodcockParams>(*this->particle(),
+                                                         *this->material(),
+                                                         *this->geomaterial(),
+                                                         *this->physics());
+        auto result = AlongStepGeneralLinearAction::from_params(
+            action_reg.next_id(),
+            *this->material(),
+            *this->particle(),
+            nullptr,
+            false,
+            woodcock);
+        CELER_ASSERT(result->has_woodcock());
+        action_reg.insert(result);
+        return result;
+    }
+};
+
 class MockAlongStepTest : public MockTestBase, public AlongStepTestBase
 {
 };
@@ -131,6 +157,60 @@ TEST_F(KnAlongStepTest, basic)
     }
 }
 
+TEST_F(KnWoodcockAlongStepTest, basic)
+{
+    size_type num_tracks = 128;
+    Input inp;
+    inp.particle_id = this->particle()->find(pdg::gamma());
+    {
+        SCOPED_TRACE("collision inside the inner box");
+        inp.energy = MevEnergy{1e-3};
+        inp.phys_mfp = 0.1;
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(0, result.eloss);
+        EXPECT_SOFT_EQ(0.0099999000010000168, result.displacement);
+        EXPECT_SOFT_EQ(1, result.angle);
+        EXPECT_SOFT_EQ(3.3356075959055596e-13, result.time);
+        EXPECT_SOFT_EQ(0.0099999000010000168, result.step);
+        EXPECT_SOFT_EQ(1, result.alive);
+        // Collisions are real since the cross section is the majorant
+        EXPECT_EQ("physics-discrete-select", result.action);
+    }
+    inp.energy = MevEnergy{10};
+    {
+        SCOPED_TRACE("collision near the inner box boundary");
+        inp.phys_mfp = 1;
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(0.099999000009999645, result.displacement);
+        EXPECT_SOFT_EQ(3.3356075959055682e-12, result.time);
+        EXPECT_SOFT_EQ(0.099999000009999645, result.step);
+        EXPECT_SOFT_EQ(1, result.mfp);
+        EXPECT_SOFT_EQ(1, result.alive);
+        EXPECT_EQ("physics-integral-rejected", result.action);
+    }
+    {
+        SCOPED_TRACE("collision in the world volume");
+        inp.phys_mfp = 100;
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(9.9999000010000092, result.displacement);
+        EXPECT_SOFT_EQ(3.3356075959055553e-10, result.time);
+        EXPECT_SOFT_EQ(9.9999000010000092, result.step);
+        EXPECT_SOFT_EQ(100, result.mfp);
+        EXPECT_SOFT_EQ(1, result.alive);
+        EXPECT_EQ("physics-integral-rejected", result.action);
+    }
+    {
+        SCOPED_TRACE("collision outside the world");
+        inp.phys_mfp = 1000;
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(99.99900001000006, result.displacement);
+        EXPECT_SOFT_EQ(3.335607595905558e-09, result.time);
+        EXPECT_SOFT_EQ(99.99900001000006, result.step);
+        EXPECT_SOFT_EQ(1, result.alive);
+        EXPECT_EQ("geo-boundary", result.action);
+    }
+}
+
 TEST_F(MockAlongStepTest, basic)
 {
     size_type num_tracks = 10;
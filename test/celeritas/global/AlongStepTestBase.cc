@@ -135,6 +135,7 @@ auto AlongStepTestBase::run(Input const& inp, size_type num_tracks) -> RunResult
                                  << "\": " << kv.second * norm;
                           })
            << '}';
+        result.action = os.str();
     }
 
     return result;
@@ -0,0 +1,138 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/StepperDiagnostics.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/StepperDiagnostics.hh"
+
+#include <vector>
+
+#include "celeritas_config.h"
+#include "corecel/io/MultiStreamOutput.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/Stepper.hh"
+
+#include "../SimpleTestBase.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class StepperDiagnosticsTest : public Test
+{
+  protected:
+    // Record a step with a given number of active tracks
+    static void record(StepperDiagnostics& diag, size_type active)
+    {
+        StepperResult result;
+        result.active = active;
+        result.alive = active / 2;
+        result.queued = 2 * active;
+        result.secondaries = active / 4;
+        diag.record(result, 0.5);
+    }
+
+    // Get the sampled step indices
+    static std::vector<size_type> steps(StepperDiagnostics const& diag)
+    {
+        std::vector<size_type> result;
+        for (auto const& s : diag.samples())
+        {
+            result.push_back(s.step);
+        }
+        return result;
+    }
+};
+
+TEST_F(StepperDiagnosticsTest, unlimited)
+{
+    StepperDiagnostics diag(16, "stepper-diagnostics");
+    EXPECT_EQ("stepper-diagnostics", diag.label());
+    for (size_type active : {16, 12, 8})
+    {
+        this->record(diag, active);
+    }
+
+    EXPECT_EQ(3, diag.num_steps());
+    EXPECT_EQ(1, diag.stride());
+    EXPECT_EQ(36, diag.num_track_steps());
+    EXPECT_DOUBLE_EQ(1.5, diag.time());
+    ASSERT_EQ(3, diag.samples().size());
+    EXPECT_EQ(12, diag.samples()[1].active);
+    EXPECT_EQ(6, diag.samples()[1].alive);
+    EXPECT_EQ(24, diag.samples()[1].queued);
+    EXPECT_EQ(3, diag.samples()[1].secondaries);
+
+    if (CELERITAS_USE_JSON)
+    {
+        EXPECT_EQ(
+            R"json({"num_steps":3,"num_track_slots":16,"num_track_steps":36,"steps":{"active":[16,12,8],"alive":[8,6,4],"occupancy":[1.0,0.75,0.5],"queued":[32,24,16],"secondaries":[4,3,2],"step":[0,1,2],"throughput":[32.0,24.0,16.0],"time":[0.5,0.5,0.5]},"stride":1,"throughput":24.0,"time":1.5})json",
+            to_string(diag))
+            << "\n/*** REPLACE ***/\nR\"json(" << to_string(diag)
+            << ")json\"\n/******/";
+    }
+}
+
+TEST_F(StepperDiagnosticsTest, downsample)
+{
+    StepperDiagnostics diag(16, "diag", 4);
+    for (size_type i = 0; i < 3; ++i)
+    {
+        this->record(diag, 16);
+    }
+    EXPECT_EQ((std::vector<size_type>{0, 1, 2}), steps(diag));
+    EXPECT_EQ(1, diag.stride());
+
+    // Reaching the limit discards every other sample
+    this->record(diag, 16);
+    EXPECT_EQ((std::vector<size_type>{0, 2}), steps(diag));
+    EXPECT_EQ(2, diag.stride());
+
+    for (size_type i = 0; i < 8; ++i)
+    {
+        this->record(diag, 16);
+    }
+    EXPECT_EQ(12, diag.num_steps());
+    EXPECT_EQ(12 * 16, diag.num_track_steps());
+    EXPECT_EQ((std::vector<size_type>{0, 4, 8}), steps(diag));
+    EXPECT_EQ(4, diag.stride());
+
+    // Invalid limit
+    EXPECT_THROW(StepperDiagnostics(16, "bad", 1), RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+
+class KnStepperDiagnosticsTest : public SimpleTestBase
+{
+};
+
+TEST_F(KnStepperDiagnosticsTest, output)
+{
+    StepperInput inp;
+    inp.params = this->core();
+    inp.stream_id = StreamId{0};
+    inp.num_track_slots = 16;
+    inp.diagnostics = true;
+
+    auto const& outputs = *this->core()->stepper_diagnostics();
+    EXPECT_FALSE(outputs.get(StreamId{0}));
+
+    Stepper<MemSpace::host> step(inp);
+    ASSERT_TRUE(step.diagnostics());
+    EXPECT_EQ(step.diagnostics(), outputs.get(StreamId{0}));
+
+    // Another stepper on the same stream replaces the output
+    Stepper<MemSpace::host> other(inp);
+    EXPECT_EQ(other.diagnostics(), outputs.get(StreamId{0}));
+    EXPECT_NE(step.diagnostics(), outputs.get(StreamId{0}));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
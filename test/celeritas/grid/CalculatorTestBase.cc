@@ -42,7 +42,8 @@ void CalculatorTestBase::build(real_type emin, real_type emax, size_type count)
     value_ref_ = value_storage_;
 
     CELER_ENSURE(data_);
-    CELER_ENSURE(soft_equal(emax, value_ref_[data_.value].back()));
+    CELER_ENSURE(soft_equal(static_cast<table_real_type>(emax),
+                            value_ref_[data_.value].back()));
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,151 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/grid/FusedXsCalculator.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/grid/FusedXsCalculator.hh"
+
+#include <cmath>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/grid/UniformGrid.hh"
+#include "celeritas/grid/XsCalculator.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class FusedXsCalculatorTest : public Test
+{
+  protected:
+    using Energy = FusedXsCalculator::Energy;
+    using Values
+        = Collection<table_real_type, Ownership::value, MemSpace::host>;
+    using Indices = Collection<size_type, Ownership::value, MemSpace::host>;
+    using RefValues = Collection<table_real_type,
+                                 Ownership::const_reference,
+                                 MemSpace::host>;
+    using RefIndices
+        = Collection<size_type, Ownership::const_reference, MemSpace::host>;
+
+    void SetUp() override
+    {
+        // Energy from 0.1 to 1e4 MeV with 6 grid points
+        auto loge = UniformGridData::from_bounds(
+            std::log(real_type(0.1)), std::log(real_type(1e4)), 6);
+        UniformGrid const grid(loge);
+        std::vector<real_type> energy(grid.size());
+        for (auto i : range(grid.size()))
+        {
+            energy[i] = std::exp(grid[i]);
+        }
+
+        // Process 0: xs = E, unscaled
+        // Process 1: xs = 3 (stored as 3 * E above the prime index)
+        // Process 2: xs = {1, 10, 1, 10, 1, 10}, scaled at the last point
+        std::vector<real_type> xs[3];
+        for (auto i : range(grid.size()))
+        {
+            xs[0].push_back(energy[i]);
+            xs[1].push_back(i < 3 ? 3 : 3 * energy[i]);
+            xs[2].push_back((i % 2 ? 10 : 1) * (i < 5 ? 1 : energy[i]));
+        }
+        size_type const primes[] = {XsGridData::no_scaling(), 3, 5};
+
+        // Build separate grids and the fused grid
+        auto build_reals = make_builder(&reals_);
+        for (auto p : range(3))
+        {
+            XsGridData& data = grids_[p];
+            data.log_energy = loge;
+            data.prime_index = primes[p];
+            data.value = build_reals.insert_back(xs[p].begin(), xs[p].end());
+        }
+
+        std::vector<real_type> values;
+        for (auto i : range(grid.size()))
+        {
+            for (auto p : range(3))
+            {
+                real_type v = xs[p][i];
+                if (i >= primes[p])
+                {
+                    v /= energy[i];
+                }
+                values.push_back(v);
+            }
+        }
+        fused_.log_energy = loge;
+        fused_.energy = build_reals.insert_back(energy.begin(), energy.end());
+        fused_.value = build_reals.insert_back(values.begin(), values.end());
+        fused_.prime_index
+            = make_builder(&indices_).insert_back(primes, primes + 3);
+        ASSERT_TRUE(fused_);
+
+        reals_ref_ = reals_;
+        indices_ref_ = indices_;
+    }
+
+    Values reals_;
+    Indices indices_;
+    RefValues reals_ref_;
+    RefIndices indices_ref_;
+    XsGridData grids_[3];
+    FusedXsGridData fused_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(FusedXsCalculatorTest, simple)
+{
+    {
+        FusedXsCalculator calc(fused_, reals_ref_, indices_ref_, Energy{1});
+        EXPECT_SOFT_EQ(1, calc(0));
+        EXPECT_SOFT_EQ(3, calc(1));
+        EXPECT_SOFT_EQ(10, calc(2));
+    }
+    {
+        FusedXsCalculator calc(fused_, reals_ref_, indices_ref_, Energy{5});
+        EXPECT_SOFT_EQ(5, calc(0));
+        EXPECT_SOFT_EQ(3, calc(1));
+        EXPECT_SOFT_EQ(6, calc(2));
+    }
+    {
+        // Out of bounds
+        FusedXsCalculator calc(fused_, reals_ref_, indices_ref_, Energy{1e5});
+        EXPECT_SOFT_EQ(1e4, calc(0));
+        EXPECT_SOFT_EQ(0.3, calc(1));
+        EXPECT_SOFT_EQ(1, calc(2));
+    }
+}
+
+TEST_F(FusedXsCalculatorTest, consistency)
+{
+    // Cross sections should match the individual calculators
+    for (real_type e : {1e-3, 0.1, 0.2, 1.0, 5.0, 123.4, 1e3, 9e3, 1e4, 1e5})
+    {
+        FusedXsCalculator calc(fused_, reals_ref_, indices_ref_, Energy{e});
+        for (auto p : range(3))
+        {
+            XsCalculator calc_xs(grids_[p], reals_ref_);
+            EXPECT_SOFT_EQ(calc_xs(Energy{e}), calc(p))
+                << "for process " << p << " at " << e << " MeV";
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -30,13 +30,13 @@ class InverseRangeCalculatorTest : public CalculatorTestBase
 
         // InverseRange is 1/20 of energy
         auto value_span = this->mutable_values();
-        for (real_type& xs : value_span)
+        for (table_real_type& xs : value_span)
         {
             xs *= .05;
         }
 
         // Adjust final point for roundoff for exact top-of-range testing
-        CELER_ASSERT(soft_equal(real_type(500), value_span.back()));
+        CELER_ASSERT(soft_equal(table_real_type(500), value_span.back()));
         value_span.back() = 500;
     }
 };
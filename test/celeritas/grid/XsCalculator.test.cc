@@ -101,7 +101,7 @@ TEST_F(XsCalculatorTest, scaled_middle)
     std::fill(xs.begin(), xs.begin() + 3, 1.0);
 
     // Change constant to 3 just to shake things up
-    for (real_type& x : xs)
+    for (table_real_type& x : xs)
     {
         x *= 3;
     }
@@ -195,6 +195,43 @@ TEST_F(CutoffParamsTest, apply_post_interaction)
     EXPECT_FALSE(cutoffs.apply(secondary));
     secondary.energy = Energy{1};
     EXPECT_TRUE(cutoffs.apply(secondary));
+
+    // Empty secondaries are never cut
+    EXPECT_FALSE(cutoffs.apply(Secondary{}));
+}
+
+TEST_F(CutoffParamsTest, apply_without_positron)
+{
+    // Without positrons the positron ID is invalid, like the particle ID of an
+    // empty secondary
+    ParticleParams::Input p_input;
+    p_input.push_back({"electron",
+                       pdg::electron(),
+                       units::MevMass{0.5109989461},
+                       units::ElementaryCharge{-1},
+                       ParticleRecord::stable_decay_constant()});
+    p_input.push_back({"gamma",
+                       pdg::gamma(),
+                       zero_quantity(),
+                       zero_quantity(),
+                       ParticleRecord::stable_decay_constant()});
+
+    CutoffParams::Input input;
+    input.materials = materials;
+    input.particles = std::make_shared<ParticleParams>(std::move(p_input));
+    input.cutoffs.insert({pdg::electron(), {{Energy{6}, 0.6}, {}, {}}});
+    input.cutoffs.insert({pdg::gamma(), {{Energy{4}, 0.4}, {}, {}}});
+    input.apply_post_interaction = true;
+    CutoffParams cutoff(input);
+
+    CutoffView cutoffs(cutoff.host_ref(), MaterialId{0});
+    Secondary secondary;
+    EXPECT_FALSE(secondary);
+    EXPECT_FALSE(cutoffs.apply(secondary));
+
+    secondary.particle_id = input.particles->find(pdg::gamma());
+    secondary.energy = Energy{3};
+    EXPECT_TRUE(cutoffs.apply(secondary));
 }
 
 //---------------------------------------------------------------------------//
@@ -444,5 +444,68 @@ TEST_F(StepLimiterTest, calc_physics_step_limit)
     }
 }
 //---------------------------------------------------------------------------//
+
+class FusedXsTest : public PhysicsStepUtilsTest
+{
+    PhysicsOptions build_physics_options() const override
+    {
+        PhysicsOptions opts;
+        opts.fused_xs = true;
+        return opts;
+    }
+};
+
+TEST_F(FusedXsTest, calc_physics_step_limit)
+{
+    MaterialTrackView material(
+        this->material()->host_ref(), mat_state.ref(), TrackSlotId{0});
+    ParticleTrackView particle(
+        this->particle()->host_ref(), par_state.ref(), TrackSlotId{0});
+    PhysicsStepView pstep = this->step_view();
+
+    for (char const* name :
+         {"gamma", "celeriton", "anti-celeriton", "electron"})
+    {
+        for (auto mid : range(MaterialId{this->material()->size()}))
+        {
+            PhysicsTrackView phys = this->init_track(
+                &material, mid, &particle, name, MevEnergy{1});
+            EXPECT_TRUE(phys.fused_xs_grid());
+
+            for (real_type e : {1e-7, 1e-5, 2e-3, 0.5, 1.0, 3.0, 10.0, 1e3})
+            {
+                particle.energy(MevEnergy{e});
+                phys.interaction_mfp(1);
+                calc_physics_step_limit(material, particle, phys, pstep);
+
+                // Compare against the per-process cross sections
+                real_type total_xs = 0;
+                for (auto ppid :
+                     range(ParticleProcessId{phys.num_particle_processes()}))
+                {
+                    real_type expected;
+                    auto mat_view = material.make_material_view();
+                    if (auto const& process = phys.integral_xs_process(ppid))
+                    {
+                        expected = phys.calc_max_xs(
+                            process, ppid, mat_view, particle.energy());
+                    }
+                    else
+                    {
+                        expected
+                            = phys.calc_xs(ppid, mat_view, particle.energy());
+                    }
+                    EXPECT_SOFT_EQ(expected, pstep.per_process_xs(ppid))
+                        << "for " << name << " process " << ppid.get()
+                        << " in material " << mid.get() << " at " << e
+                        << " MeV";
+                    total_xs += expected;
+                }
+                EXPECT_SOFT_EQ(total_xs, pstep.macro_xs());
+            }
+        }
+    }
+}
+//---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
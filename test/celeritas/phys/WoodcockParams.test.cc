@@ -0,0 +1,158 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/WoodcockParams.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/phys/WoodcockParams.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "corecel/grid/UniformGrid.hh"
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/grid/XsCalculator.hh"
+#include "celeritas/mat/MaterialParams.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/PhysicsParams.hh"
+#include "celeritas/phys/PhysicsTrackView.hh"
+
+#include "../SimpleTestBase.hh"
+#include "../TestEm3Base.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+struct MajorantResult
+{
+    size_type num_majorants{0};
+    size_type num_samples{0};
+    real_type max_ratio{0};  //!< Largest total cross section over majorant
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compare the majorant to the total cross sections at many energies.
+ */
+MajorantResult check_majorant(GlobalTestBase& test)
+{
+    using Energy = PhysicsTrackView::Energy;
+
+    WoodcockParams woodcock(*test.particle(),
+                            *test.material(),
+                            *test.geomaterial(),
+                            *test.physics());
+    auto const& data = woodcock.host_ref();
+
+    // Materials present in the geometry
+    std::vector<MaterialId> mat_ids;
+    {
+        auto const& vol_mats = test.geomaterial()->host_ref().materials;
+        for (auto vol_id : range(VolumeId{vol_mats.size()}))
+        {
+            if (auto mat_id = vol_mats[vol_id])
+            {
+                mat_ids.push_back(mat_id);
+            }
+        }
+    }
+
+    auto const& phys_ref = test.physics()->host_ref();
+    CollectionStateStore<PhysicsStateData, MemSpace::host> phys_state(
+        phys_ref, 1);
+
+    // Sample several points inside each majorant cell
+    constexpr size_type num_cell_samples = 8;
+
+    MajorantResult result;
+    for (auto par_id : range(ParticleId{test.particle()->size()}))
+    {
+        XsGridData const& grid = data.majorant[par_id];
+        if (!grid)
+        {
+            continue;
+        }
+        ++result.num_majorants;
+        XsCalculator calc_majorant(grid, data.reals);
+        UniformGrid loge_grid(grid.log_energy);
+
+        for (auto mat_id : mat_ids)
+        {
+            PhysicsTrackView phys(
+                phys_ref, phys_state.ref(), par_id, mat_id, TrackSlotId{0});
+            auto const mat_view = test.material()->get(mat_id);
+            for (auto i : range(loge_grid.size() - 1))
+            {
+                for (auto j : range(num_cell_samples))
+                {
+                    Energy energy{std::exp(loge_grid[i]
+                                           + grid.log_energy.delta * (j + 0.5)
+                                                 / num_cell_samples)};
+                    real_type total_xs = 0;
+                    for (auto ppid : range(ParticleProcessId{
+                             phys.num_particle_processes()}))
+                    {
+                        total_xs += phys.calc_xs(ppid, mat_view, energy);
+                    }
+                    real_type majorant = calc_majorant(energy);
+                    EXPECT_LE(total_xs, majorant)
+                        << "at E=" << energy.value() << " MeV";
+                    result.max_ratio
+                        = std::max(result.max_ratio, total_xs / majorant);
+                    ++result.num_samples;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+class WoodcockParamsTest : public SimpleTestBase
+{
+};
+
+#define TestEm3WoodcockParamsTest \
+    TEST_IF_CELERITAS_GEANT(TestEm3WoodcockParamsTest)
+class TestEm3WoodcockParamsTest : public TestEm3Base
+{
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(WoodcockParamsTest, majorant)
+{
+    auto result = check_majorant(*this);
+    EXPECT_EQ(1, result.num_majorants);
+    EXPECT_GT(result.num_samples, 0);
+    EXPECT_LE(result.max_ratio, 1);
+    // The majorant is tight where the cross section is tabulated
+    EXPECT_GT(result.max_ratio, 0.99);
+}
+
+//---------------------------------------------------------------------------//
+// Includes the on-the-fly Livermore photoelectric cross sections
+TEST_F(TestEm3WoodcockParamsTest, majorant)
+{
+    auto result = check_majorant(*this);
+    EXPECT_EQ(1, result.num_majorants);
+    EXPECT_GT(result.num_samples, 0);
+    EXPECT_LE(result.max_ratio, 1);
+    EXPECT_GT(result.max_ratio, 0.9);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
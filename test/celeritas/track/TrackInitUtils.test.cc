@@ -0,0 +1,467 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/TrackInitUtils.test.cc
+//---------------------------------------------------------------------------//
+#include <map>
+#include <set>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/Constants.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/Units.hh"
+#include "celeritas/em/process/EPlusAnnihilationProcess.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/mat/MaterialParams.hh"
+#include "celeritas/phys/CutoffParams.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/track/TrackInitData.hh"
+#include "celeritas/track/TrackInitParams.hh"
+#include "celeritas/track/detail/TrackInitBacklog.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TrackInitBacklogTest : public ::celeritas::test::Test
+{
+  protected:
+    using VecInit = std::vector<TrackInitializer>;
+
+    void SetUp() override
+    {
+        TrackInitParams::Input input;
+        input.capacity = 8;
+        input.max_events = 1;
+        TrackInitParams params(input);
+        resize(&state_, params.host_ref(), /* num_track_slots = */ 4);
+        ref_ = state_;
+    }
+
+    //! Add pending initializers labeled with sequential track IDs
+    void push_initializers(size_type count)
+    {
+        auto& inits = ref_.initializers;
+        size_type start = inits.size();
+        inits.resize(start + count);
+        for (auto i : range(start, inits.size()))
+        {
+            inits[i].sim.track_id = TrackId{next_id_++};
+        }
+    }
+
+    //! Get the track IDs of a vector of initializers
+    template<class C>
+    static std::vector<int> track_ids(C const& inits)
+    {
+        std::vector<int> result;
+        for (TrackInitializer const& init : inits)
+        {
+            result.push_back(init.sim.track_id.unchecked_get());
+        }
+        return result;
+    }
+
+    HostVal<TrackInitStateData> state_;
+    HostRef<TrackInitStateData> ref_;
+    TrackId::size_type next_id_{0};
+};
+
+class TrackInitTailTest : public SimpleTestBase
+{
+  protected:
+    SPConstCutoff build_cutoff() override
+    {
+        // Kill electrons (which have no physics) as they're produced
+        CutoffParams::Input input;
+        input.materials = this->material();
+        input.particles = this->particle();
+        input.cutoffs = {
+            {pdg::electron(),
+             {{units::MevEnergy{1000}, 1000 * units::centimeter},
+              {units::MevEnergy{1000}, 1000 * units::centimeter}}},
+        };
+        input.apply_post_interaction = true;
+        return std::make_shared<CutoffParams>(std::move(input));
+    }
+
+    std::vector<Primary> make_primaries(size_type count) const
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        CELER_ASSERT(p.particle_id);
+        p.energy = units::MevEnergy{10};
+        p.position = {0, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time = 0;
+
+        std::vector<Primary> result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{0};
+            result[i].track_id = TrackId{i};
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+class TrackInitTailSecondaryTest : public TrackInitTailTest
+{
+  protected:
+    using ParentMap = std::map<TrackId, TrackId>;
+
+    //! Add positrons, which annihilate into gammas that are transported
+    SPConstParticle build_particle() override
+    {
+        using namespace ::celeritas::units;
+        ParticleParams::Input defs;
+        defs.push_back({"gamma",
+                        pdg::gamma(),
+                        zero_quantity(),
+                        zero_quantity(),
+                        ParticleRecord::stable_decay_constant()});
+        defs.push_back({"electron",
+                        pdg::electron(),
+                        MevMass{0.5},
+                        ElementaryCharge{-1},
+                        ParticleRecord::stable_decay_constant()});
+        defs.push_back({"positron",
+                        pdg::positron(),
+                        MevMass{0.5},
+                        ElementaryCharge{1},
+                        ParticleRecord::stable_decay_constant()});
+        return std::make_shared<ParticleParams>(std::move(defs));
+    }
+
+    VecProcess build_processes() override
+    {
+        auto result = SimpleTestBase::build_processes();
+        EPlusAnnihilationProcess::Options options;
+        options.use_integral_xs = false;
+        result.push_back(std::make_shared<EPlusAnnihilationProcess>(
+            this->particle(), options));
+        return result;
+    }
+
+    //! Replace the vacuum with a very thin gas so positrons can cross it
+    SPConstMaterial build_material() override
+    {
+        using namespace units;
+
+        MaterialParams::Input inp;
+        inp.elements = {{AtomicNumber{13}, AmuMass{27}, "Al"}};
+        inp.materials = {{2.7 * constants::na_avogadro / 27,
+                          293.0,
+                          MatterState::solid,
+                          {{ElementId{0}, 1.0}},
+                          "Al"},
+                         {1e-12 * constants::na_avogadro / 27,
+                          293.0,
+                          MatterState::gas,
+                          {{ElementId{0}, 1.0}},
+                          "thin Al"}};
+        return std::make_shared<MaterialParams>(std::move(inp));
+    }
+
+    //! Create low-energy positrons heading toward the center
+    std::vector<Primary> make_positrons(size_type count, Real3 pos) const
+    {
+        auto result = this->make_primaries(count);
+        for (Primary& p : result)
+        {
+            p.particle_id = this->particle()->find(pdg::positron());
+            p.energy = units::MevEnergy{0.001};
+            p.position = pos;
+            p.direction = {pos[0] > 0 ? real_type{-1} : real_type{1}, 0, 0};
+        }
+        return result;
+    }
+
+    //! Step until the state is empty, recording track and parent IDs
+    template<class S>
+    static StepperResult
+    transport(S& stepper, StepperResult counts, ParentMap* parents)
+    {
+        for (size_type i = 0; i < 10000 && counts; ++i)
+        {
+            append_alive(stepper, parents);
+            counts = stepper();
+        }
+        return counts;
+    }
+
+    //! Get the track and parent IDs of the alive tracks
+    template<class S>
+    static void
+    append_alive(S const& stepper, ParentMap* parents)
+    {
+        auto const& sim = stepper.core_data().states.sim;
+        for (auto tid : range(TrackSlotId{sim.size()}))
+        {
+            if (sim.status[tid] == TrackStatus::alive)
+            {
+                (*parents)[sim.track_ids[tid]] = sim.parent_ids[tid];
+            }
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackInitBacklogTest, spill_and_reload)
+{
+    VecInit backlog;
+
+    // Six pending initializers plus five new secondaries: spill three
+    this->push_initializers(6);
+    ref_.vacancies.resize(0);
+    ref_.num_secondaries = 5;
+    detail::exchange_backlog(ref_, &backlog);
+    EXPECT_EQ(3, ref_.initializers.size());
+    EXPECT_EQ(3, ref_.num_backlog);
+    static int const expected_backlog[] = {3, 4, 5};
+    EXPECT_VEC_EQ(expected_backlog, track_ids(backlog));
+
+    // New secondaries fill the remaining capacity
+    this->push_initializers(5);
+    EXPECT_EQ(8, ref_.initializers.size());
+
+    // Everything fits but there are no vacancies: nothing is reloaded
+    ref_.num_secondaries = 0;
+    detail::exchange_backlog(ref_, &backlog);
+    EXPECT_EQ(8, ref_.initializers.size());
+    EXPECT_EQ(3, backlog.size());
+
+    // All but one initializer are consumed and all four slots are empty: one
+    // new secondary plus the pending initializer leave room for two
+    ref_.initializers.resize(1);
+    ref_.vacancies.resize(4);
+    ref_.num_secondaries = 1;
+    detail::exchange_backlog(ref_, &backlog);
+    EXPECT_EQ(1, ref_.num_backlog);
+    static int const expected_inits[] = {0, 4, 5};
+    EXPECT_VEC_EQ(expected_inits, track_ids(ref_.initializers.data()));
+    static int const expected_remaining[] = {3};
+    EXPECT_VEC_EQ(expected_remaining, track_ids(backlog));
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackInitTailTest, host)
+{
+    size_type const num_slots = 64;
+    StepperInput input{this->core(), StreamId{0}, num_slots};
+    input.min_active_fraction = 0.25;
+    Stepper<MemSpace::host> step(input);
+
+    auto primaries = this->make_primaries(32);
+    auto counts = step(make_span(primaries));
+    size_type num_tail = counts.tail;
+    {
+        auto by_event = step.count_tracks_by_event();
+        ASSERT_EQ(this->init()->max_events(), by_event.size());
+        EXPECT_EQ(counts.alive + counts.queued, by_event.front());
+        EXPECT_EQ(0, by_event.back());
+    }
+    for (size_type i = 0; i < 1000 && counts; ++i)
+    {
+        // Tracks are only extracted when the state is nearly empty
+        if (counts.alive > 0)
+        {
+            EXPECT_GE(counts.alive + counts.queued, num_slots / 4);
+        }
+        counts = step();
+        num_tail += counts.tail;
+    }
+    EXPECT_FALSE(counts);
+
+    auto tail = step.release_tail();
+    EXPECT_EQ(num_tail, tail.tracks.size());
+    EXPECT_GT(tail.tracks.size(), 0);
+    EXPECT_LT(tail.tracks.size(), num_slots / 4);
+    EXPECT_TRUE(step.release_tail().tracks.empty());
+    ASSERT_EQ(this->init()->max_events(), tail.track_counters.size());
+    EXPECT_EQ(32, tail.track_counters.front());
+    for (TrackInitializer const& init : tail.tracks)
+    {
+        EXPECT_TRUE(init.particle.particle_id);
+        EXPECT_EQ(EventId{0}, init.sim.event_id);
+        EXPECT_LT(init.sim.track_id.get(), 32);
+        EXPECT_FALSE(init.sim.parent_id);
+        EXPECT_LT(init.particle.energy.value(), 10);
+    }
+
+    // All track slots are vacant and inactive
+    auto const& states = step.core_data().states;
+    EXPECT_EQ(num_slots, states.init.vacancies.size());
+    for (auto tid : range(TrackSlotId{num_slots}))
+    {
+        EXPECT_EQ(TrackStatus::inactive, states.sim.status[tid]);
+    }
+
+    // Continue transporting the tail in a smaller state
+    Stepper<MemSpace::host> tail_step(
+        {this->core(), StreamId{0}, num_slots / 4});
+    tail_step.insert_tail(tail);
+    counts = tail_step();
+    EXPECT_EQ(tail.tracks.size(), counts.active);
+    for (size_type i = 0; i < 8 && counts; ++i)
+    {
+        counts = tail_step();
+        EXPECT_EQ(0, counts.tail);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackInitTailSecondaryTest, separate_backlogs)
+{
+    // Two steppers on the same stream each own their backlog
+    StepperInput input{this->core(), StreamId{0}, /* num_track_slots = */ 8};
+    Stepper<MemSpace::host> step(input);
+    Stepper<MemSpace::host> other(input);
+    auto const* backlog = step.core_data().states.init.backlog;
+    auto const* other_backlog = other.core_data().states.init.backlog;
+    ASSERT_TRUE(backlog);
+    ASSERT_TRUE(other_backlog);
+    EXPECT_NE(backlog, other_backlog);
+
+    // Moving a stepper keeps its backlog
+    Stepper<MemSpace::host> moved(std::move(step));
+    EXPECT_EQ(backlog, moved.core_data().states.init.backlog);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackInitTailSecondaryTest, extracted_secondaries)
+{
+    size_type const num_slots = 64;
+    StepperInput input{this->core(), StreamId{0}, num_slots};
+    input.min_active_fraction = 0.25;
+    Stepper<MemSpace::host> step(input);
+
+    // Positrons annihilate immediately: transport the gammas in the main
+    // stepper until the tail is extracted
+    ParentMap main_parents;
+    auto primaries = this->make_positrons(32, {4.5, 0, 0});
+    auto counts = step(make_span(primaries));
+    counts = this->transport(step, counts, &main_parents);
+    EXPECT_FALSE(counts);
+
+    auto tail = step.release_tail();
+    ASSERT_GT(tail.tracks.size(), 0);
+    ASSERT_EQ(this->init()->max_events(), tail.track_counters.size());
+    size_type const num_main_ids = tail.track_counters.front();
+    EXPECT_EQ(32 * 3, num_main_ids);
+
+    // Extracted secondaries keep their IDs and parents
+    std::set<TrackId> tail_ids;
+    for (TrackInitializer const& init : tail.tracks)
+    {
+        EXPECT_LT(init.sim.track_id.get(), num_main_ids);
+        EXPECT_TRUE(tail_ids.insert(init.sim.track_id).second);
+        auto iter = main_parents.find(init.sim.track_id);
+        ASSERT_NE(main_parents.end(), iter);
+        EXPECT_EQ(iter->second, init.sim.parent_id);
+        EXPECT_TRUE(init.sim.parent_id);
+        EXPECT_LT(init.sim.parent_id.get(), 32);
+    }
+
+    // Finish the tail with a different random number stream
+    input.num_track_slots = num_slots / 4;
+    input.min_active_fraction = 0;
+    input.rng_substream = 1;
+    Stepper<MemSpace::host> tail_step(input);
+    tail_step.insert_tail(tail);
+
+    ParentMap tail_parents;
+    counts = this->transport(tail_step, tail_step(), &tail_parents);
+    EXPECT_FALSE(counts);
+    for (auto const& [track, parent] : tail_parents)
+    {
+        EXPECT_EQ(1, tail_ids.count(track));
+        EXPECT_EQ(main_parents[track], parent);
+    }
+
+    // Nothing new was created so the counters are unchanged
+    auto done = tail_step.release_tail();
+    EXPECT_TRUE(done.tracks.empty());
+    EXPECT_EQ(tail.track_counters, done.track_counters);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackInitTailSecondaryTest, tail_secondaries)
+{
+    size_type const num_slots = 64;
+    StepperInput input{this->core(), StreamId{0}, num_slots};
+    input.min_active_fraction = 0.75;
+    Stepper<MemSpace::host> step(input);
+
+    // Positrons cross the world in a single step: the nearly empty state is
+    // extracted before any of them annihilate
+    auto primaries = this->make_positrons(32, {-20, 0, 0});
+    auto counts = step(make_span(primaries));
+    EXPECT_EQ(32, counts.tail);
+    EXPECT_FALSE(counts);
+
+    auto tail = step.release_tail();
+    ASSERT_EQ(32, tail.tracks.size());
+    ASSERT_EQ(this->init()->max_events(), tail.track_counters.size());
+    EXPECT_EQ(32, tail.track_counters.front());
+
+    // Annihilate in a separate stepper with a different random number stream
+    input.num_track_slots = num_slots / 4;
+    input.min_active_fraction = 0;
+    input.rng_substream = 1;
+    Stepper<MemSpace::host> tail_step(input);
+    tail_step.insert_tail(tail);
+
+    ParentMap tail_parents;
+    counts = this->transport(tail_step, tail_step(), &tail_parents);
+    EXPECT_FALSE(counts);
+
+    // New secondaries get IDs unused by the main stepper
+    size_type num_new = 0;
+    for (auto const& [track, parent] : tail_parents)
+    {
+        if (track.get() < 32)
+        {
+            EXPECT_FALSE(parent);
+            continue;
+        }
+        EXPECT_TRUE(parent);
+        EXPECT_LT(parent.get(), 32);
+        ++num_new;
+    }
+    EXPECT_GT(num_new, 0);
+
+    // Synchronize the main stepper's counters
+    auto done = tail_step.release_tail();
+    EXPECT_TRUE(done.tracks.empty());
+    ASSERT_EQ(this->init()->max_events(), done.track_counters.size());
+    EXPECT_GE(done.track_counters.front(), 32 + num_new);
+    EXPECT_EQ(0, done.track_counters.front() % 2);
+    step.insert_tail(done);
+    EXPECT_EQ(done.track_counters, step.release_tail().track_counters);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
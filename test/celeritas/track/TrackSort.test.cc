@@ -0,0 +1,373 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/TrackSort.test.cc
+//---------------------------------------------------------------------------//
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/Units.hh"
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/global/detail/ActionSequence.hh"
+#include "celeritas/phys/CutoffParams.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/track/TrackInitParams.hh"
+#include "celeritas/track/detail/TrackSortUtils.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TrackSortTest : public SimpleTestBase
+{
+  protected:
+    using StateRef = HostRef<CoreStateData>;
+
+    SPConstCutoff build_cutoff() override
+    {
+        // Kill electrons (which have no physics) as they're produced
+        CutoffParams::Input input;
+        input.materials = this->material();
+        input.particles = this->particle();
+        input.cutoffs = {
+            {pdg::gamma(),
+             {{units::MevEnergy{0.01}, 0.1 * units::millimeter},
+              {units::MevEnergy{100}, 100 * units::centimeter}}},
+            {pdg::electron(),
+             {{units::MevEnergy{1000}, 1000 * units::centimeter},
+              {units::MevEnergy{1000}, 1000 * units::centimeter}}},
+        };
+        input.apply_post_interaction = true;
+        return std::make_shared<CutoffParams>(std::move(input));
+    }
+
+    SPConstTrackInit build_init() override
+    {
+        TrackInitParams::Input input;
+        input.capacity = 4096;
+        input.max_events = 4096;
+        input.track_order = this->track_order();
+        input.compaction_threshold = this->compaction_threshold();
+        return std::make_shared<TrackInitParams>(input);
+    }
+
+    virtual TrackOrder track_order() const
+    {
+        return TrackOrder::sort_step_limit_action;
+    }
+
+    virtual real_type compaction_threshold() const { return 0; }
+
+    std::vector<Primary> make_primaries(size_type count) const
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        CELER_ASSERT(p.particle_id);
+        p.energy = units::MevEnergy{10};
+        p.track_id = TrackId{0};
+        p.position = {0, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time = 0;
+
+        std::vector<Primary> result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{i};
+            // Alternate between high and low energies
+            result[i].energy = units::MevEnergy{i % 2 ? 10.0 / (1 + i) : 10.0};
+        }
+        return result;
+    }
+
+    // Apply the sorting action directly to the current state
+    void sort_tracks(CoreRef<MemSpace::host> core) const
+    {
+        auto const& sp_action = this->action_reg()->action(
+            this->action_reg()->find_action("sort-tracks-along-step"));
+        auto const* sort_action
+            = dynamic_cast<ExplicitActionInterface const*>(sp_action.get());
+        CELER_ASSERT(sort_action);
+        sort_action->execute(core.params, core.states);
+    }
+
+    // Check that the threads for each action point to the correct tracks
+    void check_partitioned(Stepper<MemSpace::host> const& step) const
+    {
+        StateRef const& state = step.core_data().states;
+        auto const& offsets = state.thread_offsets;
+        ASSERT_EQ(step.actions().num_actions() + 1, offsets.size());
+
+        size_type num_threads = 0;
+        for (auto action : range(ActionId{offsets.size() - 1}))
+        {
+            auto threads = action_thread_range(state, action);
+            num_threads += threads.size();
+            for (ThreadId tid : threads)
+            {
+                TrackSlotId slot{state.track_slots[tid]};
+                EXPECT_EQ(action, state.sim.step_limit[slot].action)
+                    << "at " << tid.get();
+            }
+        }
+
+        // Remaining threads are inactive
+        for (auto tid : range(ThreadId{num_threads}, ThreadId{state.size()}))
+        {
+            TrackSlotId slot{state.track_slots[tid]};
+            EXPECT_FALSE(state.sim.step_limit[slot].action);
+        }
+    }
+};
+
+class LateImplicitAction final : public ImplicitActionInterface,
+                                 public ConcreteAction
+{
+  public:
+    using ConcreteAction::ConcreteAction;
+};
+
+class TrackSortChargeTest : public TrackSortTest
+{
+    TrackOrder track_order() const override
+    {
+        return TrackOrder::partition_charge;
+    }
+};
+
+class TrackSortEnergyTest : public TrackSortTest
+{
+    TrackOrder track_order() const override
+    {
+        return TrackOrder::sort_particle_energy;
+    }
+};
+
+class TrackCompactTest : public TrackSortTest
+{
+    TrackOrder track_order() const override { return TrackOrder::unsorted; }
+    real_type compaction_threshold() const override { return 0.5; }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackSortTest, setup)
+{
+    Stepper<MemSpace::host> step(
+        {this->core(), StreamId{0}, /* num_track_slots = */ 1});
+
+    std::vector<std::string> labels;
+    for (auto const& sp_action : step.actions().actions())
+    {
+        labels.push_back(sp_action->label());
+    }
+    static char const* const expected_labels[] = {
+        "initialize-tracks",
+        "pre-step",
+        "along-step-neutral",
+        "physics-discrete-select",
+        "sort-tracks-post-step",
+        "scat-klein-nishina",
+        "geo-boundary",
+        "extend-from-secondaries",
+    };
+    EXPECT_VEC_EQ(expected_labels, labels);
+}
+
+TEST_F(TrackSortTest, host)
+{
+    size_type num_primaries = 32;
+    Stepper<MemSpace::host> step(
+        {this->core(), StreamId{0}, /* num_track_slots = */ 64});
+
+    auto primaries = this->make_primaries(num_primaries);
+    auto counts = step(make_span(primaries));
+    EXPECT_EQ(num_primaries, counts.active);
+    this->check_partitioned(step);
+
+    for (size_type i = 0; i < 32 && counts; ++i)
+    {
+        counts = step();
+        this->check_partitioned(step);
+    }
+}
+
+TEST_F(TrackSortTest, late_action)
+{
+    Stepper<MemSpace::host> step(
+        {this->core(), StreamId{0}, /* num_track_slots = */ 64});
+
+    // Actions registered after the stepper is built are not part of its
+    // sequence and don't change its thread offsets
+    auto& reg = *this->action_reg();
+    reg.insert(std::make_shared<LateImplicitAction>(reg.next_id(), "late"));
+    EXPECT_EQ(reg.num_actions(), step.actions().num_actions() + 1);
+
+    auto primaries = this->make_primaries(16);
+    auto counts = step(make_span(primaries));
+    this->check_partitioned(step);
+    for (size_type i = 0; i < 8 && counts; ++i)
+    {
+        counts = step();
+        this->check_partitioned(step);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackSortChargeTest, host)
+{
+    Stepper<MemSpace::host> step(
+        {this->core(), StreamId{0}, /* num_track_slots = */ 64});
+    EXPECT_TRUE(step.core_data().states.thread_offsets.empty());
+
+    auto primaries = this->make_primaries(16);
+    auto counts = step(make_span(primaries));
+    EXPECT_EQ(16, counts.active);
+
+    for (size_type i = 0; i < 4 && counts; ++i)
+    {
+        auto core = step.core_data();
+        this->sort_tracks(core);
+
+        auto const& states = core.states;
+        detail::ChargeKey get_key{
+            core.params.particles.particles[AllItems<ParticleRecord>{}].data(),
+            states.particles.state[AllItems<ParticleTrackState>{}].data(),
+            states.sim.status[AllItems<TrackStatus>{}].data()};
+        std::vector<unsigned int> keys;
+        for (auto tid : range(ThreadId{states.size()}))
+        {
+            keys.push_back(get_key(states.track_slots[tid]));
+        }
+        EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+        // Gammas are neutral and inactive tracks are at the back
+        EXPECT_EQ(0, keys.front());
+        EXPECT_EQ(2, keys.back());
+
+        counts = step();
+    }
+}
+
+TEST_F(TrackSortEnergyTest, host)
+{
+    Stepper<MemSpace::host> step(
+        {this->core(), StreamId{0}, /* num_track_slots = */ 64});
+
+    auto primaries = this->make_primaries(16);
+    auto counts = step(make_span(primaries));
+    EXPECT_EQ(16, counts.active);
+
+    for (size_type i = 0; i < 4 && counts; ++i)
+    {
+        auto core = step.core_data();
+        this->sort_tracks(core);
+
+        auto const& states = core.states;
+        detail::ParticleEnergyKey get_key{
+            states.particles.state[AllItems<ParticleTrackState>{}].data(),
+            states.sim.status[AllItems<TrackStatus>{}].data()};
+        std::vector<unsigned int> keys;
+        std::vector<real_type> energies;
+        for (auto tid : range(ThreadId{states.size()}))
+        {
+            TrackSlotId slot{states.track_slots[tid]};
+            keys.push_back(get_key(slot.get()));
+            if (states.sim.status[slot] != TrackStatus::inactive)
+            {
+                energies.push_back(states.particles.state[slot].energy);
+            }
+        }
+        EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+        // With a single particle type, energy bins are increasing
+        EXPECT_FALSE(energies.empty());
+        for (auto j : range(std::size_t{1}, energies.size()))
+        {
+            EXPECT_LE(std::ilogb(energies[j - 1]), std::ilogb(energies[j]));
+        }
+
+        counts = step();
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackCompactTest, host)
+{
+    size_type const num_slots = 64;
+    Stepper<MemSpace::host> step(
+        {this->core(), StreamId{0}, /* num_track_slots = */ num_slots});
+
+    std::vector<std::string> labels;
+    for (auto const& sp_action : step.actions().actions())
+    {
+        labels.push_back(sp_action->label());
+    }
+    ASSERT_LE(2, labels.size());
+    EXPECT_EQ("extend-from-secondaries", labels[labels.size() - 2]);
+    EXPECT_EQ("compact-tracks", labels.back());
+
+    auto primaries = this->make_primaries(8);
+    auto counts = step(make_span(primaries));
+    EXPECT_EQ(8, counts.active);
+
+    size_type num_compacted = 0;
+    for (size_type i = 0; i < 32 && counts; ++i)
+    {
+        auto const& states = step.core_data().states;
+        size_type num_threads = states.num_threads;
+        EXPECT_LE(num_threads, num_slots);
+        if (num_threads < num_slots)
+        {
+            ++num_compacted;
+            size_type num_vacant = num_slots - counts.alive;
+            EXPECT_EQ(counts.alive + std::min(counts.queued, num_vacant),
+                      num_threads);
+        }
+
+        // Track slots are still a permutation
+        auto all_slots
+            = states.track_slots[AllItems<TrackSlotId::size_type>{}];
+        std::vector<size_type> slots(all_slots.begin(), all_slots.end());
+        std::sort(slots.begin(), slots.end());
+        for (auto j : range(num_slots))
+        {
+            EXPECT_EQ(j, slots[j]);
+        }
+
+        // Live tracks are all in the leading threads
+        size_type num_alive = 0;
+        for (auto tid : range(ThreadId{num_threads}))
+        {
+            TrackSlotId slot{states.track_slots[tid]};
+            num_alive += (states.sim.status[slot] == TrackStatus::alive);
+        }
+        EXPECT_EQ(counts.alive, num_alive);
+
+        counts = step();
+    }
+    EXPECT_LT(0, num_compacted);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -11,10 +11,12 @@
 #include "celeritas/em/UrbanMscParams.hh"
 #include "celeritas/global/ActionRegistry.hh"
 #include "celeritas/global/Stepper.hh"
+#include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/Primary.hh"
+#include "celeritas/phys/WoodcockParams.hh"
 
 #include "../SimpleTestBase.hh"
 #include "../TestEm15Base.hh"
@@ -68,6 +70,55 @@ class KnCaloTest : public KnStepCollectorTestBase, public CaloTestBase
     VecString get_detector_names() const final { return {"inner"}; }
 };
 
+class KnWoodcockCaloTest : public KnStepCollectorTestBase, public CaloTestBase
+{
+    void SetUp() override
+    {
+        // The collector checks the along-step action for Woodcock tracking
+        this->along_step();
+        CaloTestBase::SetUp();
+    }
+
+    SPConstAction build_along_step() override
+    {
+        auto& action_reg = *this->action_reg();
+        auto woodcock = std::make_shared<WoodcockParams>(*this->particle(),
+                                                         *this->material(),
+                                                         *this->geomaterial(),
+                                                         *this->physics());
+        auto result = AlongStepGeneralLinearAction::from_params(
+            action_reg.next_id(),
+            *this->material(),
+            *this->particle(),
+            nullptr,
+            false,
+            woodcock);
+        CELER_ASSERT(result->has_woodcock());
+        action_reg.insert(result);
+        return result;
+    }
+
+    //! Start low-energy photons in the (non-sensitive) world volume
+    VecPrimary make_primaries(size_type count) override
+    {
+        auto result = KnStepCollectorTestBase::make_primaries(count);
+        for (auto i : range(count))
+        {
+            // Compton electrons are below the production cutoff, so every
+            // collision deposits energy
+            Primary& p = result[i];
+            p.energy = MevEnergy{1e-3};
+            p.position = {-6, 0, 0};
+            // The calorimeter tallies a single event
+            p.event_id = EventId{0};
+            p.track_id = TrackId{i};
+        }
+        return result;
+    }
+
+    VecString get_detector_names() const final { return {"inner", "world"}; }
+};
+
 //---------------------------------------------------------------------------//
 
 class TestEm3CollectorTestBase : public TestEm3Base,
@@ -228,6 +279,18 @@ TEST_F(KnCaloTest, single_event)
     EXPECT_VEC_SOFT_EQ(expected_edep, result.edep);
 }
 
+TEST_F(KnWoodcockCaloTest, detector_behind_world)
+{
+    auto result = this->run(16, 64);
+
+    // Delta tracking steps start in the world but collide in the inner box,
+    // which has a much larger cross section: the deposition must be credited
+    // to the volume where the collision happened
+    ASSERT_EQ(2, result.edep.size());
+    EXPECT_GT(result.edep[0], 0);
+    EXPECT_EQ(0, result.edep[1]);
+}
+
 //---------------------------------------------------------------------------//
 // TESTEM3
 //---------------------------------------------------------------------------//
@@ -0,0 +1,78 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/DedupeCollectionBuilder.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/data/DedupeCollectionBuilder.hh"
+
+#include <vector>
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+bool same_range(ItemRange<double> const& a, ItemRange<double> const& b)
+{
+    return a.begin() == b.begin() && a.end() == b.end();
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(DedupeCollectionBuilderTest, reals)
+{
+    Collection<double, Ownership::value, MemSpace::host> reals;
+    auto build = make_dedupe_builder(&reals);
+
+    std::vector<double> const a{1.0, 2.0, 3.0};
+    std::vector<double> const b{1.0, 2.0, 4.0};
+    std::vector<double> const c{1.0, 2.0};
+
+    auto ra = build.insert_back(a.begin(), a.end());
+    auto rb = build.insert_back(b.begin(), b.end());
+    auto rc = build.insert_back(c.begin(), c.end());
+    EXPECT_EQ(8, build.size());
+    EXPECT_EQ(0, build.num_deduplicated());
+
+    // Identical ranges are reused
+    EXPECT_TRUE(same_range(ra, build.insert_back(a.begin(), a.end())));
+    EXPECT_TRUE(same_range(rc, build.insert_back(c.begin(), c.end())));
+    EXPECT_EQ(8, build.size());
+    EXPECT_EQ(5, build.num_deduplicated());
+
+    // Values are converted before comparison
+    std::vector<int> const int_b{1, 2, 4};
+    EXPECT_TRUE(same_range(rb, build.insert_back(int_b.begin(), int_b.end())));
+
+    // Empty ranges
+    std::vector<double> const empty;
+    auto re = build.insert_back(empty.begin(), empty.end());
+    EXPECT_TRUE(re.empty());
+    EXPECT_EQ(8, build.size());
+
+    EXPECT_VEC_EQ(b, reals[rb]);
+    EXPECT_VEC_EQ(c, reals[rc]);
+}
+
+TEST(DedupeCollectionBuilderTest, negative_zero)
+{
+    // Values are compared bitwise, so signed zeros are distinct
+    Collection<double, Ownership::value, MemSpace::host> reals;
+    auto build = make_dedupe_builder(&reals);
+
+    std::vector<double> const pos{0.0};
+    std::vector<double> const neg{-0.0};
+    auto rp = build.insert_back(pos.begin(), pos.end());
+    auto rn = build.insert_back(neg.begin(), neg.end());
+    EXPECT_FALSE(same_range(rp, rn));
+    EXPECT_EQ(2, build.size());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
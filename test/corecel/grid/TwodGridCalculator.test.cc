@@ -60,7 +60,7 @@ class TwodGridCalculatorTest : public Test
 {
   protected:
     template<Ownership W>
-    using RealData = Collection<real_type, W, MemSpace::host>;
+    using RealData = Collection<table_real_type, W, MemSpace::host>;
 
     void SetUp() override
     {
@@ -14,6 +14,7 @@
 #include "corecel/io/BuildOutput.hh"
 #include "corecel/io/ExceptionOutput.hh"
 #include "corecel/io/JsonPimpl.hh"
+#include "corecel/io/MultiStreamOutput.hh"
 #include "corecel/sys/TypeDemangler.hh"
 
 #include "celeritas_test.hh"
@@ -152,6 +153,40 @@ TEST_F(OutputRegistryTest, minimal)
     }
 }
 
+TEST_F(OutputRegistryTest, multi_stream)
+{
+    auto streams = std::make_shared<MultiStreamOutput>(
+        Category::result, "per-stream", 3);
+    EXPECT_EQ(3, streams->num_streams());
+    EXPECT_FALSE(streams->get(StreamId{1}));
+
+    OutputRegistry reg;
+    reg.insert(streams);
+    EXPECT_THROW(reg.insert(std::make_shared<MultiStreamOutput>(
+                     Category::result, "per-stream", 1)),
+                 RuntimeError);
+    if (CELERITAS_USE_JSON)
+    {
+        EXPECT_EQ(R"json({"result":{"per-stream":null}})json",
+                  this->to_string(reg));
+    }
+
+    streams->set(StreamId{2},
+                 std::make_shared<TestInterface>(Category::result, "a", 1));
+    streams->set(StreamId{0},
+                 std::make_shared<TestInterface>(Category::result, "b", 2));
+    EXPECT_TRUE(streams->get(StreamId{2}));
+
+    // Replace an existing stream's output
+    streams->set(StreamId{2},
+                 std::make_shared<TestInterface>(Category::result, "c", 3));
+    if (CELERITAS_USE_JSON)
+    {
+        EXPECT_EQ(R"json({"result":{"per-stream":[2,null,3]}})json",
+                  this->to_string(reg));
+    }
+}
+
 TEST_F(OutputRegistryTest, build_output)
 {
     OutputRegistry reg;
@@ -9,6 +9,8 @@
 
 #include <limits>
 
+#include "orange/BoundingBoxUtils.hh"
+
 #include "celeritas_test.hh"
 
 namespace celeritas
@@ -56,6 +58,48 @@ TEST_F(BoundingBoxTest, standard)
     EXPECT_VEC_SOFT_EQ((Real3{4, 5, 6}), bb.upper());
 }
 
+TEST_F(BoundingBoxTest, utils)
+{
+    BoundingBox bb{{-1, -2, 3}, {4, 5, 6}};
+    EXPECT_TRUE(is_inside(bb, {0, 0, 4}));
+    EXPECT_TRUE(is_inside(bb, {-1, 5, 6}));
+    EXPECT_FALSE(is_inside(bb, {-1.001, 0, 4}));
+    EXPECT_FALSE(is_inside(bb, {0, 0, 6.001}));
+    EXPECT_TRUE(is_finite(bb));
+    EXPECT_FALSE(is_finite(BoundingBox::from_infinite()));
+    EXPECT_VEC_SOFT_EQ((Real3{1.5, 1.5, 4.5}), calc_center(bb));
+
+    BoundingBox un = calc_union(bb, {{0, -3, 0}, {1, 1, 1}});
+    EXPECT_VEC_SOFT_EQ((Real3{-1, -3, 0}), un.lower());
+    EXPECT_VEC_SOFT_EQ((Real3{4, 5, 6}), un.upper());
+}
+
+TEST_F(BoundingBoxTest, dist_to_enter)
+{
+    constexpr real_type inf = numeric_limits<real_type>::infinity();
+    BoundingBox bb{{-1, -2, 3}, {4, 5, 6}};
+
+    // Inside
+    EXPECT_SOFT_EQ(0, calc_dist_to_enter(bb, {0, 0, 4}, {1, 0, 0}));
+    // Outside, heading toward
+    EXPECT_SOFT_EQ(3, calc_dist_to_enter(bb, {-4, 0, 4}, {1, 0, 0}));
+    EXPECT_SOFT_EQ(2, calc_dist_to_enter(bb, {0, 0, 8}, {0, 0, -1}));
+    real_type const sqrt_half = std::sqrt(real_type(0.5));
+    EXPECT_SOFT_EQ(
+        1 / sqrt_half,
+        calc_dist_to_enter(bb, {-2, -3, 4}, {sqrt_half, sqrt_half, 0}));
+    // Heading away
+    EXPECT_EQ(inf, calc_dist_to_enter(bb, {-4, 0, 4}, {-1, 0, 0}));
+    // Parallel and outside a slab
+    EXPECT_EQ(inf, calc_dist_to_enter(bb, {-4, 0, 10}, {1, 0, 0}));
+    // Missing a corner
+    EXPECT_EQ(inf, calc_dist_to_enter(bb, {-4, 6, 4}, {0.6, 0.8, 0}));
+    // Infinite box
+    EXPECT_SOFT_EQ(0,
+                   calc_dist_to_enter(
+                       BoundingBox::from_infinite(), {1, 2, 3}, {0, 0, 1}));
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
@@ -75,6 +75,21 @@ class UniversesTest : public OrangeTest
     void SetUp() override { this->build_geometry("universes.org.json"); }
 };
 
+#define RotatedUniversesTest TEST_IF_CELERITAS_JSON(RotatedUniversesTest)
+class RotatedUniversesTest : public OrangeTest
+{
+    void SetUp() override
+    {
+        // Rotate the upper "inner" daughter 180 degrees about z, translating
+        // it so that it fills the same hole
+        auto input = this->read_input("universes.org.json");
+        auto& daughter = input.units.front().daughter_map.at(LocalVolumeId{2});
+        daughter.translation = {4, -2, 0.5};
+        daughter.rotation = {{{-1, 0, 0}, {0, -1, 0}, {0, 0, 1}}};
+        this->build_geometry(std::move(input));
+    }
+};
+
 #define Geant4Testem15Test TEST_IF_CELERITAS_JSON(Geant4Testem15Test)
 class Geant4Testem15Test : public OrangeTest
 {
@@ -508,6 +523,58 @@ TEST_F(TwoVolumeTest, intersect_limited)
     EXPECT_FALSE(next.boundary);
 }
 
+TEST_F(TwoVolumeTest, intersect_cached)
+{
+    {
+        auto geo = this->make_track_view();
+        geo = Initializer_t{{0.0, 0, 0}, {1, 0, 0}};
+    }
+
+    // Physics-limited steps (with a new track view for each step) reuse and
+    // decrement the exact boundary distance
+    for (real_type step : {0.25, 0.1, 0.4})
+    {
+        auto geo = this->make_track_view();
+        auto next = geo.find_next_step(step);
+        EXPECT_SOFT_EQ(step, next.distance);
+        EXPECT_FALSE(next.boundary);
+        if (CELERITAS_DEBUG)
+        {
+            EXPECT_THROW(geo.move_to_boundary(), DebugError);
+        }
+        geo.move_internal(step);
+    }
+
+    auto geo = this->make_track_view();
+    EXPECT_VEC_SOFT_EQ(Real3({0.75, 0, 0}), geo.pos());
+    auto next = geo.find_next_step(0.5);
+    EXPECT_SOFT_EQ(0.5, next.distance);
+    EXPECT_FALSE(next.boundary);
+    next = geo.find_next_step(1.0);
+    EXPECT_SOFT_EQ(0.75, next.distance);
+    EXPECT_TRUE(next.boundary);
+
+    // Changing direction invalidates the cached distance
+    geo.set_dir({0, 1, 0});
+    next = geo.find_next_step(0.5);
+    EXPECT_SOFT_EQ(0.5, next.distance);
+    EXPECT_FALSE(next.boundary);
+    next = geo.find_next_step();
+    EXPECT_SOFT_EQ(1.299038105676658, next.distance);
+    EXPECT_TRUE(next.boundary);
+    geo.move_to_boundary();
+    geo.cross_boundary();
+    EXPECT_EQ(VolumeId{0}, geo.volume_id());
+
+    // Exterior has no boundary: infinite distance is kept
+    next = geo.find_next_step(1.0);
+    EXPECT_SOFT_EQ(1.0, next.distance);
+    EXPECT_FALSE(next.boundary);
+    geo.move_internal(1.0);
+    next = geo.find_next_step();
+    EXPECT_SOFT_EQ(inf, next.distance);
+}
+
 TEST_F(FiveVolumesTest, params)
 {
     OrangeParams const& geo = this->params();
@@ -841,6 +908,51 @@ TEST_F(UniversesTest, cross_between_daughters)
     EXPECT_EQ("bob.mz", this->params().id_to_label(geo.surface_id()).name);
 }
 
+TEST_F(RotatedUniversesTest, track)
+{
+    auto geo = this->make_track_view();
+    geo = Initializer_t{{1.5, -2, 1}, {1, 0, 0}};
+    EXPECT_VEC_SOFT_EQ(Real3({1.5, -2, 1}), geo.pos());
+    EXPECT_VEC_SOFT_EQ(Real3({1, 0, 0}), geo.dir());
+
+    std::vector<std::string> volumes;
+    std::vector<real_type> distances;
+    while (!geo.is_outside() && volumes.size() < 10)
+    {
+        volumes.push_back(this->params().id_to_label(geo.volume_id()).name);
+        auto next = geo.find_next_step();
+        distances.push_back(next.distance);
+        geo.move_to_boundary();
+        geo.cross_boundary();
+    }
+
+    // Traversal order is reversed compared to the unrotated daughter
+    static char const* const expected_volumes[] = {"b", "a", "c", "johnny"};
+    static real_type const expected_distances[] = {1.5, 2, 1, 2};
+    EXPECT_VEC_EQ(expected_volumes, volumes);
+    EXPECT_VEC_SOFT_EQ(expected_distances, distances);
+    EXPECT_VEC_SOFT_EQ(Real3({8, -2, 1}), geo.pos());
+}
+
+TEST_F(RotatedUniversesTest, change_direction)
+{
+    auto geo = this->make_track_view();
+    geo = Initializer_t{{1.5, -2, 1}, {0, 1, 0}};
+    EXPECT_EQ("b", this->params().id_to_label(geo.volume_id()).name);
+    EXPECT_SOFT_EQ(1, geo.find_next_step().distance);
+
+    geo.set_dir({1, 0, 0});
+    EXPECT_VEC_SOFT_EQ(Real3({1, 0, 0}), geo.dir());
+    EXPECT_SOFT_EQ(1.5, geo.find_next_step().distance);
+
+    geo = OrangeTrackView::DetailedInitializer{geo, {-1, 0, 0}};
+    EXPECT_VEC_SOFT_EQ(Real3({-1, 0, 0}), geo.dir());
+    EXPECT_SOFT_EQ(0.5, geo.find_next_step().distance);
+
+    geo.move_internal({2.5, -2, 1});
+    EXPECT_SOFT_EQ(1.5, geo.find_next_step().distance);
+}
+
 TEST_F(Geant4Testem15Test, safety)
 {
     OrangeTrackView geo = this->make_track_view();
@@ -23,6 +23,12 @@
 #include "orange/surf/SurfaceAction.hh"
 #include "orange/surf/SurfaceIO.hh"
 
+#if CELERITAS_USE_JSON
+#    include <nlohmann/json.hpp>
+
+#    include "orange/construct/OrangeInputIO.json.hh"
+#endif
+
 namespace celeritas
 {
 namespace test
@@ -178,6 +184,39 @@ void OrangeGeoTestBase::build_geometry(UnitInput input)
     params_ = std::make_unique<Params>(to_input(std::move(input)));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a geometry from a full input definition.
+ */
+void OrangeGeoTestBase::build_geometry(OrangeInput input)
+{
+    CELER_EXPECT(!params_);
+    CELER_EXPECT(input);
+    params_ = std::make_unique<Params>(std::move(input));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a geometry definition from the given JSON filename.
+ *
+ * This allows tests to modify the input before building the geometry.
+ */
+OrangeInput OrangeGeoTestBase::read_input(char const* filename) const
+{
+    CELER_EXPECT(filename);
+    CELER_VALIDATE(CELERITAS_USE_JSON,
+                   << "JSON is not enabled so geometry cannot be loaded");
+
+    OrangeInput result;
+#if CELERITAS_USE_JSON
+    std::ifstream infile(this->test_data_path("orange", filename));
+    CELER_VALIDATE(infile,
+                   << "failed to open geometry at '" << filename << '\'');
+    nlohmann::json::parse(infile).get_to(result);
+#endif
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Lazily create and get a single-serving host state.
@@ -22,6 +22,7 @@
 
 namespace celeritas
 {
+struct OrangeInput;
 struct UnitInput;
 class OrangeParams;
 namespace test
@@ -78,6 +79,12 @@ class OrangeGeoTestBase : public Test
     // Load geometry from a single unit
     void build_geometry(UnitInput);
 
+    // Load geometry from a full input definition
+    void build_geometry(OrangeInput);
+
+    // Read `test/orange/data/{filename}` JSON input without building
+    OrangeInput read_input(char const* filename) const;
+
     //! Get the data after loading
     Params const& params() const
     {
@@ -0,0 +1,56 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/Transformer.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/Transformer.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class TransformerTest : public Test
+{
+  protected:
+    Translation translation_{1, 2, 3};
+    // Rotate 90 degrees about z
+    Rotation rotation_{{{0, -1, 0}, {1, 0, 0}, {0, 0, 1}}};
+};
+
+TEST_F(TransformerTest, translate_only)
+{
+    TransformerDown down(translation_, nullptr);
+    EXPECT_VEC_SOFT_EQ((Real3{.1, .2, .3}), down(Real3{1.1, 2.2, 3.3}));
+    EXPECT_VEC_SOFT_EQ((Real3{0, 1, 0}), down.rotate(Real3{0, 1, 0}));
+
+    TransformerUp up(translation_, nullptr);
+    EXPECT_VEC_SOFT_EQ((Real3{1.1, 2.2, 3.3}), up(Real3{.1, .2, .3}));
+    EXPECT_VEC_SOFT_EQ((Real3{0, 1, 0}), up.rotate(Real3{0, 1, 0}));
+}
+
+TEST_F(TransformerTest, rotate)
+{
+    TransformerUp up(translation_, &rotation_);
+    // Daughter +x is parent +y
+    EXPECT_VEC_SOFT_EQ((Real3{0, 1, 0}), up.rotate(Real3{1, 0, 0}));
+    EXPECT_VEC_SOFT_EQ((Real3{-1, 0, 0}), up.rotate(Real3{0, 1, 0}));
+    EXPECT_VEC_SOFT_EQ((Real3{1, 3, 3.5}), up(Real3{1, 0, 0.5}));
+
+    TransformerDown down(translation_, &rotation_);
+    EXPECT_VEC_SOFT_EQ((Real3{1, 0, 0}), down.rotate(Real3{0, 1, 0}));
+    EXPECT_VEC_SOFT_EQ((Real3{1, 0, 0.5}), down(Real3{1, 3, 3.5}));
+
+    // Round trip
+    Real3 const pos{-1.5, 2.25, 4};
+    EXPECT_VEC_SOFT_EQ(pos, up(down(pos)));
+    EXPECT_VEC_SOFT_EQ(pos, down(up(pos)));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
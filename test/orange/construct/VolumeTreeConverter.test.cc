@@ -0,0 +1,252 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/construct/VolumeTreeConverter.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/construct/VolumeTreeConverter.hh"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "orange/OrangeParams.hh"
+#include "orange/OrangeTrackView.hh"
+
+#include "celeritas_test.hh"
+#include "orange/OrangeGeoTestBase.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class VolumeTreeConverterTest : public OrangeGeoTestBase
+{
+  protected:
+    using Initializer_t = GeoTrackInitializer;
+
+    struct TrackResult
+    {
+        std::vector<std::string> volumes;
+        std::vector<real_type> distances;
+    };
+
+    void SetUp() override
+    {
+        using Type = SolidInput::Type;
+        real_type const sqrt_half = std::sqrt(real_type(0.5));
+
+        auto& lv = tree_.logicals;
+        lv.resize(5);
+        lv[0].label = Label{"world"};
+        lv[0].solid = {Type::box, {10, 10, 10}};
+        lv[1].label = Label{"env"};
+        lv[1].solid = {Type::box, {2, 4, 1}};
+        lv[2].label = Label{"core"};
+        lv[2].solid = {Type::cone, {0, 1, 0, 0.5, 1}};
+        lv[3].label = Label{"ball"};
+        lv[3].solid = {Type::sphere, {0, 1}};
+        lv[4].label = Label{"pipe"};
+        lv[4].solid = {Type::tube, {0.5, 1, 2}};
+
+        // Envelope rotated 90 degrees about z
+        PlacementInput pl;
+        pl.label = Label{"env_pv"};
+        pl.logical = 1;
+        pl.translation = {5, 0, 0};
+        pl.rotation = {{{0, -1, 0}, {1, 0, 0}, {0, 0, 1}}};
+        lv[0].daughters.push_back(pl);
+
+        pl = {};
+        pl.label = Label{"ball_pv"};
+        pl.logical = 3;
+        pl.translation = {-5, 0, 0};
+        lv[0].daughters.push_back(pl);
+
+        // Pipe rotated 45 degrees about x
+        pl = {};
+        pl.label = Label{"pipe_pv"};
+        pl.logical = 4;
+        pl.translation = {-5, 5, 5};
+        pl.rotation = {{{1, 0, 0},
+                        {0, sqrt_half, sqrt_half},
+                        {0, -sqrt_half, sqrt_half}}};
+        lv[0].daughters.push_back(pl);
+
+        pl = {};
+        pl.label = Label{"core_pv"};
+        pl.logical = 2;
+        pl.translation = {1, 0, 0};
+        lv[1].daughters.push_back(pl);
+
+        tree_.world = 0;
+    }
+
+    //! Create a host track view
+    OrangeTrackView make_track_view()
+    {
+        if (!host_state_)
+        {
+            host_state_ = HostStateStore(this->host_params(), 1);
+        }
+
+        return OrangeTrackView(
+            this->host_params(), host_state_.ref(), TrackSlotId{0});
+    }
+
+    //! Track until leaving the geometry
+    TrackResult track(Real3 const& pos, Real3 const& dir)
+    {
+        TrackResult result;
+        auto geo = this->make_track_view();
+        geo = Initializer_t{pos, dir};
+        while (!geo.is_outside() && result.volumes.size() < 20)
+        {
+            result.volumes.push_back(
+                this->params().id_to_label(geo.volume_id()).name);
+            auto next = geo.find_next_step();
+            result.distances.push_back(next.distance);
+            geo.move_to_boundary();
+            geo.cross_boundary();
+        }
+        return result;
+    }
+
+    VolumeTreeInput tree_;
+
+  private:
+    using HostStateStore
+        = CollectionStateStore<OrangeStateData, MemSpace::host>;
+    HostStateStore host_state_;
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(VolumeTreeConverterTest, structure)
+{
+    VolumeTreeConverter convert;
+    OrangeInput result = convert(tree_);
+    ASSERT_EQ(2, result.units.size());
+    EXPECT_EQ(2, result.max_level);
+
+    auto get_volume_labels = [](UnitInput const& u) {
+        std::vector<std::string> result;
+        for (auto const& v : u.volumes)
+        {
+            result.push_back(v.label.name);
+        }
+        return result;
+    };
+    auto get_surface_types = [](UnitInput const& u) {
+        std::vector<std::string> result;
+        for (auto st : u.surfaces.types)
+        {
+            result.push_back(to_cstring(st));
+        }
+        return result;
+    };
+
+    {
+        UnitInput const& u = result.units[0];
+        EXPECT_EQ("world", u.label.name);
+        static char const* const expected_volumes[]
+            = {"[EXTERIOR]", "world", "env_pv", "ball", "pipe"};
+        EXPECT_VEC_EQ(expected_volumes, get_volume_labels(u));
+        static char const* const expected_surfaces[]
+            = {"px", "px", "py", "py", "pz", "pz", "py", "py", "px",
+               "px", "pz", "pz", "s",  "p",  "p",  "gq", "gq"};
+        EXPECT_VEC_EQ(expected_surfaces, get_surface_types(u));
+        EXPECT_EQ("pipe_pv.rmin", u.surfaces.labels.back().name);
+
+        ASSERT_EQ(1, u.daughter_map.size());
+        auto const& daughter = u.daughter_map.at(LocalVolumeId{2});
+        EXPECT_EQ(UniverseId{1}, daughter.universe_id);
+        EXPECT_VEC_SOFT_EQ(Real3({5, 0, 0}), daughter.translation);
+        EXPECT_VEC_SOFT_EQ(Real3({0, -1, 0}), daughter.rotation[0]);
+    }
+    {
+        UnitInput const& u = result.units[1];
+        EXPECT_EQ("env", u.label.name);
+        static char const* const expected_volumes[]
+            = {"[EXTERIOR]", "env", "core"};
+        EXPECT_VEC_EQ(expected_volumes, get_volume_labels(u));
+        static char const* const expected_surfaces[]
+            = {"pz", "pz", "kz"};
+        EXPECT_VEC_EQ(expected_surfaces, get_surface_types(u));
+        EXPECT_TRUE(u.daughter_map.empty());
+        EXPECT_TRUE(u.volumes[0].flags & VolumeRecord::implicit_vol);
+    }
+}
+
+TEST_F(VolumeTreeConverterTest, errors)
+{
+    VolumeTreeConverter convert;
+
+    // Missing world
+    {
+        VolumeTreeInput tree = tree_;
+        tree.world = 10;
+        EXPECT_THROW(convert(tree), RuntimeError);
+    }
+    // Bad solid parameters
+    {
+        VolumeTreeInput tree = tree_;
+        tree.logicals[3].solid.params = {1, 0.5};
+        EXPECT_THROW(convert(tree), RuntimeError);
+    }
+    // Recursive placement
+    {
+        VolumeTreeInput tree = tree_;
+        PlacementInput pl;
+        pl.label = Label{"bad_pv"};
+        pl.logical = 1;
+        tree.logicals[1].daughters.push_back(pl);
+        EXPECT_THROW(convert(tree), RuntimeError);
+    }
+}
+
+TEST_F(VolumeTreeConverterTest, tracking)
+{
+    this->build_geometry(VolumeTreeConverter{}(tree_));
+    EXPECT_EQ(8, this->params().num_volumes());
+
+    {
+        SCOPED_TRACE("through sphere and rotated envelope");
+        auto result = this->track({-9, 0, 0}, {1, 0, 0});
+        static char const* const expected_volumes[]
+            = {"world", "ball", "world", "env", "world"};
+        static real_type const expected_distances[] = {3, 2, 5, 8, 1};
+        EXPECT_VEC_EQ(expected_volumes, result.volumes);
+        EXPECT_VEC_SOFT_EQ(expected_distances, result.distances);
+    }
+    {
+        SCOPED_TRACE("through cone in rotated envelope");
+        auto result = this->track({5, -9, 0}, {0, 1, 0});
+        static char const* const expected_volumes[]
+            = {"world", "env", "core", "env", "world"};
+        static real_type const expected_distances[] = {7, 2.25, 1.5, 0.25, 8};
+        EXPECT_VEC_EQ(expected_volumes, result.volumes);
+        EXPECT_VEC_SOFT_EQ(expected_distances, result.distances);
+    }
+    {
+        SCOPED_TRACE("through rotated hollow tube");
+        auto result = this->track({-9, 5, 5}, {1, 0, 0});
+        static char const* const expected_volumes[]
+            = {"world", "pipe", "world", "pipe", "world"};
+        static real_type const expected_distances[] = {3, 0.5, 1, 0.5, 14};
+        EXPECT_VEC_EQ(expected_volumes, result.volumes);
+        EXPECT_VEC_SOFT_EQ(expected_distances, result.distances);
+    }
+    {
+        SCOPED_TRACE("initialize in daughter universe");
+        auto geo = this->make_track_view();
+        geo = Initializer_t{{5, 1, 0}, {0, 0, 1}};
+        EXPECT_EQ("core", this->params().id_to_label(geo.volume_id()).name);
+        EXPECT_SOFT_EQ(1, geo.find_next_step().distance);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
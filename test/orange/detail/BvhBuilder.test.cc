@@ -0,0 +1,126 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/BvhBuilder.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/detail/BvhBuilder.hh"
+
+#include <set>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "orange/BoundingBoxUtils.hh"
+
+#include "celeritas_test.hh"
+
+using celeritas::detail::BvhBuilder;
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class BvhBuilderTest : public Test
+{
+  protected:
+    using VecVolume = std::vector<size_type>;
+
+    // Find candidate volumes for a point with a stackless traversal
+    VecVolume find_candidates(ItemRange<BvhNode> bvh, Real3 const& pos) const
+    {
+        VecVolume result;
+        size_type idx = 0;
+        while (idx < bvh.size())
+        {
+            BvhNode const& node = data_.bvh_nodes[bvh[idx]];
+            if (!is_inside(node.bbox, pos))
+            {
+                idx = node.escape;
+                continue;
+            }
+            if (node.volumes.empty())
+            {
+                ++idx;
+                continue;
+            }
+            for (LocalVolumeId v : data_.local_volume_ids[node.volumes])
+            {
+                result.push_back(v.unchecked_get());
+            }
+            idx = node.escape;
+        }
+        return result;
+    }
+
+    HostVal<OrangeParamsData> data_;
+};
+
+TEST_F(BvhBuilderTest, grid)
+{
+    // Unit cubes on a 4x4x1 grid, plus excluded and infinite volumes
+    std::vector<BoundingBox> bboxes;
+    for (auto j : range(4))
+    {
+        for (auto i : range(4))
+        {
+            bboxes.push_back({{real_type(i), real_type(j), 0},
+                              {real_type(i + 1), real_type(j + 1), 1}});
+        }
+    }
+    bboxes.push_back({});
+    bboxes.push_back(BoundingBox::from_infinite());
+
+    auto bvh = BvhBuilder{&data_}(bboxes);
+    ASSERT_LT(1, bvh.size());
+
+    // Every node's escape index is past itself
+    for (auto i : range(bvh.size()))
+    {
+        EXPECT_LT(i, data_.bvh_nodes[bvh[i]].escape);
+        EXPECT_GE(bvh.size(), data_.bvh_nodes[bvh[i]].escape);
+    }
+
+    // Leaves contain each volume exactly once, omitting the unassigned one
+    std::multiset<size_type> all_volumes;
+    for (auto i : range(bvh.size()))
+    {
+        for (auto v : data_.local_volume_ids[data_.bvh_nodes[bvh[i]].volumes])
+        {
+            all_volumes.insert(v.unchecked_get());
+        }
+    }
+    EXPECT_EQ(17, all_volumes.size());
+    EXPECT_EQ(0, all_volumes.count(16));
+    EXPECT_EQ(1, all_volumes.count(17));
+
+    // Candidates always include the containing volume and the infinite one
+    for (auto j : range(4))
+    {
+        for (auto i : range(4))
+        {
+            Real3 pos{i + real_type(0.5), j + real_type(0.5), 0.5};
+            auto candidates = this->find_candidates(bvh, pos);
+            std::set<size_type> unique(candidates.begin(), candidates.end());
+            EXPECT_EQ(candidates.size(), unique.size());
+            EXPECT_EQ(1, unique.count(j * 4 + i)) << "at " << i << ", " << j;
+            EXPECT_EQ(1, unique.count(17));
+            EXPECT_GE(1 + BvhBuilder::max_leaf_size, candidates.size());
+        }
+    }
+
+    // Points outside the finite volumes only test the infinite one
+    EXPECT_EQ(VecVolume{17}, this->find_candidates(bvh, {10, 10, 10}));
+}
+
+TEST_F(BvhBuilderTest, empty)
+{
+    auto bvh = BvhBuilder{&data_}({BoundingBox{}});
+    EXPECT_EQ(0, bvh.size());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,172 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/OrangeCache.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/detail/OrangeCache.hh"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/sys/Environment.hh"
+#include "orange/OrangeParams.hh"
+
+#include "celeritas_test.hh"
+
+using celeritas::detail::hash_file_contents;
+using celeritas::detail::OrangeCacheData;
+using celeritas::detail::read_orange_cache;
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class OrangeCacheTest : public Test
+{
+  protected:
+    static void SetUpTestCase()
+    {
+        // Environment variables can't be overwritten, so use the same cache
+        // file for all tests
+        environment().insert({"CELER_ORANGE_CACHE", cache_filename_});
+    }
+
+    void SetUp() override
+    {
+        json_filename_ = this->test_data_path("orange", "universes.org.json");
+        std::remove(cache_filename_.c_str());
+    }
+
+    void TearDown() override { std::remove(cache_filename_.c_str()); }
+
+    //! Read the cache file contents
+    std::string read_cache() const
+    {
+        std::ifstream infile(cache_filename_, std::ios::binary);
+        return {std::istreambuf_iterator<char>(infile),
+                std::istreambuf_iterator<char>()};
+    }
+
+    //! Overwrite the cache file
+    void write_cache(std::string const& contents) const
+    {
+        std::ofstream outfile(cache_filename_, std::ios::binary);
+        outfile << contents;
+    }
+
+    static std::string const cache_filename_;
+    std::string json_filename_;
+};
+
+std::string const OrangeCacheTest::cache_filename_ = "orangecache.bin";
+
+#define OrangeCacheTest TEST_IF_CELERITAS_JSON(OrangeCacheTest)
+
+//---------------------------------------------------------------------------//
+TEST_F(OrangeCacheTest, round_trip)
+{
+    // Build from JSON and write the cache
+    OrangeParams built(json_filename_);
+    ASSERT_FALSE(this->read_cache().empty());
+
+    // Load from the cache
+    OrangeParams cached(json_filename_);
+
+    EXPECT_EQ(built.num_volumes(), cached.num_volumes());
+    EXPECT_EQ(built.num_surfaces(), cached.num_surfaces());
+    for (auto i : range(built.num_volumes()))
+    {
+        EXPECT_EQ(built.id_to_label(VolumeId{i}),
+                  cached.id_to_label(VolumeId{i}));
+    }
+    for (auto i : range(built.num_surfaces()))
+    {
+        EXPECT_EQ(built.id_to_label(SurfaceId{i}),
+                  cached.id_to_label(SurfaceId{i}));
+    }
+    EXPECT_VEC_EQ(built.bbox().lower(), cached.bbox().lower());
+    EXPECT_VEC_EQ(built.bbox().upper(), cached.bbox().upper());
+    EXPECT_EQ(built.supports_safety(), cached.supports_safety());
+
+    auto const& expected = built.host_ref();
+    auto const& actual = cached.host_ref();
+    EXPECT_EQ(expected.scalars.max_level, actual.scalars.max_level);
+    EXPECT_EQ(expected.scalars.max_faces, actual.scalars.max_faces);
+    EXPECT_EQ(expected.universe_type.size(), actual.universe_type.size());
+    EXPECT_EQ(expected.volume_records.size(), actual.volume_records.size());
+    EXPECT_EQ(expected.daughters.size(), actual.daughters.size());
+    EXPECT_VEC_EQ(expected.reals[AllItems<real_type>{}],
+                  actual.reals[AllItems<real_type>{}]);
+    EXPECT_VEC_EQ(expected.logic_ints[AllItems<logic_int>{}],
+                  actual.logic_ints[AllItems<logic_int>{}]);
+    EXPECT_VEC_EQ(
+        expected.unit_indexer_data.volumes[AllItems<size_type>{}],
+        actual.unit_indexer_data.volumes[AllItems<size_type>{}]);
+}
+
+TEST_F(OrangeCacheTest, stale)
+{
+    OrangeParams built(json_filename_);
+    auto const source_hash = hash_file_contents(json_filename_);
+
+    OrangeCacheData data;
+    EXPECT_TRUE(read_orange_cache(cache_filename_, source_hash, &data));
+    EXPECT_TRUE(data.data);
+    EXPECT_EQ(built.num_volumes(), data.volume_labels.size());
+
+    // Different source content
+    OrangeCacheData other;
+    EXPECT_FALSE(read_orange_cache(cache_filename_, source_hash + 1, &other));
+    EXPECT_FALSE(other.data);
+
+    // Missing file
+    EXPECT_FALSE(read_orange_cache(
+        cache_filename_ + ".missing", source_hash, &other));
+
+    // Written by a different version: change the build hash, which follows
+    // the magic string, format version, and real size in the header
+    std::string contents = this->read_cache();
+    contents[16] = static_cast<char>(contents[16] + 1);
+    this->write_cache(contents);
+    EXPECT_FALSE(read_orange_cache(cache_filename_, source_hash, &other));
+    EXPECT_FALSE(other.data);
+}
+
+TEST_F(OrangeCacheTest, corrupt)
+{
+    OrangeParams built(json_filename_);
+    auto const source_hash = hash_file_contents(json_filename_);
+    std::string const contents = this->read_cache();
+
+    OrangeCacheData data;
+    // Truncated file
+    this->write_cache(contents.substr(0, contents.size() / 2));
+    EXPECT_THROW(read_orange_cache(cache_filename_, source_hash, &data),
+                 RuntimeError);
+
+    // Trailing data
+    this->write_cache(contents + "extra");
+    EXPECT_THROW(read_orange_cache(cache_filename_, source_hash, &data),
+                 RuntimeError);
+
+    // Not a cache file
+    this->write_cache(std::string(64, 'x'));
+    EXPECT_THROW(read_orange_cache(cache_filename_, source_hash, &data),
+                 RuntimeError);
+
+    // A corrupt cache is rebuilt
+    this->write_cache(contents.substr(0, 100));
+    OrangeParams rebuilt(json_filename_);
+    EXPECT_EQ(built.num_volumes(), rebuilt.num_volumes());
+    EXPECT_EQ(contents.size(), this->read_cache().size());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
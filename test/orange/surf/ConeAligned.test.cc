@@ -0,0 +1,94 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/surf/ConeAligned.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/surf/ConeAligned.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+TEST(TestConeX, construction)
+{
+    EXPECT_EQ(4, ConeX::Storage::extent);
+    EXPECT_EQ(2, ConeX::Intersections{}.size());
+    EXPECT_EQ(SurfaceType::kx, ConeX::surface_type());
+
+    ConeX c({1, 2, 3}, 0.5);
+    const real_type expected_data[] = {1, 2, 3, 0.25};
+    EXPECT_VEC_SOFT_EQ(expected_data, c.data());
+
+    ConeX c2(c.data());
+    EXPECT_VEC_SOFT_EQ((Real3{1, 2, 3}), c2.origin());
+    EXPECT_SOFT_EQ(0.25, c2.tangent_sq());
+}
+
+TEST(TestConeX, sense)
+{
+    ConeX cone({1, 2, 3}, 0.5);
+
+    EXPECT_EQ(SignedSense::inside, cone.calc_sense(Real3{3, 2, 3.5}));
+    EXPECT_EQ(SignedSense::inside, cone.calc_sense(Real3{-1, 2, 2.5}));
+    EXPECT_EQ(SignedSense::outside, cone.calc_sense(Real3{3, 2, 4.5}));
+}
+
+TEST(TestConeX, normal)
+{
+    ConeX cone({1, 2, 3}, 0.5);
+
+    EXPECT_VEC_SOFT_EQ((Real3{-0.4472135954999579, 0, 0.8944271909999159}),
+                       cone.calc_normal(Real3{3, 2, 4}));
+    EXPECT_VEC_SOFT_EQ((Real3{0.4472135954999579, 0, 0.8944271909999159}),
+                       cone.calc_normal(Real3{-1, 2, 4}));
+}
+
+TEST(TestConeX, intersect)
+{
+    ConeX cone({1, 2, 3}, 0.5);
+
+    // From inside, perpendicular to the axis
+    auto distances = cone.calc_intersections(
+        Real3{3, 2, 3}, Real3{0, 0, 1}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+    EXPECT_SOFT_EQ(1.0, distances[1]);
+
+    // From outside, crossing through the vertex
+    distances = cone.calc_intersections(
+        Real3{-5, 2, 3}, Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_SOFT_EQ(6.0, distances[0]);
+    EXPECT_EQ(no_intersection(), distances[1]);
+
+    // From the surface, heading inward
+    distances = cone.calc_intersections(
+        Real3{3, 2, 4}, Real3{0, 0, -1}, SurfaceState::on);
+    EXPECT_SOFT_EQ(2.0, distances[0]);
+    EXPECT_EQ(no_intersection(), distances[1]);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(TestConeZ, intersect)
+{
+    ConeZ cone({0, 0, 0}, 1.0);
+
+    EXPECT_EQ(SurfaceType::kz, ConeZ::surface_type());
+    EXPECT_EQ(SignedSense::inside, cone.calc_sense(Real3{0.5, 0, 1}));
+
+    // Crossing both nappes from outside
+    auto distances = cone.calc_intersections(
+        Real3{-3, 0, 1}, Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_SOFT_EQ(2.0, distances[0]);
+    EXPECT_SOFT_EQ(4.0, distances[1]);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,106 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/surf/CylAligned.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/surf/CylAligned.hh"
+
+#include "corecel/math/Algorithms.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+TEST(TestCylX, construction)
+{
+    EXPECT_EQ(3, CylX::Storage::extent);
+    EXPECT_EQ(2, CylX::Intersections{}.size());
+
+    CylX c({1234, 1, 2}, 3.0);
+
+    const real_type expected_data[] = {1, 2, ipow<2>(3)};
+    EXPECT_VEC_SOFT_EQ(expected_data, c.data());
+    EXPECT_EQ(SurfaceType::cx, CylX::surface_type());
+
+    CylX c2(c.data());
+    EXPECT_SOFT_EQ(1, c2.origin_u());
+    EXPECT_SOFT_EQ(2, c2.origin_v());
+    EXPECT_SOFT_EQ(9, c2.radius_sq());
+}
+
+TEST(TestCylX, sense)
+{
+    CylX cyl({0, 1, 2}, 3.0);
+
+    EXPECT_EQ(SignedSense::inside, cyl.calc_sense(Real3{0, 1, 4}));
+    EXPECT_EQ(SignedSense::outside, cyl.calc_sense(Real3{0, 1, 5.5}));
+    EXPECT_EQ(SignedSense::outside, cyl.calc_sense(Real3{0, -3, 0}));
+}
+
+TEST(TestCylX, normal)
+{
+    CylX cyl({0, 1, 2}, 3.0);
+
+    EXPECT_VEC_SOFT_EQ((Real3{0, 1, 0}), cyl.calc_normal(Real3{5, 4, 2}));
+    EXPECT_VEC_SOFT_EQ((Real3{0, 0, -1}), cyl.calc_normal(Real3{-3, 1, -1}));
+}
+
+TEST(TestCylX, intersect)
+{
+    CylX cyl({0, 1, 2}, 3.0);
+
+    // From inside
+    auto distances = cyl.calc_intersections(
+        Real3{0, 1, 3.5}, Real3{0, 1, 0}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+    EXPECT_SOFT_EQ(2.598076211353316, distances[1]);
+
+    // From outside, hitting both
+    distances = cyl.calc_intersections(
+        Real3{0, 1, -3}, Real3{0, 0, 1}, SurfaceState::off);
+    EXPECT_SOFT_EQ(2.0, distances[0]);
+    EXPECT_SOFT_EQ(8.0, distances[1]);
+
+    // From outside, hitting neither
+    distances = cyl.calc_intersections(
+        Real3{0, 1, -3}, Real3{0, 1, 0}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+    EXPECT_EQ(no_intersection(), distances[1]);
+
+    // Along the axis
+    distances = cyl.calc_intersections(
+        Real3{0, 1, 2}, Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+    EXPECT_EQ(no_intersection(), distances[1]);
+
+    // From the surface
+    distances = cyl.calc_intersections(
+        Real3{1.23, 4, 2}, Real3{0, -1, 0}, SurfaceState::on);
+    EXPECT_SOFT_EQ(6.0, distances[0]);
+    EXPECT_EQ(no_intersection(), distances[1]);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(TestCylZ, intersect)
+{
+    CylZ cyl({1, 2, 1234}, 1.0);
+
+    EXPECT_EQ(SignedSense::inside, cyl.calc_sense(Real3{1.5, 2, -100}));
+    auto distances = cyl.calc_intersections(
+        Real3{1, 2, 5}, Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+    EXPECT_SOFT_EQ(1.0, distances[1]);
+    EXPECT_VEC_SOFT_EQ((Real3{-1, 0, 0}), cyl.calc_normal(Real3{0, 2, 3}));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,87 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/surf/Plane.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/surf/Plane.hh"
+
+#include <cmath>
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class PlaneTest : public Test
+{
+  protected:
+    real_type const sqrt_half = std::sqrt(real_type(0.5));
+};
+
+TEST_F(PlaneTest, construction)
+{
+    EXPECT_EQ(SurfaceType::p, Plane::surface_type());
+    EXPECT_EQ(4, Plane::Storage::extent);
+    EXPECT_EQ(1, Plane::Intersections{}.size());
+
+    Plane p({sqrt_half, sqrt_half, 0}, Real3{1, 1, 0});
+    const real_type expected_data[] = {sqrt_half, sqrt_half, 0, 2 * sqrt_half};
+    EXPECT_VEC_SOFT_EQ(expected_data, p.data());
+
+    Plane p2({0, 0, 1}, 3.0);
+    EXPECT_VEC_SOFT_EQ((Real3{0, 0, 1}), p2.normal());
+    EXPECT_SOFT_EQ(3.0, p2.displacement());
+
+    Plane p3(p.data());
+    EXPECT_VEC_SOFT_EQ(p.normal(), p3.normal());
+    EXPECT_SOFT_EQ(p.displacement(), p3.displacement());
+}
+
+TEST_F(PlaneTest, sense)
+{
+    Plane p({sqrt_half, sqrt_half, 0}, Real3{1, 1, 0});
+
+    EXPECT_EQ(SignedSense::inside, p.calc_sense(Real3{0, 0, 0}));
+    EXPECT_EQ(SignedSense::outside, p.calc_sense(Real3{2, 2, 0}));
+    EXPECT_EQ(SignedSense::inside, p.calc_sense(Real3{0.9, 1, 100}));
+}
+
+TEST_F(PlaneTest, normal)
+{
+    Plane p({sqrt_half, sqrt_half, 0}, Real3{1, 1, 0});
+    EXPECT_VEC_SOFT_EQ((Real3{sqrt_half, sqrt_half, 0}),
+                       p.calc_normal(Real3{2, 0, 3}));
+}
+
+TEST_F(PlaneTest, intersect)
+{
+    Plane p({sqrt_half, sqrt_half, 0}, Real3{1, 1, 0});
+
+    // Heading toward
+    auto distances = p.calc_intersections(
+        Real3{0, 0, 0}, Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_SOFT_EQ(2.0, distances[0]);
+
+    // Heading away
+    distances = p.calc_intersections(
+        Real3{2, 2, 0}, Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+
+    // Parallel
+    distances = p.calc_intersections(
+        Real3{0, 0, 0}, Real3{sqrt_half, -sqrt_half, 0}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+
+    // On the surface
+    distances = p.calc_intersections(
+        Real3{1, 1, 0}, Real3{-1, 0, 0}, SurfaceState::on);
+    EXPECT_EQ(no_intersection(), distances[0]);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,88 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/surf/SimpleQuadric.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/surf/SimpleQuadric.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Ellipsoid centered on (1, 2, 3) with radii (2, 3, 1):
+ * \f[
+   9(x-1)^2 + 4(y-2)^2 + 36(z-3)^2 - 36 = 0
+   \f]
+ */
+class SimpleQuadricTest : public Test
+{
+  protected:
+    SimpleQuadric sq_{{9, 4, 36}, {-18, -16, -216}, 313};
+};
+
+TEST_F(SimpleQuadricTest, construction)
+{
+    EXPECT_EQ(7, SimpleQuadric::Storage::extent);
+    EXPECT_EQ(2, SimpleQuadric::Intersections{}.size());
+    EXPECT_EQ(SurfaceType::sq, SimpleQuadric::surface_type());
+
+    const real_type expected_data[] = {9, 4, 36, -18, -16, -216, 313};
+    EXPECT_VEC_SOFT_EQ(expected_data, sq_.data());
+
+    SimpleQuadric sq2(sq_.data());
+    EXPECT_VEC_SOFT_EQ((Real3{9, 4, 36}), sq2.second());
+    EXPECT_VEC_SOFT_EQ((Real3{-18, -16, -216}), sq2.first());
+    EXPECT_SOFT_EQ(313, sq2.zeroth());
+}
+
+TEST_F(SimpleQuadricTest, sense)
+{
+    EXPECT_EQ(SignedSense::inside, sq_.calc_sense(Real3{1, 2, 3}));
+    EXPECT_EQ(SignedSense::inside, sq_.calc_sense(Real3{2.9, 2, 3}));
+    EXPECT_EQ(SignedSense::outside, sq_.calc_sense(Real3{1, 2, 4.1}));
+    EXPECT_EQ(SignedSense::outside, sq_.calc_sense(Real3{1, 5.1, 3}));
+}
+
+TEST_F(SimpleQuadricTest, normal)
+{
+    EXPECT_VEC_SOFT_EQ((Real3{1, 0, 0}), sq_.calc_normal(Real3{3, 2, 3}));
+    EXPECT_VEC_SOFT_EQ((Real3{0, -1, 0}), sq_.calc_normal(Real3{1, -1, 3}));
+    EXPECT_VEC_SOFT_EQ((Real3{0, 0, 1}), sq_.calc_normal(Real3{1, 2, 4}));
+}
+
+TEST_F(SimpleQuadricTest, intersect)
+{
+    // From the center
+    auto distances = sq_.calc_intersections(
+        Real3{1, 2, 3}, Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+    EXPECT_SOFT_EQ(2.0, distances[1]);
+
+    // From outside, crossing both sides
+    distances = sq_.calc_intersections(
+        Real3{-2, 2, 3}, Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_SOFT_EQ(1.0, distances[0]);
+    EXPECT_SOFT_EQ(5.0, distances[1]);
+
+    // From outside, missing
+    distances = sq_.calc_intersections(
+        Real3{-2, 2, 5}, Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+    EXPECT_EQ(no_intersection(), distances[1]);
+
+    // From the surface, heading inward
+    distances = sq_.calc_intersections(
+        Real3{3, 2, 3}, Real3{-1, 0, 0}, SurfaceState::on);
+    EXPECT_SOFT_EQ(4.0, distances[0]);
+    EXPECT_EQ(no_intersection(), distances[1]);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -8,7 +8,9 @@
 #include "orange/univ/SimpleUnitTracker.hh"
 
 #include <algorithm>
+#include <cmath>
 #include <random>
+#include <string>
 
 #include "celeritas_config.h"
 #include "corecel/data/CollectionAlgorithms.hh"
@@ -19,7 +21,17 @@
 #include "corecel/sys/Stopwatch.hh"
 #include "orange/OrangeGeoTestBase.hh"
 #include "orange/OrangeParams.hh"
+#include "orange/construct/OrangeInput.hh"
+#include "orange/construct/SurfaceInputBuilder.hh"
+#include "orange/surf/CylAligned.hh"
+#include "orange/surf/CylCentered.hh"
+#include "orange/surf/Plane.hh"
+#include "orange/surf/PlaneAligned.hh"
+#include "orange/surf/SimpleQuadric.hh"
+#include "orange/surf/Sphere.hh"
+#include "orange/surf/SphereCentered.hh"
 #include "orange/detail/UnitIndexer.hh"
+#include "orange/detail/VolumeBboxCalculator.hh"
 #include "celeritas/Constants.hh"
 #include "celeritas/random/distribution/IsotropicDistribution.hh"
 #include "celeritas/random/distribution/UniformBoxDistribution.hh"
@@ -127,6 +139,11 @@ class FiveVolumesTest : public SimpleUnitTrackerTest
     void SetUp() override { this->build_geometry("five-volumes.org.json"); }
 };
 
+class FacetedBarrelTest : public SimpleUnitTrackerTest
+{
+    void SetUp() override;
+};
+
 //---------------------------------------------------------------------------//
 // TEST FIXTURE IMPLEMENTATION
 //---------------------------------------------------------------------------//
@@ -215,6 +232,111 @@ LocalState SimpleUnitTrackerTest::make_state_crossing(
     return state;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct volumes with many faces of several surface types.
+ *
+ * A cylindrical "barrel" contains a sphere at the origin, a ring of 24 small
+ * spheres, four rods, and an ellipsoid. The gap between the barrel and the
+ * 24-sided prism around it is the second volume with many faces.
+ */
+void FacetedBarrelTest::SetUp()
+{
+    using Flags = VolumeInput::Flags;
+    constexpr int num_facets = 24;
+    constexpr int num_balls = 24;
+    constexpr real_type half_height = 10;
+
+    UnitInput input;
+    SurfaceInputBuilder insert(&input.surfaces);
+
+    // Each term of a volume definition is a face and whether the volume is
+    // inside it
+    using Term = std::pair<LocalSurfaceId, bool>;
+    auto make_volume = [](char const* label, std::vector<Term> terms) {
+        std::sort(terms.begin(), terms.end());
+        VolumeInput result;
+        result.label = label;
+        for (auto i : range(terms.size()))
+        {
+            result.faces.push_back(terms[i].first);
+            result.logic.push_back(i);
+            if (terms[i].second)
+            {
+                result.logic.push_back(logic::lnot);
+            }
+            if (i > 0)
+            {
+                result.logic.push_back(logic::land);
+            }
+        }
+        return result;
+    };
+
+    std::vector<Term> hull;
+    for (auto i : range(num_facets))
+    {
+        real_type angle = 2 * constants::pi * i / num_facets;
+        hull.push_back(
+            {insert(Plane({std::cos(angle), std::sin(angle), 0}, 10.0),
+                    Label("facet", std::to_string(i))),
+             true});
+    }
+    Term const zlo{insert(PlaneZ(-half_height), Label("zlo")), false};
+    Term const zhi{insert(PlaneZ(half_height), Label("zhi")), true};
+    hull.push_back(zlo);
+    hull.push_back(zhi);
+
+    auto barrel = insert(CCylZ(9.8), Label("barrel"));
+    std::vector<Term> barrel_terms{{barrel, true}, zlo, zhi};
+
+    // Exterior is complex because the hull's facets are all in one volume
+    auto exterior = make_volume("[EXTERIOR]", hull);
+    exterior.logic.push_back(logic::lnot);
+    exterior.flags = Flags::internal_surfaces;
+    input.volumes.push_back(std::move(exterior));
+
+    std::vector<VolumeInput> inner;
+    auto add_inner = [&](LocalSurfaceId id, std::string const& label) {
+        barrel_terms.push_back({id, false});
+        inner.push_back(make_volume(label.c_str(), {{id, true}}));
+    };
+    add_inner(insert(SphereCentered(1.5), Label("core")), "core");
+    for (auto i : range(num_balls))
+    {
+        real_type angle = 2 * constants::pi * i / num_balls;
+        auto label = "ball" + std::to_string(i);
+        add_inner(insert(Sphere({4 * std::cos(angle), 4 * std::sin(angle), 0},
+                                0.3),
+                         Label(label)),
+                  label);
+    }
+    for (auto i : range(4))
+    {
+        real_type angle = 2 * constants::pi * (i + real_type(1) / 12) / 4;
+        auto label = "rod" + std::to_string(i);
+        auto id = insert(
+            CylZ({7 * std::cos(angle), 7 * std::sin(angle), 0}, 1.0),
+            Label(label));
+        barrel_terms.push_back({id, false});
+        inner.push_back(make_volume(label.c_str(), {{id, true}, zlo, zhi}));
+    }
+    // Ellipsoid centered on z = -7 with semi-axes 2, 2, 1
+    add_inner(insert(SimpleQuadric({0.25, 0.25, 1}, {0, 0, 14}, 48),
+                     Label("egg")),
+              "egg");
+
+    hull.push_back({barrel, false});
+    input.volumes.push_back(make_volume("gap", std::move(hull)));
+    input.volumes.push_back(make_volume("barrel", std::move(barrel_terms)));
+    input.volumes.insert(input.volumes.end(), inner.begin(), inner.end());
+
+    input.bbox = {{-10, -10, -half_height}, {10, 10, half_height}};
+    input.label = "faceted barrel";
+
+    this->build_geometry(std::move(input));
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Initialize particles randomly and tally their resulting locations.
@@ -768,6 +890,51 @@ TEST_F(FiveVolumesTest, properties)
     EXPECT_VEC_SOFT_EQ(Real3({1.5, 1.5, 0.5}), bbox.upper());
 }
 
+TEST_F(FiveVolumesTest, volume_bbox)
+{
+    auto const& unit = this->host_params().simple_unit[SimpleUnitId{0}];
+    Surfaces surfaces{this->host_params(), unit.surfaces};
+    ::celeritas::detail::VolumeBboxCalculator calc_bbox{surfaces, 0, 0};
+    auto volume_bbox = [&](char const* label) {
+        VolumeView vol{this->host_params(),
+                       unit,
+                       LocalVolumeId{this->find_volume(label).get()}};
+        return calc_bbox(vol.faces(), vol.logic());
+    };
+
+    {
+        SCOPED_TRACE("Outside a sphere");
+        auto bbox = volume_bbox("[EXTERIOR]");
+        ASSERT_TRUE(bbox);
+        EXPECT_VEC_SOFT_EQ(BoundingBox::from_infinite().lower(), bbox.lower());
+        EXPECT_VEC_SOFT_EQ(BoundingBox::from_infinite().upper(), bbox.upper());
+    }
+    {
+        SCOPED_TRACE("Box of planes");
+        auto bbox = volume_bbox("a");
+        ASSERT_TRUE(bbox);
+        EXPECT_VEC_SOFT_EQ((Real3{-1, 0, -0.5}), bbox.lower());
+        EXPECT_VEC_SOFT_EQ((Real3{0, 1, 0.5}), bbox.upper());
+    }
+    {
+        SCOPED_TRACE("Sphere");
+        auto bbox = volume_bbox("e");
+        ASSERT_TRUE(bbox);
+        EXPECT_VEC_SOFT_EQ((Real3{-0.5, -0.5, -0.25}), bbox.lower());
+        EXPECT_VEC_SOFT_EQ((Real3{0, 0, 0.25}), bbox.upper());
+    }
+    {
+        SCOPED_TRACE("Inside a sphere but outside another");
+        auto bbox = volume_bbox("c");
+        ASSERT_TRUE(bbox);
+        EXPECT_VEC_SOFT_EQ((Real3{-0.75, -0.75, -0.75}), bbox.lower());
+        EXPECT_VEC_SOFT_EQ((Real3{0.75, 0.75, 0.75}), bbox.upper());
+    }
+
+    // Every explicit volume is in the hierarchy
+    EXPECT_LT(0, unit.bvh.size());
+}
+
 TEST_F(FiveVolumesTest, initialize)
 {
     SimpleUnitTracker tracker(this->host_params(), SimpleUnitId{0});
@@ -954,6 +1121,94 @@ TEST_F(FiveVolumesTest, heuristic_init)
     }
 }
 
+TEST_F(FacetedBarrelTest, batches)
+{
+    auto get_batch_types = [this](char const* label) {
+        VolumeView vol{this->host_params(),
+                       this->host_params().simple_unit[SimpleUnitId{0}],
+                       LocalVolumeId{this->find_volume(label).unchecked_get()}};
+        std::vector<std::string> result;
+        for (auto const& batch : vol.batches())
+        {
+            result.push_back(std::string(to_cstring(batch.type)) + ":"
+                             + std::to_string(batch.faces.size()));
+        }
+        return result;
+    };
+
+    static char const* const expected_gap[] = {"pz:2", "czc:1", "p:24"};
+    EXPECT_VEC_EQ(expected_gap, get_batch_types("gap"));
+    static char const* const expected_barrel[]
+        = {"pz:2", "czc:1", "sc:1", "cz:4", "s:24", "sq:1"};
+    EXPECT_VEC_EQ(expected_barrel, get_batch_types("barrel"));
+    EXPECT_EQ(0, get_batch_types("[EXTERIOR]").size());
+    EXPECT_EQ(0, get_batch_types("rod0").size());
+}
+
+TEST_F(FacetedBarrelTest, batch_intersect)
+{
+    SimpleUnitTracker tracker(this->host_params(), SimpleUnitId{0});
+
+    // Construct a tracker that intersects the faces one at a time
+    HostVal<OrangeParamsData> unbatched_data;
+    unbatched_data = this->host_params();
+    for (VolumeRecord& vr :
+         unbatched_data.volume_records[AllItems<VolumeRecord>{}])
+    {
+        vr.batches = {};
+    }
+    auto const unbatched_ref = make_const_ref(unbatched_data);
+    SimpleUnitTracker expected_tracker(unbatched_ref, SimpleUnitId{0});
+
+    std::mt19937 rng;
+    UniformBoxDistribution<> sample_box{{-10, -10, -10}, {10, 10, 10}};
+    IsotropicDistribution<> sample_isotropic;
+
+    size_type num_batched{0};
+    for (int i = 0; i < 256; ++i)
+    {
+        auto state = this->make_state(sample_box(rng), sample_isotropic(rng));
+        state.volume = tracker.initialize(state).volume;
+        ASSERT_TRUE(state.volume);
+
+        // Track through the geometry, comparing the intersections
+        for (int step = 0; step < 16; ++step)
+        {
+            VolumeView vol{this->host_params(),
+                           this->host_params().simple_unit[SimpleUnitId{0}],
+                           state.volume};
+            num_batched += !vol.batches().empty();
+
+            auto expected = expected_tracker.intersect(state);
+            auto actual = tracker.intersect(state);
+            ASSERT_EQ(expected.surface.id(), actual.surface.id());
+            if (!expected)
+            {
+                break;
+            }
+            EXPECT_EQ(expected.surface.unchecked_sense(),
+                      actual.surface.unchecked_sense());
+            EXPECT_EQ(expected.distance, actual.distance);
+
+            // Limit the search distance
+            real_type max_dist = expected.distance / 2;
+            EXPECT_EQ(expected_tracker.intersect(state, max_dist).distance,
+                      tracker.intersect(state, max_dist).distance);
+            EXPECT_FALSE(tracker.intersect(state, max_dist));
+
+            // Cross into the next volume
+            axpy(actual.distance, state.dir, &state.pos);
+            state.surface = {actual.surface.id(),
+                             flip_sense(actual.surface.unchecked_sense())};
+            auto init = tracker.cross_boundary(state);
+            ASSERT_TRUE(init.volume);
+            state.volume = init.volume;
+            state.surface = init.surface;
+        }
+    }
+    EXPECT_LT(256, num_batched);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
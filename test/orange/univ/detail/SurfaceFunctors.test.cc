@@ -152,6 +152,29 @@ TEST_F(SurfaceFunctorsTest, calc_safety_distance)
     EXPECT_SOFT_EQ(0.0, calc_distance(LocalSurfaceId{1}));
 }
 
+//---------------------------------------------------------------------------//
+
+TEST(CalcSafetyBoundTest, general_quadric)
+{
+    // Sphere of radius 2 at the origin
+    GeneralQuadric sph{{1, 1, 1}, {0, 0, 0}, {0, 0, 0}, -4};
+    EXPECT_SOFT_EQ(1.519671371303185, calc_safety_bound(sph, {0, 0, 0}));
+    EXPECT_SOFT_EQ(0.0982331909809777, calc_safety_bound(sph, {1.9, 0, 0}));
+    EXPECT_SOFT_EQ(0.0982331909809777, calc_safety_bound(sph, {0, 0, -1.9}));
+    EXPECT_SOFT_EQ(0, calc_safety_bound(sph, {0, 2, 0}));
+    EXPECT_GT(1.0, calc_safety_bound(sph, {3, 0, 0}));
+
+    // Plane x = 1: bound is exact
+    GeneralQuadric px{{0, 0, 0}, {0, 0, 0}, {1, 0, 0}, -1};
+    EXPECT_SOFT_EQ(2, calc_safety_bound(px, {3, 0, 0}));
+    EXPECT_SOFT_EQ(1.5, calc_safety_bound(px, {-0.5, 1, 2}));
+
+    // Generic functor uses the bound
+    Real3 const pos{1.9, 0, 0};
+    CalcSafetyDistance calc_distance{pos};
+    EXPECT_SOFT_EQ(0.0982331909809777, calc_distance(GeneralQuadric{sph}));
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace detail